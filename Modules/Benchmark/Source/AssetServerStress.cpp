@@ -0,0 +1,210 @@
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/AssetServer.hpp>
+
+// Readers look assets up while writers add, set and release them and the main thread commits, short lived threads pin
+// the reclaimer on the side so its thread slots have to be recycled. Run it under a sanitizer to catch reclaimed reads.
+// The readers first run alone against a filled server and the writers join halfway, every Get(), Contains() and
+// Commit() is timed so the latencies with and without writers can be compared.
+namespace {
+    std::atomic<std::uint64_t> g_Released{0u};
+    std::atomic<std::uint64_t> g_Commits{0u};
+    std::atomic<std::size_t>   g_MaxIndex{0u};
+    std::atomic<bool>          g_IsStopping{false};
+    std::atomic<bool>          g_IsCorrupt{false};
+    std::atomic<bool>          g_HasWriters{false};
+
+    constexpr std::uint64_t PREFILL_COUNT = 4096u;
+
+    struct Counter : public vre::IAsset {
+        std::uint64_t Value{0u};
+        std::uint64_t Check{~std::uint64_t(0u)};
+
+        Counter() = default;
+        Counter(std::uint64_t value)
+            : Value{value}, Check{~value} {}
+
+        void release() override {
+            g_Released.fetch_add(1u, std::memory_order_relaxed);
+            Check = 0u;
+        }
+    };
+
+    // Writers make at most BURST_SIZE writes per commit like a frame would and readers sleep between bursts, so the
+    // committing thread keeps up even on a machine with fewer cores than threads.
+    constexpr std::uint64_t BURST_SIZE = 64u;
+
+    // Indexed by whether the writers were running when the sample was taken.
+    using Samples = std::array<std::vector<std::uint32_t>, 2u>;
+
+    struct Latencies {
+        Samples Get;
+        Samples Contains;
+    };
+
+    std::uint32_t Nanoseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+        return std::uint32_t(std::min<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    void Report(std::string_view name, std::vector<std::uint32_t> &samples) {
+        if (samples.empty()) {
+            LOG_INFO("{:<24} no samples", name);
+            return;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        LOG_INFO("{:<24} {:>9} samples, p50 {:>7} ns, p99 {:>7} ns, max {:>9} ns", name, samples.size(), samples[samples.size() / 2u], samples[samples.size() * 99u / 100u], samples.back());
+    }
+
+    void WaitForCommit(std::uint64_t &commit) {
+        while (g_Commits.load() == commit && !g_IsStopping.load(std::memory_order_relaxed))
+            std::this_thread::sleep_for(std::chrono::microseconds{100});
+        commit = g_Commits.load();
+    }
+
+    Latencies Read(std::uint32_t seed) {
+        Latencies     latencies{};
+        std::uint64_t operations = 0u;
+        std::uint64_t state      = seed * 0x9E3779B97F4A7C15ull + 1u;
+        while (!g_IsStopping.load(std::memory_order_relaxed)) {
+            if (++operations % BURST_SIZE == 0u) std::this_thread::sleep_for(std::chrono::microseconds{200});
+            state ^= state << 13u;
+            state ^= state >> 7u;
+            state ^= state << 17u;
+
+            const std::size_t maxIndex = g_MaxIndex.load(std::memory_order_relaxed);
+            if (maxIndex == 0u) continue;
+
+            const std::size_t index   = 1u + state % maxIndex;
+            const std::size_t writers = g_HasWriters.load(std::memory_order_relaxed) ? 1u : 0u;
+
+            const auto                     start   = std::chrono::steady_clock::now();
+            std::shared_ptr<const Counter> counter = vre::AssetServer::Get<Counter>(index);
+            const auto                     got     = std::chrono::steady_clock::now();
+            vre::AssetServer::Contains<Counter>(index);
+            const auto end = std::chrono::steady_clock::now();
+            latencies.Get[writers].push_back(Nanoseconds(start, got));
+            latencies.Contains[writers].push_back(Nanoseconds(got, end));
+
+            if (counter != nullptr && counter->Check != ~counter->Value) g_IsCorrupt.store(true);
+            vre::AssetServer::Count<Counter>();
+        }
+        return latencies;
+    }
+
+    std::uint64_t Write(std::uint32_t seed) {
+        std::vector<std::size_t> indices{};
+        std::uint64_t            writes     = 0u;
+        std::uint64_t            operations = 0u;
+        std::uint64_t            commit     = 0u;
+        std::uint64_t            state      = seed * 0xD1B54A32D192ED03ull + 1u;
+        while (!g_IsStopping.load(std::memory_order_relaxed)) {
+            if (++operations % BURST_SIZE == 0u) WaitForCommit(commit);
+            state ^= state << 13u;
+            state ^= state >> 7u;
+            state ^= state << 17u;
+
+            const std::uint64_t operation = state % 4u;
+            if (indices.empty() || operation == 0u) {
+                vre::AssetHandle<Counter> handle = vre::AssetServer::Add(Counter{state});
+                indices.push_back(handle.getIndex());
+
+                std::size_t maxIndex = g_MaxIndex.load(std::memory_order_relaxed);
+                while (indices.back() > maxIndex && !g_MaxIndex.compare_exchange_weak(maxIndex, indices.back())) {}
+                writes++;
+            } else if (operation == 3u) {
+                const std::size_t i = state % indices.size();
+                vre::AssetServer::Release<Counter>(indices[i]);
+                indices[i] = indices.back();
+                indices.pop_back();
+            } else if (vre::AssetServer::Set(indices[state % indices.size()], Counter{state})) {
+                writes++;
+            }
+        }
+        return writes;
+    }
+}  // namespace
+
+int main(int argc, char **argv) {
+    vre::Logger::Initialize();
+
+    const std::uint32_t readerCount  = argc > 1 ? std::uint32_t(std::atoi(argv[1])) : 8u;
+    const std::uint32_t writerCount  = argc > 2 ? std::uint32_t(std::atoi(argv[2])) : 4u;
+    const std::uint32_t milliseconds = argc > 3 ? std::uint32_t(std::atoi(argv[3])) : 2000u;
+
+    vre::AssetServer::Initialize();
+
+    for (std::uint64_t i = 0u; i < PREFILL_COUNT; i++)
+        g_MaxIndex.store(vre::AssetServer::Add(Counter{i}).getIndex());
+    vre::AssetServer::Commit();
+
+    std::vector<std::future<Latencies>>     readers{};
+    std::vector<std::future<std::uint64_t>> writers{};
+    for (std::uint32_t i = 0u; i < readerCount; i++)
+        readers.push_back(std::async(std::launch::async, Read, i));
+
+    // The writers start halfway and the run lasts until at least twice vre::EpochReclaimer::MAX_THREADS short lived
+    // threads have pinned and exited.
+    const auto    start             = std::chrono::steady_clock::now();
+    std::uint64_t commits           = 0u;
+    std::uint64_t shortLivedThreads = 0u;
+    Samples       commitLatencies{};
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds{milliseconds} ||
+           shortLivedThreads < 2u * vre::EpochReclaimer::MAX_THREADS) {
+        if (!g_HasWriters.load() && std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{milliseconds / 2u}) {
+            g_HasWriters.store(true);
+            for (std::uint32_t i = 0u; i < writerCount; i++)
+                writers.push_back(std::async(std::launch::async, Write, i));
+        }
+
+        const auto commitStart = std::chrono::steady_clock::now();
+        vre::AssetServer::Commit();
+        commitLatencies[g_HasWriters.load() ? 1u : 0u].push_back(Nanoseconds(commitStart, std::chrono::steady_clock::now()));
+        g_Commits.store(++commits);
+
+        std::vector<std::thread> threads{};
+        for (std::uint32_t i = 0u; i < 8u; i++)
+            threads.emplace_back([] { vre::AssetServer::Contains<Counter>(1u); });
+        for (std::thread &thread : threads)
+            thread.join();
+        shortLivedThreads += threads.size();
+    }
+
+    g_IsStopping.store(true);
+    Latencies readLatencies{};
+    for (std::future<Latencies> &reader : readers) {
+        Latencies latencies = reader.get();
+        for (std::size_t i = 0u; i < 2u; i++) {
+            readLatencies.Get[i].insert(readLatencies.Get[i].end(), latencies.Get[i].begin(), latencies.Get[i].end());
+            readLatencies.Contains[i].insert(readLatencies.Contains[i].end(), latencies.Contains[i].begin(), latencies.Contains[i].end());
+        }
+    }
+
+    std::uint64_t writes = PREFILL_COUNT;
+    for (std::future<std::uint64_t> &writer : writers)
+        writes += writer.get();
+
+    vre::AssetServer::Commit();
+    vre::AssetServer::Shutdown();
+
+    const std::uint64_t released = g_Released.load();
+    LOG_INFO("{} readers, {} writers, {} commits, {} short lived threads, {} writes, {} released", readerCount, writerCount, commits, shortLivedThreads, writes, released);
+    Report("Get without writers", readLatencies.Get[0u]);
+    Report("Get with writers", readLatencies.Get[1u]);
+    Report("Contains without writers", readLatencies.Contains[0u]);
+    Report("Contains with writers", readLatencies.Contains[1u]);
+    Report("Commit without writers", commitLatencies[0u]);
+    Report("Commit with writers", commitLatencies[1u]);
+
+    bool isPassed = true;
+    if (g_IsCorrupt.load()) {
+        LOG_ERROR("A reader saw a released or torn asset");
+        isPassed = false;
+    }
+    if (released != writes) {
+        LOG_ERROR("{} assets were written but {} were released", writes, released);
+        isPassed = false;
+    }
+
+    vre::Logger::Shutdown();
+    return isPassed ? 0 : 1;
+}
\ No newline at end of file
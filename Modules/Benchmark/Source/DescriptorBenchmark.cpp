@@ -0,0 +1,119 @@
+#include <VREngine/Core.hpp>
+#include <VREngine/Window.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Vulkan/Command.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+#include <VREngine/Vulkan/Pipeline.hpp>
+
+// Writes the same bindings into N descriptor sets through Binder::bind(), which builds vk::WriteDescriptorSet lists, and
+// through DescriptorSet::UpdateWithTemplate(), then records N DescriptorSet::PushWithTemplate() calls when the GPU has
+// VK_KHR_push_descriptor. Only the CPU side is timed, the command buffer is never submitted.
+namespace {
+    constexpr std::uint32_t BINDING_COUNT = 4u;
+    constexpr std::uint64_t BUFFER_SIZE   = 256u;
+
+    template <typename Function>
+    double Time(std::uint32_t iterations, const Function &function) {
+        function();
+
+        double best = std::numeric_limits<double>::max();
+        for (std::uint32_t i = 0u; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    vk::DescriptorSetLayout CreateLayout(vk::DescriptorSetLayoutCreateFlags flags, const vk::Device &device) {
+        vre::Vulkan::DescriptorLayout::Builder builder{};
+        builder.setFlags(flags);
+        for (std::uint32_t binding = 0u; binding < BINDING_COUNT; binding++)
+            builder.addBinding(binding, vk::DescriptorType::eStorageBuffer);
+        return builder.build(vk::ShaderStageFlagBits::eCompute, device);
+    }
+}  // namespace
+
+int main(int argc, char **argv) {
+    vre::Logger::Initialize();
+
+    const std::uint32_t setCount   = argc > 1 ? std::uint32_t(std::atoi(argv[1])) : 4096u;
+    const std::uint32_t iterations = argc > 2 ? std::uint32_t(std::atoi(argv[2])) : 10u;
+
+    vre::Window::Initialize({
+        .Title   = "Descriptor Benchmark",
+        .Visible = false,
+    });
+    vre::Vulkan::Context::Initialize({});
+
+    const vk::Device device = vre::Vulkan::Context::GetDevice();
+
+    std::vector<vre::Vulkan::Buffer::Allocation> buffers{};
+    vre::Vulkan::DescriptorSet::Binder           binder{};
+    for (std::uint32_t binding = 0u; binding < BINDING_COUNT; binding++) {
+        buffers.push_back(vre::Vulkan::Buffer::Allocate(BUFFER_SIZE, vk::BufferUsageFlagBits::eStorageBuffer, vre::Vulkan::Context::GetVmaAllocator()));
+        binder.addStorageBuffer(binding, buffers.back());
+    }
+
+    const vk::DescriptorSetLayout layout = CreateLayout({}, device);
+
+    vre::Vulkan::DescriptorSet::Allocator allocator{};
+    allocator.init(setCount, {vre::Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageBuffer, float(BINDING_COUNT)}}, device);
+
+    std::vector<vk::DescriptorSet> sets(setCount);
+    for (vk::DescriptorSet &set : sets)
+        set = allocator.allocate(layout);
+
+    const vk::DescriptorUpdateTemplate updateTemplate = binder.createUpdateTemplate(layout, device);
+    std::vector<std::byte>             data(binder.getDataSize());
+    binder.pack(data.data());
+
+    LOG_INFO("{} sets of {} storage buffers, best of {} runs", setCount, BINDING_COUNT, iterations);
+
+    const double bindTime = Time(iterations, [&] {
+        for (const vk::DescriptorSet &set : sets)
+            binder.bind(set, device);
+    });
+    LOG_INFO("{:<20} {:8.3f} ms", "Binder::bind", bindTime);
+
+    const double templateTime = Time(iterations, [&] {
+        for (const vk::DescriptorSet &set : sets)
+            vre::Vulkan::DescriptorSet::UpdateWithTemplate(set, updateTemplate, data.data(), device);
+    });
+    LOG_INFO("{:<20} {:8.3f} ms {:6.2f}x", "UpdateWithTemplate", templateTime, bindTime / templateTime);
+
+    if (vre::Vulkan::Context::IsPushDescriptorSupported()) {
+        const vk::DescriptorSetLayout      pushLayout     = CreateLayout(vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR, device);
+        const vk::PipelineLayout           pipelineLayout = vre::Vulkan::PipelineLayout::Create({pushLayout}, device);
+        const vk::DescriptorUpdateTemplate pushTemplate   = binder.createPushTemplate(vk::PipelineBindPoint::eCompute, pipelineLayout, 0u, device);
+        const vk::CommandPool              commandPool    = vre::Vulkan::CommandPool::CreateResetCommandBuffer(vre::Vulkan::Context::GetQueueFamilyIndex(), device);
+        const vk::CommandBuffer            commandBuffer  = vre::Vulkan::CommandBuffer::AllocatePrimary(commandPool, device);
+
+        const double pushTime = Time(iterations, [&] {
+            vre::Vulkan::CommandBuffer::BeginOneTimeSubmit(commandBuffer);
+            for (std::uint32_t i = 0u; i < setCount; i++)
+                vre::Vulkan::DescriptorSet::PushWithTemplate(commandBuffer, pushTemplate, pipelineLayout, 0u, data.data());
+            vre::Vulkan::CommandBuffer::End(commandBuffer);
+        });
+        LOG_INFO("{:<20} {:8.3f} ms {:6.2f}x", "PushWithTemplate", pushTime, bindTime / pushTime);
+
+        device.destroy(commandPool);
+        device.destroy(pushTemplate);
+        device.destroy(pipelineLayout);
+        device.destroy(pushLayout);
+    } else {
+        LOG_WARN("VK_KHR_push_descriptor is not supported by the selected GPU, skipping PushWithTemplate");
+    }
+
+    device.destroy(updateTemplate);
+    allocator.release();
+    device.destroy(layout);
+    for (const vre::Vulkan::Buffer::Allocation &buffer : buffers)
+        vre::Vulkan::Buffer::Release(buffer);
+
+    vre::Vulkan::Context::Shutdown();
+    vre::Window::Shutdown();
+    vre::Logger::Shutdown();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/PixelConversion.hpp>
+
+// Times every vre::PixelConversion kernel on each instruction set the CPU supports against the scalar kernels, and reports
+// the largest difference from the scalar output. vre::ThreadPool is left uninitialized so a single kernel is measured.
+namespace {
+    using vre::PixelConversion::InstructionSet;
+
+    const char *GetName(InstructionSet instructionSet) {
+        switch (instructionSet) {
+            case InstructionSet::eAVX2:
+                return "AVX2";
+            case InstructionSet::eSSE41:
+                return "SSE4.1";
+            default:
+                return "Scalar";
+        }
+    }
+
+    template <typename Function>
+    double Time(std::uint32_t iterations, const Function &function) {
+        function();
+
+        double best = std::numeric_limits<double>::max();
+        for (std::uint32_t i = 0u; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    std::uint32_t Next(std::uint32_t &state) {
+        state ^= state << 13u;
+        state ^= state >> 17u;
+        state ^= state << 5u;
+        return state;
+    }
+
+    template <typename T>
+    double GetDifference(const std::vector<T> &a, const std::vector<T> &b) {
+        double difference = 0.0;
+        for (std::size_t i = 0u; i < a.size(); i++)
+            difference = std::max(difference, std::abs(double(a[i]) - double(b[i])));
+        return difference;
+    }
+}  // namespace
+
+int main(int argc, char **argv) {
+    vre::Logger::Initialize();
+
+    const std::size_t   pixelCount = argc > 1 ? std::size_t(std::atoll(argv[1])) : std::size_t(2048u) * 2048u + 1u;
+    const std::uint32_t iterations = argc > 2 ? std::uint32_t(std::atoi(argv[2])) : 10u;
+
+    std::uint32_t state = 42u;
+
+    std::vector<std::uint8_t>  rgb8(pixelCount * 3u);
+    std::vector<std::uint8_t>  rgba8(pixelCount * 4u);
+    std::vector<float>         rgb32f(pixelCount * 3u);
+    std::vector<float>         rgba32f(pixelCount * 4u);
+    std::vector<std::uint16_t> rgba16f(pixelCount * 4u);
+    // Floats cover [-0.1, 1.1] so the clamps are exercised too.
+    for (std::uint8_t &value : rgb8)
+        value = std::uint8_t(Next(state));
+    for (std::uint8_t &value : rgba8)
+        value = std::uint8_t(Next(state));
+    for (float &value : rgb32f)
+        value = float(Next(state) % 12001u) / 10000.0f - 0.1f;
+    for (float &value : rgba32f)
+        value = float(Next(state) % 12001u) / 10000.0f - 0.1f;
+    vre::PixelConversion::SetInstructionSet(InstructionSet::eScalar);
+    vre::PixelConversion::FloatToHalf(rgba32f.data(), rgba16f.data(), rgba16f.size());
+
+    // Every kernel writes into its own output, the scalar run is kept as the reference for the others.
+    struct Outputs {
+        std::vector<std::uint8_t>  ExpandRGB8;
+        std::vector<float>         ExpandRGB32F;
+        std::vector<std::uint8_t>  SwapRedBlue;
+        std::vector<float>         SRGBToLinear;
+        std::vector<std::uint8_t>  LinearToSRGB;
+        std::vector<std::uint8_t>  PremultiplyAlpha;
+        std::vector<std::uint16_t> FloatToHalf;
+        std::vector<float>         HalfToFloat;
+    };
+
+    auto run = [&](InstructionSet instructionSet, Outputs &outputs) {
+        vre::PixelConversion::SetInstructionSet(instructionSet);
+        outputs = Outputs{
+            .ExpandRGB8       = std::vector<std::uint8_t>(pixelCount * 4u),
+            .ExpandRGB32F     = std::vector<float>(pixelCount * 4u),
+            .SwapRedBlue      = std::vector<std::uint8_t>(pixelCount * 4u),
+            .SRGBToLinear     = std::vector<float>(pixelCount * 4u),
+            .LinearToSRGB     = std::vector<std::uint8_t>(pixelCount * 4u),
+            .PremultiplyAlpha = std::vector<std::uint8_t>(pixelCount * 4u),
+            .FloatToHalf      = std::vector<std::uint16_t>(pixelCount * 4u),
+            .HalfToFloat      = std::vector<float>(pixelCount * 4u),
+        };
+
+        return std::vector<std::pair<const char *, double>>{
+            {"ExpandRGBToRGBA (8-bit)", Time(iterations, [&] { vre::PixelConversion::ExpandRGBToRGBA(rgb8.data(), outputs.ExpandRGB8.data(), pixelCount); })},
+            {"ExpandRGBToRGBA (32F)", Time(iterations, [&] { vre::PixelConversion::ExpandRGBToRGBA(rgb32f.data(), outputs.ExpandRGB32F.data(), pixelCount); })},
+            {"SwapRedBlue", Time(iterations, [&] { vre::PixelConversion::SwapRedBlue(rgba8.data(), outputs.SwapRedBlue.data(), pixelCount); })},
+            {"SRGBToLinear", Time(iterations, [&] { vre::PixelConversion::SRGBToLinear(rgba8.data(), outputs.SRGBToLinear.data(), pixelCount); })},
+            {"LinearToSRGB", Time(iterations, [&] { vre::PixelConversion::LinearToSRGB(rgba32f.data(), outputs.LinearToSRGB.data(), pixelCount); })},
+            {"PremultiplyAlpha", Time(iterations, [&] { vre::PixelConversion::PremultiplyAlpha(rgba8.data(), outputs.PremultiplyAlpha.data(), pixelCount); })},
+            {"FloatToHalf", Time(iterations, [&] { vre::PixelConversion::FloatToHalf(rgba32f.data(), outputs.FloatToHalf.data(), pixelCount * 4u); })},
+            {"HalfToFloat", Time(iterations, [&] { vre::PixelConversion::HalfToFloat(rgba16f.data(), outputs.HalfToFloat.data(), pixelCount * 4u); })},
+        };
+    };
+
+    Outputs                                            reference{};
+    const std::vector<std::pair<const char *, double>> scalar = run(InstructionSet::eScalar, reference);
+
+    LOG_INFO("{} pixels, best of {} runs", pixelCount, iterations);
+    for (const auto &[name, milliseconds] : scalar)
+        LOG_INFO("{:<24} {:<7} {:8.3f} ms", name, GetName(InstructionSet::eScalar), milliseconds);
+
+    const InstructionSet supported = vre::PixelConversion::GetSupportedInstructionSet();
+    for (InstructionSet instructionSet : {InstructionSet::eSSE41, InstructionSet::eAVX2}) {
+        if (instructionSet > supported) break;
+
+        Outputs                                            outputs{};
+        const std::vector<std::pair<const char *, double>> timings = run(instructionSet, outputs);
+
+        const std::array<double, 8> differences{
+            GetDifference(outputs.ExpandRGB8, reference.ExpandRGB8),
+            GetDifference(outputs.ExpandRGB32F, reference.ExpandRGB32F),
+            GetDifference(outputs.SwapRedBlue, reference.SwapRedBlue),
+            GetDifference(outputs.SRGBToLinear, reference.SRGBToLinear),
+            GetDifference(outputs.LinearToSRGB, reference.LinearToSRGB),
+            GetDifference(outputs.PremultiplyAlpha, reference.PremultiplyAlpha),
+            GetDifference(outputs.FloatToHalf, reference.FloatToHalf),
+            GetDifference(outputs.HalfToFloat, reference.HalfToFloat),
+        };
+        for (std::size_t i = 0u; i < timings.size(); i++)
+            LOG_INFO("{:<24} {:<7} {:8.3f} ms {:6.2f}x, max difference {:.3g}", timings[i].first, GetName(instructionSet), timings[i].second, scalar[i].second / timings[i].second, differences[i]);
+    }
+
+    vre::PixelConversion::SetInstructionSet(supported);
+    vre::Logger::Shutdown();
+    return 0;
+}
\ No newline at end of file
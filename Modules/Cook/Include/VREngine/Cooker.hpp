@@ -0,0 +1,74 @@
+#pragma once
+
+#include <VREngine/Engine.hpp>
+
+namespace vre {
+    constexpr std::uint32_t COOKER_VERSION = 2u;
+
+    class Cooker {
+       public:
+        struct Settings {
+            fs::path SourceDirectory;
+            fs::path DestinationDirectory;
+            fs::path SlangCompiler{"slangc"};
+            bool     Force{false};
+        };
+
+       public:
+        Cooker(const Settings &settings);
+        ~Cooker() = default;
+
+        bool cook();
+
+       private:
+        enum class Kind {
+            eCopy,
+            eTexture,
+            eScene,
+            eShader,
+            eShaderInclude,
+        };
+
+        struct FileRecord {
+            std::uint64_t Size;
+            std::int64_t  Time;
+            std::uint64_t Hash;
+        };
+
+        struct Entry {
+            std::string              Source;
+            std::uint64_t            Key;
+            std::vector<std::string> Outputs;
+            std::vector<std::string> Dependencies;
+        };
+
+       private:
+        Settings m_Settings;
+
+        std::unordered_map<std::string, FileRecord> m_Files;
+        std::unordered_map<std::string, Entry>      m_Entries;
+        std::mutex                                  m_Mutex;
+
+       private:
+        static Kind GetKind(const fs::path &source);
+
+        void loadManifest();
+        void saveManifest() const;
+
+        std::uint64_t            hashFile(const std::string &source);
+        std::vector<std::string> findDependencies(const std::string &source, Kind kind) const;
+        std::uint64_t            computeKey(const std::string &source, Kind kind, const std::vector<std::string> &dependencies);
+
+        bool isUpToDate(const Entry &entry) const;
+        bool cookEntry(Entry &entry, Kind kind) const;
+
+        bool cookTexture(Entry &entry) const;
+        bool cookScene(Entry &entry) const;
+        bool cookShader(Entry &entry) const;
+        bool cookCopy(Entry &entry) const;
+
+        fs::path getSourcePath(const std::string &source) const;
+        fs::path getDestinationPath(const std::string &output) const;
+        fs::path getManifestPath() const;
+    };
+}  // namespace vre
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include <VREngine/Cooker.hpp>
+
+namespace vre {
+    static std::vector<std::string> Split(const std::string &string, char separator) {
+        std::vector<std::string> parts{};
+        if (string.empty()) return parts;
+
+        std::size_t begin = 0u;
+        while (true) {
+            const std::size_t end = string.find(separator, begin);
+            parts.push_back(string.substr(begin, end - begin));
+            if (end == std::string::npos) break;
+            begin = end + 1u;
+        }
+        return parts;
+    }
+
+    static std::string Join(const std::vector<std::string> &parts, char separator) {
+        std::string string{};
+        for (std::size_t i = 0u; i < parts.size(); i++) {
+            if (i != 0u) string += separator;
+            string += parts[i];
+        }
+        return string;
+    }
+
+    static std::string Trim(const std::string &string) {
+        const std::size_t begin = string.find_first_not_of(" \t\r");
+        if (begin == std::string::npos) return std::string{};
+        const std::size_t end = string.find_last_not_of(" \t\r");
+        return string.substr(begin, end - begin + 1u);
+    }
+
+    Cooker::Cooker(const Settings &settings)
+        : m_Settings{settings} {
+        m_Settings.SourceDirectory      = fs::absolute(m_Settings.SourceDirectory).lexically_normal();
+        m_Settings.DestinationDirectory = fs::absolute(m_Settings.DestinationDirectory).lexically_normal();
+    }
+
+    bool Cooker::cook() {
+        VRE_ASSERT(fs::is_directory(m_Settings.SourceDirectory), "Failed to find a source directory: '{}'", m_Settings.SourceDirectory.string());
+        DVRE_ASSERT(ThreadPool::IsInitialized(), "vre::ThreadPool must be initialized to cook assets");
+
+        fs::create_directories(m_Settings.DestinationDirectory);
+        if (!m_Settings.Force) loadManifest();
+
+        std::vector<std::string> sources{};
+        std::vector<Kind>        kinds{};
+        for (const fs::directory_entry &file : fs::recursive_directory_iterator{m_Settings.SourceDirectory}) {
+            if (!file.is_regular_file()) continue;
+
+            const Kind kind = GetKind(file.path());
+            if (kind == Kind::eShaderInclude) continue;
+
+            sources.push_back(file.path().lexically_relative(m_Settings.SourceDirectory).generic_string());
+            kinds.push_back(kind);
+        }
+
+        std::vector<Entry>        entries(sources.size());
+        std::vector<std::uint8_t> isDirty(sources.size(), 0u);
+        ThreadPool::ParallelFor(sources.size(), [&](std::size_t i) {
+            std::vector<std::string> dependencies = findDependencies(sources[i], kinds[i]);
+            const std::uint64_t      key          = computeKey(sources[i], kinds[i], dependencies);
+
+            auto it = m_Entries.find(sources[i]);
+            if (it != m_Entries.end() && it->second.Key == key && isUpToDate(it->second)) {
+                entries[i] = it->second;
+                return;
+            }
+
+            entries[i] = Entry{
+                .Source       = sources[i],
+                .Key          = key,
+                .Dependencies = std::move(dependencies),
+            };
+            isDirty[i] = 1u;
+        });
+
+        std::vector<std::size_t> dirty{};
+        for (std::size_t i = 0u; i < sources.size(); i++)
+            if (isDirty[i]) dirty.push_back(i);
+
+        std::vector<std::uint8_t> isCooked(dirty.size(), 0u);
+        ThreadPool::ParallelFor(dirty.size(), [&](std::size_t i) {
+            isCooked[i] = cookEntry(entries[dirty[i]], kinds[dirty[i]]) ? 1u : 0u;
+        });
+
+        std::unordered_set<std::string> outputs{};
+        std::unordered_set<std::string> failed{};
+        for (const Entry &entry : entries)
+            outputs.insert(entry.Outputs.begin(), entry.Outputs.end());
+        for (std::size_t i = 0u; i < dirty.size(); i++) {
+            if (isCooked[i]) continue;
+
+            failed.insert(entries[dirty[i]].Source);
+            auto it = m_Entries.find(entries[dirty[i]].Source);
+            if (it != m_Entries.end()) outputs.insert(it->second.Outputs.begin(), it->second.Outputs.end());
+        }
+
+        for (const auto &[source, entry] : m_Entries)
+            for (const std::string &output : entry.Outputs)
+                if (!outputs.contains(output)) {
+                    LOG_INFO("Removing stale cooked asset: '{}'", output);
+                    std::error_code error{};
+                    fs::remove(getDestinationPath(output), error);
+                }
+
+        m_Entries.clear();
+        for (Entry &entry : entries)
+            if (!failed.contains(entry.Source)) m_Entries[entry.Source] = std::move(entry);
+
+        saveManifest();
+
+        LOG_INFO("Cooked {} of {} assets into '{}' ({} up to date, {} failed)",
+                 dirty.size() - failed.size(), sources.size(), m_Settings.DestinationDirectory.string(),
+                 sources.size() - dirty.size(), failed.size());
+        return failed.empty();
+    }
+
+    Cooker::Kind Cooker::GetKind(const fs::path &source) {
+        std::string extension = source.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return char(std::tolower(c)); });
+
+        if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp") return Kind::eTexture;
+        if (extension == ".gltf" || extension == ".glb") return Kind::eScene;
+        if (extension == ".slang") return Kind::eShader;
+        if (extension == ".slangh") return Kind::eShaderInclude;
+        return Kind::eCopy;
+    }
+
+    void Cooker::loadManifest() {
+        std::ifstream ifile{getManifestPath()};
+        if (!ifile.is_open()) return;
+
+        std::string line{};
+        std::getline(ifile, line);
+        if (line != std::format("VRECook {}", COOKER_VERSION)) {
+            LOG_INFO("Ignoring an outdated cook manifest: '{}'", getManifestPath().string());
+            return;
+        }
+
+        while (std::getline(ifile, line)) {
+            const std::vector<std::string> fields = Split(line, '\t');
+            if (fields.size() == 5u && fields[0] == "F") {
+                m_Files[fields[1]] = FileRecord{
+                    .Size = std::stoull(fields[2]),
+                    .Time = std::stoll(fields[3]),
+                    .Hash = std::stoull(fields[4], nullptr, 16),
+                };
+            } else if (fields.size() >= 4u && fields[0] == "E") {
+                m_Entries[fields[1]] = Entry{
+                    .Source       = fields[1],
+                    .Key          = std::stoull(fields[2], nullptr, 16),
+                    .Outputs      = Split(fields[3], ';'),
+                    .Dependencies = fields.size() > 4u ? Split(fields[4], ';') : std::vector<std::string>{},
+                };
+            }
+        }
+    }
+
+    void Cooker::saveManifest() const {
+        std::ofstream ofile{getManifestPath(), std::ios::trunc};
+        VRE_ASSERT(ofile.is_open(), "Failed to write a cook manifest: '{}'", getManifestPath().string());
+
+        ofile << std::format("VRECook {}\n", COOKER_VERSION);
+        for (const auto &[source, record] : m_Files)
+            if (fs::exists(getSourcePath(source)))
+                ofile << std::format("F\t{}\t{}\t{}\t{:016x}\n", source, record.Size, record.Time, record.Hash);
+        for (const auto &[source, entry] : m_Entries)
+            ofile << std::format("E\t{}\t{:016x}\t{}\t{}\n", source, entry.Key, Join(entry.Outputs, ';'), Join(entry.Dependencies, ';'));
+    }
+
+    std::uint64_t Cooker::hashFile(const std::string &source) {
+        const fs::path path = getSourcePath(source);
+
+        std::error_code     error{};
+        const std::uint64_t size = fs::file_size(path, error);
+        if (error) return 0u;
+        const std::int64_t time = std::int64_t(fs::last_write_time(path, error).time_since_epoch().count());
+
+        {
+            std::lock_guard<std::mutex> lock{m_Mutex};
+            auto it = m_Files.find(source);
+            if (it != m_Files.end() && it->second.Size == size && it->second.Time == time) return it->second.Hash;
+        }
+
+        // An unreadable source is not recorded, its entry fails to cook and is retried on the next run.
+        const std::optional<std::uint64_t> hash = Hash::TryFile(path);
+        if (!hash.has_value()) {
+            LOG_ERROR("Failed to read '{}' to hash it", source);
+            return 0u;
+        }
+
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        m_Files[source] = FileRecord{.Size = size, .Time = time, .Hash = hash.value()};
+        return hash.value();
+    }
+
+    std::vector<std::string> Cooker::findDependencies(const std::string &source, Kind kind) const {
+        std::vector<std::string> dependencies{};
+
+        auto addDependency = [&](const fs::path &path) -> bool {
+            const fs::path normal = path.lexically_normal();
+            if (!fs::exists(normal)) return false;
+
+            const std::string dependency = normal.lexically_relative(m_Settings.SourceDirectory).generic_string();
+            if (dependency.empty() || dependency.starts_with("..")) return false;
+            if (std::find(dependencies.begin(), dependencies.end(), dependency) != dependencies.end()) return false;
+
+            dependencies.push_back(dependency);
+            return true;
+        };
+
+        if (kind == Kind::eScene) {
+            const fs::path path      = getSourcePath(source);
+            const fs::path directory = path.parent_path();
+
+            auto data = fastgltf::GltfDataBuffer::FromPath(path);
+            if (data.error() != fastgltf::Error::None) return dependencies;
+
+            fastgltf::Parser parser{fastgltf::Extensions::KHR_mesh_quantization};
+            auto             loaded = parser.loadGltf(data.get(), directory, fastgltf::Options::None);
+            if (loaded.error() != fastgltf::Error::None) return dependencies;
+
+            auto addUri = [&](const auto &dataSource) {
+                std::visit(
+                    [&](const auto &location) {
+                        if constexpr (std::is_same_v<std::decay_t<decltype(location)>, fastgltf::sources::URI>)
+                            if (location.uri.isLocalPath()) addDependency(directory / location.uri.fspath());
+                    },
+                    dataSource);
+            };
+            for (const fastgltf::Buffer &buffer : loaded->buffers)
+                addUri(buffer.data);
+            for (const fastgltf::Image &image : loaded->images)
+                addUri(image.data);
+        } else if (kind == Kind::eShader) {
+            std::vector<fs::path> stack{getSourcePath(source)};
+            while (!stack.empty()) {
+                const fs::path path = stack.back();
+                stack.pop_back();
+
+                std::ifstream ifile{path};
+                std::string   line{};
+                while (std::getline(ifile, line)) {
+                    line = Trim(line);
+
+                    fs::path include{};
+                    if (line.starts_with("#include")) {
+                        const std::size_t begin = line.find('"');
+                        const std::size_t end   = line.find('"', begin + 1u);
+                        if (begin == std::string::npos || end == std::string::npos) continue;
+                        include = line.substr(begin + 1u, end - begin - 1u);
+                    } else if (line.starts_with("import ")) {
+                        std::string module = Trim(line.substr(7u, line.find(';') - 7u));
+                        std::replace(module.begin(), module.end(), '.', '/');
+                        std::replace(module.begin(), module.end(), '_', '-');
+                        include = module + ".slang";
+                    } else {
+                        continue;
+                    }
+
+                    for (const fs::path &directory : {path.parent_path(), getSourcePath(source).parent_path()})
+                        if (addDependency(directory / include)) {
+                            stack.push_back((directory / include).lexically_normal());
+                            break;
+                        }
+                }
+            }
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        return dependencies;
+    }
+
+    std::uint64_t Cooker::computeKey(const std::string &source, Kind kind, const std::vector<std::string> &dependencies) {
+        std::uint64_t key = Hash::Combine(COOKER_VERSION, std::uint64_t(kind));
+        key               = Hash::Combine(key, hashFile(source));
+        if (kind == Kind::eTexture) key = Hash::Combine(key, TextureAsset::COOKED_VERSION);
+        if (kind == Kind::eScene) key = Hash::Combine(key, CookedSceneAsset::VERSION);
+        if (kind == Kind::eShader) key = Hash::Combine(key, Hash::String(m_Settings.SlangCompiler.generic_string()));
+
+        for (const std::string &dependency : dependencies) {
+            key = Hash::Combine(key, Hash::String(dependency));
+            key = Hash::Combine(key, hashFile(dependency));
+        }
+        return key;
+    }
+
+    bool Cooker::isUpToDate(const Entry &entry) const {
+        if (entry.Outputs.empty()) return false;
+        for (const std::string &output : entry.Outputs)
+            if (!fs::exists(getDestinationPath(output))) return false;
+        return true;
+    }
+
+    bool Cooker::cookEntry(Entry &entry, Kind kind) const {
+        fs::create_directories(getDestinationPath(entry.Source).parent_path());
+
+        bool isCooked = false;
+        switch (kind) {
+            case Kind::eTexture:
+                isCooked = cookTexture(entry);
+                break;
+            case Kind::eScene:
+                isCooked = cookScene(entry);
+                break;
+            case Kind::eShader:
+                isCooked = cookShader(entry);
+                break;
+            default:
+                isCooked = cookCopy(entry);
+                break;
+        }
+
+        if (isCooked) LOG_INFO("Cooked '{}' -> '{}'", entry.Source, Join(entry.Outputs, ';'));
+        return isCooked;
+    }
+
+    bool Cooker::cookTexture(Entry &entry) const {
+        const std::string output = fs::path(entry.Source).replace_extension(TextureAsset::COOKED_EXTENSION).generic_string();
+
+        std::optional<TextureAsset> texture = TextureAsset::TryFromPath(getSourcePath(entry.Source), false);
+        if (!texture.has_value()) {
+            LOG_ERROR("Failed to load a texture: '{}'", entry.Source);
+            return false;
+        }
+
+        texture->generateMips();
+        texture->save(getDestinationPath(output));
+        texture->release();
+
+        entry.Outputs = {output};
+        return true;
+    }
+
+    bool Cooker::cookScene(Entry &entry) const {
+        const std::string output = fs::path(entry.Source).replace_extension(CookedSceneAsset::EXTENSION).generic_string();
+
+        std::optional<SceneAsset> scene = SceneAsset::TryFromPath(getSourcePath(entry.Source));
+        if (!scene.has_value()) {
+            LOG_ERROR("Failed to load a scene: '{}'", entry.Source);
+            return false;
+        }
+
+        // Only base color textures hold sRGB colors, normal and metallic-roughness maps are filtered as stored.
+        std::vector<bool> isSRGB(scene->getTextures().size(), false);
+        for (const SceneAsset::Material &material : scene->getMaterials())
+            if (material.BaseColorTexture >= 0 && std::size_t(material.BaseColorTexture) < isSRGB.size()) isSRGB[material.BaseColorTexture] = true;
+
+        for (std::size_t t = 0u; t < scene->getTextures().size(); t++) {
+            TextureAsset &texture = scene->getTextures()[t];
+            if (texture.getData() != nullptr) texture.generateMips(isSRGB[t]);
+        }
+        CookedSceneAsset::Write(getDestinationPath(output), scene.value());
+        scene->release();
+
+        entry.Outputs = {output};
+        return true;
+    }
+
+    bool Cooker::cookShader(Entry &entry) const {
+        const std::string output = fs::path(entry.Source).replace_extension(".spv").generic_string();
+        const fs::path    source = getSourcePath(entry.Source);
+
+        std::string command = std::format(
+            "\"{}\" -fvk-use-entrypoint-name -I \"{}\" \"{}\" -target spirv -o \"{}\"",
+            m_Settings.SlangCompiler.string(), source.parent_path().string(), source.string(), getDestinationPath(output).string());
+#ifdef VRE_PLATFORM_WINDOWS
+        command = "\"" + command + "\"";
+#endif
+
+        if (std::system(command.c_str()) != 0) {
+            LOG_ERROR("Failed to compile a shader: '{}'", entry.Source);
+            std::error_code error{};
+            fs::remove(getDestinationPath(output), error);
+            return false;
+        }
+
+        entry.Outputs = {output};
+        return true;
+    }
+
+    bool Cooker::cookCopy(Entry &entry) const {
+        std::error_code error{};
+        fs::copy_file(getSourcePath(entry.Source), getDestinationPath(entry.Source), fs::copy_options::overwrite_existing, error);
+        if (error) {
+            LOG_ERROR("Failed to copy '{}' with error: '{}'", entry.Source, error.message());
+            return false;
+        }
+
+        entry.Outputs = {entry.Source};
+        return true;
+    }
+
+    fs::path Cooker::getSourcePath(const std::string &source) const {
+        return m_Settings.SourceDirectory / fs::path(source);
+    }
+
+    fs::path Cooker::getDestinationPath(const std::string &output) const {
+        return m_Settings.DestinationDirectory / fs::path(output);
+    }
+
+    fs::path Cooker::getManifestPath() const {
+        return m_Settings.DestinationDirectory / ".vrecook";
+    }
+}  // namespace vre
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include <VREngine/Cooker.hpp>
+
+int main(int argc, char **argv) {
+    vre::Logger::Initialize();
+
+    if (argc < 3) {
+        LOG_ERROR("Usage: VRECook <source directory> <destination directory> [--slangc <path>] [--force]");
+        vre::Logger::Shutdown();
+        return 1;
+    }
+
+    vre::Cooker::Settings settings{
+        .SourceDirectory      = argv[1],
+        .DestinationDirectory = argv[2],
+    };
+    for (int i = 3; i < argc; i++) {
+        const std::string argument = argv[i];
+        if (argument == "--slangc" && i + 1 < argc) {
+            settings.SlangCompiler = argv[++i];
+        } else if (argument == "--force") {
+            settings.Force = true;
+        } else {
+            LOG_WARN("Ignoring an unknown argument: '{}'", argument);
+        }
+    }
+
+    vre::ThreadPool::Initialize();
+
+    bool isCooked = false;
+    try {
+        vre::Cooker cooker{settings};
+        isCooked = cooker.cook();
+    } catch (const std::exception &e) {
+        LOG_FATAL("Exception: '{}'", e.what());
+    } catch (...) {
+        LOG_FATAL("Unkown Exception");
+    }
+
+    vre::ThreadPool::Shutdown();
+    vre::Logger::Shutdown();
+    return isCooked ? 0 : 1;
+}
\ No newline at end of file
@@ -8,10 +8,9 @@
 namespace vre {
     constexpr std::uint32_t FRAME_OVERLAP = 3u;
 
-    struct Vertex {
-        glm::vec3 Position;
-        glm::vec3 Color;
-    };
+    using TriangleVertexFormat = Vulkan::VertexFormat<
+        Vulkan::VertexAttribute::Float3,
+        Vulkan::VertexAttribute::Unorm8x4>;
 
     class DeletionQueue {
        public:
@@ -33,7 +32,8 @@ namespace vre {
         vk::Semaphore RenderSemaphore;
         vk::Fence     RenderFence;
 
-        DeletionQueue DeletionQueue;
+        Vulkan::DescriptorSet::Allocator Descriptors;
+        DeletionQueue                    DeletionQueue;
     };
 
     class Editor {
@@ -41,7 +41,7 @@ namespace vre {
         Editor();
         ~Editor();
 
-        void init();
+        void init(const fs::path &scenePath = {});
         void run();
         void release();
 
@@ -52,6 +52,7 @@ namespace vre {
 
         EventCallbackHandle m_WindowCloseCallbackHandle;
         EventCallbackHandle m_WindowKeyCallbackHandle;
+        EventCallbackHandle m_BufferMovedCallbackHandle;
 
         vk::Device       m_Device;
         vk::SurfaceKHR   m_Surface;
@@ -73,14 +74,17 @@ namespace vre {
         std::array<FrameData, FRAME_OVERLAP> m_Frames;
         std::uint32_t                        m_FrameNumber;
 
-        vk::CommandPool   m_ImmCommandPool;
-        vk::CommandBuffer m_ImmCommandBuffer;
-        vk::Fence         m_ImmFence;
+        Vulkan::GeometryHeap         m_GeometryHeap;
+        Vulkan::DescriptorSet::Cache m_DescriptorCache;
+
+        vk::PipelineLayout            m_TrianglePipelineLayout;
+        vk::Pipeline                  m_TrianglePipeline;
+        Vulkan::GeometryHeap::MeshId  m_TriangleMesh;
+        Vulkan::UploadContext::Ticket m_TriangleUploadTicket;
 
-        vk::PipelineLayout         m_TrianglePipelineLayout;
-        vk::Pipeline               m_TrianglePipeline;
-        Vulkan::Buffer::Allocation m_TriangleIndexBuffer;
-        Vulkan::Buffer::Allocation m_TriangleVertexBuffer;
+        Vulkan::MeshletRenderer m_MeshletRenderer;
+        glm::vec3               m_MeshletCenter;
+        float                   m_MeshletRadius;
 
         DeletionQueue m_MainDeletionQueue;
 
@@ -94,12 +98,14 @@ namespace vre {
 
         void initImGui();
         void initTriangle();
+        void initMeshlets(const fs::path &scenePath);
 
-        void submitImmediately(const std::function<void(const vk::CommandBuffer &cmd)> &function);
+        Vulkan::MeshletRenderer::Camera getMeshletCamera() const;
 
         FrameData &getCurrentFrame();
 
         void closeCallback(const WindowCloseEvent &event);
         void keyCallback(const WindowKeyEvent &event);
+        void bufferMovedCallback(const Vulkan::BufferMovedEvent &event);
     };
 }  // namespace vre
\ No newline at end of file
@@ -8,12 +8,13 @@ namespace vre {
         VRE_ASSERT(!m_IsInitialized, "vre::Editor must be released before closing");
     }
 
-    void Editor::init() {
+    void Editor::init(const fs::path &scenePath) {
         DVRE_ASSERT(!m_IsInitialized, "vre::Editor must be released before initialized");
         DLOG_INFO("Initializing vre::Editor");
 
         m_WindowCloseCallbackHandle = EventObserver::AddCallback<WindowCloseEvent>(this, &Editor::closeCallback);
         m_WindowKeyCallbackHandle   = EventObserver::AddCallback<WindowKeyEvent>(this, &Editor::keyCallback);
+        m_BufferMovedCallbackHandle = EventObserver::AddCallback<Vulkan::BufferMovedEvent>(this, &Editor::bufferMovedCallback);
 
         m_Device           = Vulkan::Context::GetDevice();
         m_Surface          = Vulkan::Context::GetSurface();
@@ -35,6 +36,15 @@ namespace vre {
             frame.SwapchainSemaphore = Vulkan::Semaphore::Create(m_Device);
             frame.RenderSemaphore    = Vulkan::Semaphore::Create(m_Device);
             frame.RenderFence        = Vulkan::Fence::CreateSignaled(m_Device);
+            frame.Descriptors.init(
+                1000u,
+                {
+                    Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eUniformBuffer, 2.0f},
+                    Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageBuffer, 2.0f},
+                    Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eCombinedImageSampler, 4.0f},
+                    Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageImage, 1.0f},
+                },
+                m_Device);
         }
 
         m_MainDeletionQueue.add([this] {
@@ -43,20 +53,28 @@ namespace vre {
                 m_Device.destroy(frame.SwapchainSemaphore);
                 m_Device.destroy(frame.RenderSemaphore);
                 m_Device.destroy(frame.RenderFence);
+                frame.Descriptors.release();
             }
         });
 
-        m_ImmCommandPool   = Vulkan::CommandPool::Create(m_QueueFamilyIndex, m_Device);
-        m_ImmCommandBuffer = Vulkan::CommandBuffer::AllocatePrimary(m_ImmCommandPool, m_Device);
-        m_ImmFence         = Vulkan::Fence::CreateSignaled(m_Device);
+        m_DescriptorCache.init(
+            FRAME_OVERLAP,
+            256u,
+            {
+                Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eUniformBuffer, 2.0f},
+                Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageBuffer, 2.0f},
+                Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eCombinedImageSampler, 4.0f},
+                Vulkan::DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageImage, 1.0f},
+            },
+            m_Device);
 
         m_MainDeletionQueue.add([this] {
-            m_Device.destroy(m_ImmCommandPool);
-            m_Device.destroy(m_ImmFence);
+            m_DescriptorCache.release();
         });
 
         initImGui();
         initTriangle();
+        if (!scenePath.empty()) initMeshlets(scenePath);
 
         m_IsInitialized = true;
     }
@@ -97,19 +115,32 @@ namespace vre {
 
         VRE_VK_CHECK(m_Device.waitIdle());
 
-        m_Device.destroy(m_DrawImageView);
+        Vulkan::ObjectCache::Release(m_DrawImageView);
         Vulkan::Image::Release(m_DrawImage);
 
         m_MainDeletionQueue.flush();
 
         EventObserver::RemoveCallback<WindowCloseEvent>(m_WindowCloseCallbackHandle);
         EventObserver::RemoveCallback<WindowKeyEvent>(m_WindowKeyCallbackHandle);
+        EventObserver::RemoveCallback<Vulkan::BufferMovedEvent>(m_BufferMovedCallbackHandle);
 
         m_IsInitialized = false;
     }
 
     void Editor::renderImGui() {
         ImGui::ShowDemoWindow();
+
+        if (m_MeshletRenderer.getMeshletCount() > 0u) {
+            ImGui::Begin("Meshlets");
+            ImGui::Text("Meshlets: %u", m_MeshletRenderer.getMeshletCount());
+
+            bool useMeshShader = m_MeshletRenderer.getPath() == Vulkan::MeshletRenderer::Path::eMeshShader;
+            ImGui::BeginDisabled(!Vulkan::MeshletRenderer::IsPathSupported(Vulkan::MeshletRenderer::Path::eMeshShader));
+            if (ImGui::Checkbox("Mesh Shader", &useMeshShader))
+                m_MeshletRenderer.setPath(useMeshShader ? Vulkan::MeshletRenderer::Path::eMeshShader : Vulkan::MeshletRenderer::Path::eComputeCull);
+            ImGui::EndDisabled();
+            ImGui::End();
+        }
     }
 
     void Editor::draw() {
@@ -117,6 +148,15 @@ namespace vre {
 
         VRE_VK_CHECK(m_Device.waitForFences(frame.RenderFence, vk::True, 1000000000u));
         frame.DeletionQueue.flush();
+        frame.Descriptors.clear();
+        m_DescriptorCache.update();
+        Vulkan::FrameAllocator::BeginFrame(m_FrameNumber % FRAME_OVERLAP);
+        AssetServer::Commit();
+        Vulkan::UploadContext::Update();
+        Vulkan::TextureResidency::Update();
+        Vulkan::BindlessTable::Update();
+        Vulkan::ObjectCache::Update();
+        m_GeometryHeap.update();
 
         std::uint32_t swapchainImageIndex = 0u;
         {
@@ -139,6 +179,7 @@ namespace vre {
         const vk::CommandBuffer &cmd = frame.MainCommandBuffer;
         cmd.reset();
         Vulkan::CommandBuffer::BeginOneTimeSubmit(cmd);
+        Vulkan::Defragmenter::Update(cmd);
 
         Vulkan::Image::TransitionLayout(
             cmd,
@@ -169,6 +210,7 @@ namespace vre {
             vk::ImageLayout::ePresentSrcKHR);
 
         Vulkan::CommandBuffer::End(cmd);
+        Vulkan::FrameAllocator::EndFrame();
 
         Vulkan::Queue::Submit(
             {Vulkan::CommandBuffer::GetSubmitInfo(cmd)},
@@ -210,6 +252,10 @@ namespace vre {
             m_SwapchainExtent,
         };
 
+        const std::uint32_t frameIndex   = m_FrameNumber % FRAME_OVERLAP;
+        const bool          drawMeshlets = m_MeshletRenderer.isReady();
+        if (drawMeshlets) m_MeshletRenderer.cull(cmd, frameIndex, getMeshletCamera());
+
         Vulkan::RenderPass::BeginRendering(
             cmd,
             m_SwapchainExtent,
@@ -220,10 +266,14 @@ namespace vre {
         cmd.setViewport(0, {viewport});
         cmd.setScissor(0, {scissor});
 
-        cmd.bindPipeline(vk::PipelineBindPoint::eGraphics, m_TrianglePipeline);
-        cmd.bindIndexBuffer(m_TriangleIndexBuffer.Buffer, 0U, vk::IndexType::eUint32);
-        cmd.bindVertexBuffers(0u, {m_TriangleVertexBuffer.Buffer}, {0U});
-        cmd.drawIndexed(3u, 1u, 0u, 0u, 0u);
+        if (drawMeshlets) {
+            m_MeshletRenderer.draw(cmd, frameIndex);
+        } else if (Vulkan::UploadContext::IsComplete(m_TriangleUploadTicket)) {
+            cmd.bindPipeline(vk::PipelineBindPoint::eGraphics, m_TrianglePipeline);
+            m_GeometryHeap.bind(cmd);
+            Vulkan::VertexPulling::Push(cmd, m_TrianglePipelineLayout, {.Vertices = m_GeometryHeap.getVertexBuffer().Address});
+            m_GeometryHeap.draw(cmd, m_TriangleMesh);
+        }
 
         Vulkan::RenderPass::EndRendering(cmd);
     }
@@ -253,7 +303,7 @@ namespace vre {
         m_SwapchainImageViews = Vulkan::Context::GetSwapchainImageViews();
 
         if (m_DrawImage.Image) {
-            m_Device.destroy(m_DrawImageView);
+            Vulkan::ObjectCache::Release(m_DrawImageView);
             Vulkan::Image::Release(m_DrawImage);
         }
 
@@ -263,26 +313,15 @@ namespace vre {
             vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eTransferDst,
             m_SwapchainExtent,
             m_VmaAllocator);
-        m_DrawImageView = Vulkan::Image::CreateColorView(m_DrawImage, m_Device);
+        m_DrawImageView = Vulkan::ObjectCache::AcquireImageView(Vulkan::Image::GetColorViewCreateInfo(m_DrawImage));
     }
 
     void Editor::initImGui() {
+        // The backend only allocates one combined image sampler per texture it draws.
         vk::DescriptorPool imGuiPool =
             Vulkan::DescriptorPool::CreateFreeDescriptorSets(
-                1000,
-                {
-                    vk::DescriptorPoolSize{vk::DescriptorType::eSampler, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eCombinedImageSampler, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eSampledImage, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eStorageImage, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eUniformTexelBuffer, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eStorageTexelBuffer, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eUniformBuffer, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eStorageBuffer, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eUniformBufferDynamic, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eStorageBufferDynamic, 1000u},
-                    vk::DescriptorPoolSize{vk::DescriptorType::eInputAttachment, 1000u},
-                },
+                256u,
+                {vk::DescriptorPoolSize{vk::DescriptorType::eCombinedImageSampler, 256u}},
                 m_Device);
 
         IMGUI_CHECKVERSION();
@@ -326,15 +365,13 @@ namespace vre {
     }
 
     void Editor::initTriangle() {
-        std::vector<std::uint32_t> triangleIndices{0u, 1u, 2u};
-        std::vector<Vertex>        triangleVertices{
-            Vertex{glm::vec3{-0.5f, -0.5f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}},
-            Vertex{glm::vec3{0.0f, 0.5f, 0.0f}, glm::vec3{0.0f, 1.0f, 0.0f}},
-            Vertex{glm::vec3{0.5f, -0.5f, 0.0f}, glm::vec3{0.0f, 0.0f, 1.0f}},
+        std::vector<TriangleVertexFormat::Vertex> triangleVertices{
+            TriangleVertexFormat::Pack(glm::vec3{-0.5f, -0.5f, 0.0f}, glm::vec4{1.0f, 0.0f, 0.0f, 1.0f}),
+            TriangleVertexFormat::Pack(glm::vec3{0.0f, 0.5f, 0.0f}, glm::vec4{0.0f, 1.0f, 0.0f, 1.0f}),
+            TriangleVertexFormat::Pack(glm::vec3{0.5f, -0.5f, 0.0f}, glm::vec4{0.0f, 0.0f, 1.0f, 1.0f}),
         };
 
-        std::uint64_t triangleIndicesSize  = sizeof(std::uint32_t) * triangleIndices.size();
-        std::uint64_t triangleVerticesSize = sizeof(Vertex) * triangleVertices.size();
+        std::vector<std::uint32_t> triangleIndices{0u, 1u, 2u};
 
         FileAsset shaderSource = FileAsset::FromPathBinary(
             fs::path("Assets") /
@@ -342,22 +379,11 @@ namespace vre {
             fs::path("Triangle.spv"));
         vk::ShaderModule shaderModule = Vulkan::Shader::CreateSPV(shaderSource, m_Device);
 
-        m_TrianglePipelineLayout = Vulkan::PipelineLayout::Create({}, m_Device);
+        m_TrianglePipelineLayout = Vulkan::ObjectCache::AcquirePipelineLayout({}, {Vulkan::VertexPulling::GetPushConstantRange()});
         m_TrianglePipeline =
             Vulkan::GraphicsPipeline::Builder{}
                 .setVertexShader("vsmain", shaderModule)
                 .setFragmentShader("fsmain", shaderModule)
-                .setVertexLayout(Vulkan::VertexLayout{
-                    vk::VertexInputBindingDescription{
-                        0u,
-                        sizeof(Vertex),
-                        vk::VertexInputRate::eVertex,
-                    },
-                    {
-                        vk::VertexInputAttributeDescription{0u, 0u, vk::Format::eR32G32B32Sfloat, offsetof(Vertex, Position)},
-                        vk::VertexInputAttributeDescription{1u, 0u, vk::Format::eR32G32B32Sfloat, offsetof(Vertex, Color)},
-                    },
-                })
                 .setInputTopology(vk::PrimitiveTopology::eTriangleList)
                 .setPolygonMode(vk::PolygonMode::eFill)
                 .setCullMode(vk::CullModeFlagBits::eNone, vk::FrontFace::eClockwise)
@@ -369,57 +395,69 @@ namespace vre {
 
         m_Device.destroy(shaderModule);
 
-        m_TriangleIndexBuffer = Vulkan::Buffer::Allocate(
-            VMA_MEMORY_USAGE_GPU_ONLY,
-            triangleIndicesSize,
-            vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eTransferDst,
-            m_VmaAllocator);
-        m_TriangleVertexBuffer = Vulkan::Buffer::Allocate(
-            VMA_MEMORY_USAGE_GPU_ONLY,
-            triangleVerticesSize,
-            vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferDst,
-            m_VmaAllocator);
-
-        Vulkan::Buffer::Allocation staging = Vulkan::Buffer::AllocateMapped(
-            VMA_MEMORY_USAGE_CPU_ONLY,
-            triangleIndicesSize + triangleVerticesSize,
-            vk::BufferUsageFlagBits::eTransferSrc,
-            m_VmaAllocator);
-
-        VmaAllocationInfo stagingAllocationInfo{};
-        vmaGetAllocationInfo(staging.Allocator, staging.Allocation, &stagingAllocationInfo);
-        void *data = stagingAllocationInfo.pMappedData;
-
-        std::memcpy(data, triangleIndices.data(), triangleIndicesSize);
-        std::memcpy((char *)data + triangleIndicesSize, triangleVertices.data(), triangleVerticesSize);
-
-        submitImmediately([&, this](const vk::CommandBuffer &cmd) {
-            Vulkan::CommandBuffer::CopyBufferToBuffer(cmd, staging, m_TriangleIndexBuffer, triangleIndicesSize);
-            Vulkan::CommandBuffer::CopyBufferToBuffer(cmd, staging, m_TriangleVertexBuffer, triangleIndicesSize, 0U, triangleVerticesSize);
+        m_GeometryHeap = Vulkan::GeometryHeap::Create({
+            .VertexStride   = std::uint32_t(sizeof(TriangleVertexFormat::Vertex)),
+            .FramesInFlight = FRAME_OVERLAP,
         });
 
-        Vulkan::Buffer::Release(staging);
+        m_TriangleMesh = m_GeometryHeap.allocate(std::uint32_t(triangleVertices.size()), std::uint32_t(triangleIndices.size()));
+        m_GeometryHeap.upload(m_TriangleMesh, triangleVertices.data(), triangleIndices.data());
+        m_TriangleUploadTicket = Vulkan::UploadContext::Flush();
 
         m_MainDeletionQueue.add([this] {
-            m_Device.destroy(m_TrianglePipelineLayout);
+            Vulkan::ObjectCache::Release(m_TrianglePipelineLayout);
             m_Device.destroy(m_TrianglePipeline);
-            Vulkan::Buffer::Release(m_TriangleIndexBuffer);
-            Vulkan::Buffer::Release(m_TriangleVertexBuffer);
+            m_GeometryHeap.release();
         });
     }
 
-    void Editor::submitImmediately(const std::function<void(const vk::CommandBuffer &cmd)> &function) {
-        m_Device.resetFences({m_ImmFence});
-        m_Device.resetCommandPool(m_ImmCommandPool);
+    void Editor::initMeshlets(const fs::path &scenePath) {
+        std::optional<SceneAsset> scene = SceneAsset::TryFromPath(scenePath);
+        if (!scene.has_value() || scene->getMeshes().empty() || scene->getMeshes().front().getMeshlets().empty()) {
+            LOG_WARN("No meshlets to draw in '{}'", scenePath.string());
+            return;
+        }
+
+        const MeshAsset &mesh = scene->getMeshes().front();
 
-        const vk::CommandBuffer &cmd = m_ImmCommandBuffer;
+        glm::vec3 min{std::numeric_limits<float>::max()};
+        glm::vec3 max{std::numeric_limits<float>::lowest()};
+        for (const MeshAsset::Vertex &vertex : mesh.getVertices()) {
+            min = glm::min(min, vertex.Position);
+            max = glm::max(max, vertex.Position);
+        }
+        m_MeshletCenter = (min + max) * 0.5f;
+        m_MeshletRadius = std::max(glm::length(max - min) * 0.5f, 0.001f);
 
-        Vulkan::CommandBuffer::BeginOneTimeSubmit(cmd);
-        function(cmd);
-        Vulkan::CommandBuffer::End(cmd);
+        m_MeshletRenderer = Vulkan::MeshletRenderer::Create(
+            {
+                .ColorFormat    = m_SwapchainFormat,
+                .FramesInFlight = FRAME_OVERLAP,
+            },
+            mesh);
 
-        Vulkan::Queue::Submit({Vulkan::CommandBuffer::GetSubmitInfo(cmd)}, m_ImmFence, m_GraphicsQueue);
-        DVRE_VK_CHECK(m_Device.waitForFences({m_ImmFence}, vk::True, 1000000000U));
+        scene->release();
+
+        m_MainDeletionQueue.add([this] {
+            m_MeshletRenderer.release();
+        });
+    }
+
+    Vulkan::MeshletRenderer::Camera Editor::getMeshletCamera() const {
+        // The viewport is flipped in drawGeometry(), so the projection does not flip Y itself.
+        const glm::vec3 position   = m_MeshletCenter + glm::vec3{0.0f, 0.0f, m_MeshletRadius * 2.5f};
+        const glm::mat4 view       = glm::lookAt(position, m_MeshletCenter, glm::vec3{0.0f, 1.0f, 0.0f});
+        const glm::mat4 projection = glm::perspective(
+            glm::radians(60.0f),
+            float(m_SwapchainExtent.width) / float(m_SwapchainExtent.height),
+            m_MeshletRadius * 0.01f,
+            m_MeshletRadius * 10.0f);
+
+        return {
+            .ViewProjection = projection * view,
+            .Model          = glm::mat4{1.0f},
+            .Position       = position,
+        };
     }
 
     FrameData &Editor::getCurrentFrame() {
@@ -446,6 +484,10 @@ namespace vre {
         }
     }
 
+    void Editor::bufferMovedCallback(const Vulkan::BufferMovedEvent &event) {
+        m_GeometryHeap.onBufferMoved(event);
+    }
+
     void DeletionQueue::add(const std::function<void()> &deletor) {
         m_Deletors.push_back(deletor);
     }
@@ -2,7 +2,10 @@
 
 int main(int argc, char **argv) {
     vre::Logger::Initialize();
+    vre::ThreadPool::Initialize();
     vre::AssetServer::Initialize();
+    vre::AssetIO::Initialize();
+    vre::AssetPrefetcher::Initialize();
     vre::EventObserver::Initialize();
     vre::Window::Initialize({
         .Title = "Vulkan Render Engine Editor",
@@ -13,11 +16,27 @@ int main(int argc, char **argv) {
             vk::PresentModeKHR::eImmediate,
         },
     });
+    vre::Vulkan::ObjectCache::Initialize({
+        .FramesInFlight = vre::FRAME_OVERLAP,
+    });
+    vre::Vulkan::BindlessTable::Initialize({
+        .FramesInFlight = vre::FRAME_OVERLAP,
+    });
+    vre::Vulkan::UploadContext::Initialize();
+    vre::Vulkan::FrameAllocator::Initialize({
+        .FramesInFlight = vre::FRAME_OVERLAP,
+    });
+    vre::Vulkan::TextureResidency::Initialize({
+        .FramesInFlight = vre::FRAME_OVERLAP,
+    });
+    vre::Vulkan::Defragmenter::Initialize({
+        .FramesInFlight = vre::FRAME_OVERLAP,
+    });
 
     vre::Editor editor{};
 
     try {
-        editor.init();
+        editor.init(argc > 1 ? fs::path(argv[1]) : fs::path{});
         editor.run();
         editor.release();
     } catch (const std::exception &e) {
@@ -26,10 +45,19 @@ int main(int argc, char **argv) {
         LOG_FATAL("Unkown Exception");
     }
 
+    vre::Vulkan::Defragmenter::Shutdown();
+    vre::Vulkan::TextureResidency::Shutdown();
+    vre::Vulkan::FrameAllocator::Shutdown();
+    vre::Vulkan::UploadContext::Shutdown();
+    vre::Vulkan::BindlessTable::Shutdown();
+    vre::Vulkan::ObjectCache::Shutdown();
     vre::Vulkan::Context::Shutdown();
     vre::Window::Shutdown();
     vre::EventObserver::Shutdown();
+    vre::AssetPrefetcher::Shutdown();
+    vre::AssetIO::Shutdown();
     vre::AssetServer::Shutdown();
+    vre::ThreadPool::Shutdown();
     vre::Logger::Shutdown();
     return 0;
 }
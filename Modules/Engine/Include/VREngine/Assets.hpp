@@ -2,5 +2,13 @@
 
 #include <VREngine/Assets/AssetServer.hpp>
 #include <VREngine/Assets/AssetHandle.hpp>
+#include <VREngine/Assets/AssetIO.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
 #include <VREngine/Assets/FileAsset.hpp>
-#include <VREngine/Assets/TextureAsset.hpp>
\ No newline at end of file
+#include <VREngine/Assets/TextureAsset.hpp>
+#include <VREngine/Assets/PixelConversion.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+#include <VREngine/Assets/MeshOptimizer.hpp>
+#include <VREngine/Assets/MeshletBuilder.hpp>
+#include <VREngine/Assets/SceneAsset.hpp>
+#include <VREngine/Assets/CookedSceneAsset.hpp>
\ No newline at end of file
@@ -51,7 +51,7 @@ namespace vre {
 
        private:
         Asset       m_Data;
-        std::size_t m_Index;
+        std::size_t m_Index{0u};
 
        private:
         AssetHandle(const Asset &asset, std::size_t index)
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+
+namespace vre {
+    class AssetIO {
+       public:
+        enum class Backend : std::uint8_t {
+            eThreadPool,
+            eIoUring,
+        };
+
+        struct Settings {
+            Backend       PreferredBackend{Backend::eIoUring};
+            std::uint32_t QueueDepth{256u};
+            std::uint64_t ChunkSize{1u << 20};
+            bool          EnableDirectIO{false};
+            std::uint64_t DirectIOThreshold{64u << 20};
+        };
+
+        struct Request {
+            fs::path      Path;
+            std::uint64_t Offset{0u};
+            std::uint64_t Size{0u};
+            void         *Destination{nullptr};
+        };
+
+        using Callback = std::function<void(bool success)>;
+
+        static constexpr std::uint64_t DIRECT_IO_ALIGNMENT = 4096u;
+        static constexpr std::uint32_t INVALID_BUFFER      = std::numeric_limits<std::uint32_t>::max();
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        static Backend GetBackend();
+
+        static std::uint32_t RegisterBuffer(void *data, std::size_t size);
+        static void          UnregisterBuffers();
+
+        // Callbacks run on the I/O thread with the io_uring backend and on a worker with the thread pool.
+        static void                                Read(const Request &request, Callback &&callback);
+        static std::future<bool>                   Read(const Request &request);
+        static std::vector<std::future<bool>>      Read(std::span<const Request> requests);
+        static std::future<std::vector<std::byte>> ReadFile(const fs::path &path);
+
+       private:
+        struct Operation {
+            int                        File{-1};
+            int                        DirectFile{-1};
+            std::atomic<std::uint32_t> Remaining{0u};
+            std::atomic<bool>          IsFailed{false};
+            Callback                   OnComplete;
+        };
+
+        struct Chunk {
+            Operation    *Owner;
+            std::byte    *Destination;
+            std::uint64_t Offset;
+            std::uint32_t Size;
+            std::uint32_t Buffer;
+            bool          IsDirect;
+        };
+
+        struct RegisteredBuffer {
+            std::byte  *Data;
+            std::size_t Size;
+        };
+
+       private:
+        static Settings                      g_Settings;
+        static Backend                       g_Backend;
+        static std::vector<RegisteredBuffer> g_Buffers;
+        static std::mutex                    g_Mutex;
+        static std::deque<Chunk *>           g_Backlog;
+        static std::uint32_t                 g_InFlight;
+        static std::thread                   g_Reaper;
+        static void                         *g_Ring;
+
+        static bool    g_IsInitialized;
+        static AssetIO g_State;
+
+       private:
+        AssetIO() = default;
+        ~AssetIO();
+
+        static bool ReadBlocking(const Request &request);
+
+        static bool          InitializeRing();
+        static void          ShutdownRing();
+        static bool          RegisterRingBuffers();
+        static void          SubmitRing(const Request &request, Callback &&callback);
+        static void          Enqueue(std::span<Chunk *const> chunks);
+        static void          SubmitBacklog();
+        static void          ReapLoop();
+        static void          Complete(Chunk *chunk, std::int32_t result);
+        static void          Finish(Operation *operation);
+        static std::uint32_t FindBuffer(const std::byte *data, std::uint64_t size);
+    };
+}  // namespace vre
\ No newline at end of file
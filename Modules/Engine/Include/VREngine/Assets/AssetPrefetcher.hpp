@@ -0,0 +1,59 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+
+namespace vre {
+    class AssetPrefetcher {
+       public:
+        struct Settings {
+            fs::path      ManifestPath{"AssetAccess.manifest"};
+            bool          EnableRecording{true};
+            bool          EnablePrefetch{true};
+            std::uint32_t MaxEntries{4096u};
+            std::uint64_t MaxPrefetchBytes{std::uint64_t(1u) << 30};
+        };
+
+        struct Access {
+            std::string   Path;
+            std::uint64_t Time;
+            std::uint64_t Size;
+        };
+
+        static constexpr std::uint32_t MANIFEST_VERSION = 1u;
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        static void RecordAccess(const fs::path &path);
+        static void Save();
+
+        static std::vector<Access> GetAccesses();
+        static std::size_t         GetPrefetchedCount();
+
+       private:
+        static Settings                              g_Settings;
+        static std::chrono::steady_clock::time_point g_Start;
+        static std::vector<Access>                   g_Accesses;
+        static std::unordered_set<std::string>       g_Recorded;
+        static std::mutex                            g_Mutex;
+        static std::future<void>                     g_Prefetch;
+        static std::atomic<bool>                     g_IsRecording;
+        static std::atomic<bool>                     g_IsCancelled;
+        static std::atomic<std::size_t>              g_PrefetchedCount;
+
+        static bool            g_IsInitialized;
+        static AssetPrefetcher g_State;
+
+       private:
+        AssetPrefetcher() = default;
+        ~AssetPrefetcher();
+
+        static std::vector<Access> Load();
+        static void                Prefetch(const std::vector<Access> &accesses);
+        static bool                PrefetchFile(const fs::path &path, std::uint64_t size);
+    };
+}  // namespace vre
\ No newline at end of file
@@ -12,78 +12,83 @@ namespace vre {
 
         static bool IsInitialized();
 
+        static void Commit();
+
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static AssetHandle<Asset> Add(const Asset &asset) {
             DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
             AssetVector<Asset> &assets = getAssetVector<Asset>();
-            std::size_t         index  = assets.add(asset);
-            return AssetHandle{asset, index};
+            const std::size_t   index  = g_NextIndex.fetch_add(1u, std::memory_order_relaxed);
+            assets.add(index, Asset{asset});
+            return AssetHandle<Asset>{asset, index};
         }
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Set(const AssetHandle<Asset> &asset) {
-            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
-            AssetVector<Asset> &assets = getAssetVector<Asset>();
-            if (!assets.contains(asset.m_Index)) {
-                DVRE_WARN("vre::AssetHandle<{}> with index {} is not added to vre::AssetServer", typeid(Asset).name(), asset.m_Index);
-                return false;
-            }
-            assets[asset.m_Index] = asset.m_Data;
-            return true;
+            return Set<Asset>(asset.m_Index, asset.m_Data);
         }
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Set(std::size_t index, const Asset &asset) {
             DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
             AssetVector<Asset> &assets = getAssetVector<Asset>();
-            if (!assets.contains(index)) {
+            if (!assets.set(index, Asset{asset})) {
                 DVRE_WARN("vre::AssetHandle<{}> with index {} is not added to vre::AssetServer", typeid(Asset).name(), index);
                 return false;
             }
-            assets[index] = asset;
             return true;
         }
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Release(AssetHandle<Asset> &asset) {
-            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
-            std::size_t index          = asset.m_Index;
-            asset.m_Index              = 0;
-            AssetVector<Asset> &assets = getAssetVector<Asset>();
-            if (!assets.contains(index)) {
-                return false;
-            }
-            assets.remove(index);
-            return true;
+            const std::size_t index = asset.m_Index;
+            asset.m_Index           = 0;
+            return Release<Asset>(index);
         }
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Release(std::size_t index) {
             DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
-            AssetVector<Asset> &assets = getAssetVector<Asset>();
-            if (!assets.contains(index)) {
-                return false;
-            }
-            assets.remove(index);
-            return true;
+            return getAssetVector<Asset>().remove(index);
         }
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Contains(AssetHandle<Asset> &asset) {
-            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
-            AssetVector<Asset> &assets = getAssetVector<Asset>();
-            if (!assets.contains(asset.m_Index)) {
-                asset.m_Index = 0;
-                return false;
-            }
-            return true;
+            if (Contains<Asset>(asset.m_Index)) return true;
+
+            // Only the slow path takes the writer mutex, a handle added since the last Commit() keeps its index.
+            if (!IsKnown<Asset>(asset.m_Index)) asset.m_Index = 0;
+            return false;
         }
 
+        // Answers from the committed snapshot only and never waits on writers, an index added or released since the last
+        // Commit() keeps its committed state until the next one. IsKnown() also sees the pending writes.
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         static bool Contains(std::size_t index) {
             DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
-            AssetVector<Asset> &assets = getAssetVector<Asset>();
-            return assets.contains(index);
+            EpochReclaimer::Guard guard = g_Reclaimer.pin();
+            return getAssetVector<Asset>().containsCommitted(index);
+        }
+
+        template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
+        static bool IsKnown(std::size_t index) {
+            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
+            EpochReclaimer::Guard guard = g_Reclaimer.pin();
+            return getAssetVector<Asset>().contains(index);
+        }
+
+        template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
+        static std::shared_ptr<const Asset> Get(std::size_t index) {
+            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
+            EpochReclaimer::Guard guard = g_Reclaimer.pin();
+            return getAssetVector<Asset>().get(index);
+        }
+
+        template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
+        static std::size_t Count() {
+            DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
+            EpochReclaimer::Guard guard = g_Reclaimer.pin();
+            return getAssetVector<Asset>().size();
         }
 
        private:
@@ -96,117 +101,225 @@ namespace vre {
         class IAssetVector {
            public:
             virtual ~IAssetVector() = default;
+            virtual void commit()   = 0;
             virtual void clear()    = 0;
         };
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
         class AssetVector : public IAssetVector {
            public:
-            AssetVector()  = default;
-            ~AssetVector() = default;
+            AssetVector()
+                : m_Snapshot{new Snapshot{}} {}
+            ~AssetVector() {
+                const Snapshot *snapshot = m_Snapshot.load(std::memory_order_relaxed);
+                for (const Shard *shard : snapshot->Shards)
+                    delete shard;
+                delete snapshot;
+            }
 
             void add(std::size_t index, Asset &&data) {
-                if (m_LookUp.find(index) != m_LookUp.end()) {
-                    DVRE_WARN("vre::AssetHandle<{}> already exists with Index: {}", typeid(Asset).name(), index);
-                    return;
-                }
-
-                m_LookUp[index] = m_Data.size();
-                m_Data.emplace_back(std::forward<Asset>(data));
-                m_Indices.emplace_back(index);
+                std::lock_guard<std::mutex> lock{m_Mutex};
+                m_Pending.push_back(Write{WriteType::eAdd, index, Share(std::move(data))});
+                m_PendingTypes[index] = PendingType{WriteType::eAdd, m_Generation};
             }
 
-            void set(std::size_t index, Asset &&data) {
-                auto it = m_LookUp.find(index);
-                if (it != m_LookUp.end()) {
-                    m_Data[it->second] = std::forward<Asset>(data);
-                    return;
-                }
+            bool set(std::size_t index, Asset &&data) {
+                std::lock_guard<std::mutex> lock{m_Mutex};
+                if (!isKnown(index)) return false;
+                m_Pending.push_back(Write{WriteType::eSet, index, Share(std::move(data))});
+                m_PendingTypes[index] = PendingType{WriteType::eSet, m_Generation};
+                return true;
+            }
 
-                m_LookUp[index] = m_Data.size();
-                m_Data.emplace_back(std::forward<Asset>(data));
-                m_Indices.emplace_back(index);
+            bool remove(std::size_t index) {
+                std::lock_guard<std::mutex> lock{m_Mutex};
+                if (!isKnown(index)) return false;
+                m_Pending.push_back(Write{WriteType::eRemove, index, nullptr});
+                m_PendingTypes[index] = PendingType{WriteType::eRemove, m_Generation};
+                return true;
             }
 
-            void remove(std::size_t index) {
-                auto it = m_LookUp.find(index);
-                if (it == m_LookUp.end()) return;
+            virtual void commit() override {
+                // The pending types of this batch are kept until its snapshot is published, otherwise an index added in this
+                // batch would be neither pending nor committed for a moment and Set(), Release() and IsKnown() would miss it.
+                std::vector<Write> pending{};
+                std::uint64_t      generation = 0u;
+                {
+                    std::lock_guard<std::mutex> lock{m_Mutex};
+                    pending.swap(m_Pending);
+                    generation = m_Generation++;
+                }
+                if (pending.empty()) return;
+
+                // Only the shards touched by this commit are copied, the new snapshot shares every other shard with the old one.
+                const Snapshot *current  = m_Snapshot.load(std::memory_order_acquire);
+                Snapshot       *snapshot = new Snapshot{*current};
+
+                std::array<Shard *, SHARD_COUNT> copies{};
+                for (Write &write : pending) {
+                    const std::size_t s     = write.Index % SHARD_COUNT;
+                    Shard            *shard = copies[s];
+                    if (shard == nullptr) {
+                        shard               = current->Shards[s] != nullptr ? new Shard{*current->Shards[s]} : new Shard{};
+                        copies[s]           = shard;
+                        snapshot->Shards[s] = shard;
+                    }
+
+                    switch (write.Type) {
+                        case WriteType::eAdd:
+                            if (!shard->Assets.emplace(write.Index, std::move(write.Data)).second)
+                                DVRE_WARN("vre::AssetHandle<{}> already exists with Index: {}", typeid(Asset).name(), write.Index);
+                            break;
+                        case WriteType::eSet:
+                            shard->Assets[write.Index] = std::move(write.Data);
+                            break;
+                        case WriteType::eRemove:
+                            shard->Assets.erase(write.Index);
+                            break;
+                    }
+                }
+
+                std::vector<const Shard *> replaced{};
+                for (std::size_t s = 0u; s < SHARD_COUNT; s++) {
+                    if (copies[s] == nullptr) continue;
 
-                const std::size_t i     = it->second;
-                const std::size_t lastI = m_Data.size() - 1;
-                if (i != lastI) {
-                    m_Data[i]              = std::move(m_Data.back());
-                    m_Indices[i]           = std::move(m_Indices.back());
-                    m_LookUp[m_Indices[i]] = i;
+                    if (current->Shards[s] != nullptr) {
+                        snapshot->Size -= current->Shards[s]->Assets.size();
+                        replaced.push_back(current->Shards[s]);
+                    }
+                    snapshot->Size += copies[s]->Assets.size();
                 }
+                publish(snapshot, std::move(replaced));
 
-                m_Data[m_Data.size() - 1].release();
-                m_LookUp.erase(index);
-                m_Data.pop_back();
-                m_Indices.pop_back();
+                std::lock_guard<std::mutex> lock{m_Mutex};
+                std::erase_if(m_PendingTypes, [generation](const auto &entry) { return entry.second.Generation <= generation; });
             }
 
             virtual void clear() override {
-                for (Asset &asset : m_Data) {
-                    asset.release();
+                {
+                    std::lock_guard<std::mutex> lock{m_Mutex};
+                    m_Pending.clear();
+                    m_PendingTypes.clear();
                 }
-                m_Data.clear();
-                m_LookUp.clear();
-                m_Indices.clear();
+
+                const Snapshot            *current = m_Snapshot.load(std::memory_order_acquire);
+                std::vector<const Shard *> replaced{};
+                for (const Shard *shard : current->Shards)
+                    if (shard != nullptr) replaced.push_back(shard);
+                publish(new Snapshot{}, std::move(replaced));
             }
 
-            bool contains(std::size_t index) const {
-                return m_LookUp.find(index) != m_LookUp.end();
+            bool contains(std::size_t index) {
+                if (containsCommitted(index)) return true;
+
+                std::lock_guard<std::mutex> lock{m_Mutex};
+                return isKnown(index);
             }
 
-            Asset &operator[](std::size_t index) {
-                auto it = m_LookUp.find(index);
-                if (it == m_LookUp.end()) {
-                    throw std::out_of_range("Index not found in SparseVector");
-                }
-                return m_Data[it->second];
+            bool containsCommitted(std::size_t index) const {
+                const Shard *shard = m_Snapshot.load(std::memory_order_seq_cst)->Shards[index % SHARD_COUNT];
+                return shard != nullptr && shard->Assets.contains(index);
             }
 
-            const Asset &operator[](std::size_t index) const {
-                auto it = m_LookUp.find(index);
-                if (it == m_LookUp.end()) {
-                    throw std::out_of_range("Index not found in SparseVector");
-                }
-                return m_Data[it->second];
+            std::shared_ptr<const Asset> get(std::size_t index) const {
+                const Shard *shard = m_Snapshot.load(std::memory_order_seq_cst)->Shards[index % SHARD_COUNT];
+                if (shard == nullptr) return nullptr;
+
+                auto it = shard->Assets.find(index);
+                return it != shard->Assets.end() ? it->second : nullptr;
             }
 
             std::size_t size() const {
-                return m_Data.size();
+                return m_Snapshot.load(std::memory_order_seq_cst)->Size;
             }
 
            private:
-            std::vector<Asset>                 m_Data;
-            std::vector<std::size_t>           m_Indices;
-            std::map<std::size_t, std::size_t> m_LookUp;
+            enum class WriteType : std::uint8_t {
+                eAdd,
+                eSet,
+                eRemove,
+            };
+
+            struct Write {
+                WriteType              Type;
+                std::size_t            Index;
+                std::shared_ptr<Asset> Data;
+            };
+
+            struct PendingType {
+                WriteType     Type;
+                std::uint64_t Generation;
+            };
+
+            // Indices are handed out sequentially, so the low bits spread them evenly over the shards.
+            static constexpr std::size_t SHARD_COUNT = 64u;
+
+            struct Shard {
+                std::unordered_map<std::size_t, std::shared_ptr<Asset>> Assets;
+            };
+
+            struct Snapshot {
+                std::array<const Shard *, SHARD_COUNT> Shards{};
+                std::size_t                            Size{0u};
+            };
+
+           private:
+            std::atomic<const Snapshot *>                m_Snapshot;
+            std::mutex                                   m_Mutex;
+            std::vector<Write>                           m_Pending;
+            std::unordered_map<std::size_t, PendingType> m_PendingTypes;
+            std::uint64_t                                m_Generation{0u};
+
+           private:
+            static std::shared_ptr<Asset> Share(Asset &&data) {
+                return std::shared_ptr<Asset>(new Asset{std::move(data)}, [](Asset *asset) {
+                    asset->release();
+                    delete asset;
+                });
+            }
+
+            bool isKnown(std::size_t index) const {
+                auto it = m_PendingTypes.find(index);
+                if (it != m_PendingTypes.end()) return it->second.Type != WriteType::eRemove;
+
+                EpochReclaimer::Guard guard = g_Reclaimer.pin();
+                return containsCommitted(index);
+            }
+
+            void publish(const Snapshot *snapshot, std::vector<const Shard *> &&replaced) {
+                const Snapshot *previous = m_Snapshot.exchange(snapshot, std::memory_order_seq_cst);
+                g_Reclaimer.retire([previous, replaced = std::move(replaced)] {
+                    for (const Shard *shard : replaced)
+                        delete shard;
+                    delete previous;
+                });
+            }
         };
 
        private:
-        static std::map<std::size_t, std::unique_ptr<IAssetVector>> g_AssetsMap;
-        static bool                                                 g_IsInitialized;
-        static Status                                               g_Status;
+        static std::vector<std::unique_ptr<IAssetVector>> g_AssetVectors;
+        static std::mutex                                 g_AssetVectorsMutex;
+        static std::atomic<std::size_t>                   g_NextIndex;
+        static EpochReclaimer                             g_Reclaimer;
+        static bool                                       g_IsInitialized;
+        static Status                                     g_Status;
 
        private:
         AssetServer()  = default;
         ~AssetServer() = default;
 
         template <typename Asset, typename = std::enable_if_t<std::is_base_of<IAsset, Asset>::value>>
-        static std::map<std::size_t, Asset> &getAssetVector() {
-            std::size_t assetType = typeid(Asset).hash_code();
-
-            if (g_AssetsMap.find(assetType) == g_AssetsMap.end()) {
-                g_AssetsMap[assetType] = std::make_unique<AssetVector<Asset>>();
-            }
-            return *dynamic_cast<AssetVector<Asset> *>(g_AssetsMap[assetType].get());
+        static AssetVector<Asset> &getAssetVector() {
+            static AssetVector<Asset> *assets = [] {
+                std::lock_guard<std::mutex> lock{g_AssetVectorsMutex};
+                return static_cast<AssetVector<Asset> *>(g_AssetVectors.emplace_back(std::make_unique<AssetVector<Asset>>()).get());
+            }();
+            return *assets;
         }
     };
 
     template <typename Asset, typename EnableIf>
     bool AssetHandle<Asset, EnableIf>::isAdded() const {
-        return AssetServer::Contains<Asset>(m_Index);
+        return AssetServer::IsKnown<Asset>(m_Index);
     }
 }  // namespace vre
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/AssetHandle.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+#include <VREngine/Assets/SceneAsset.hpp>
+
+namespace vre {
+    class CookedSceneAsset : public IAsset {
+       public:
+        template <typename T>
+        struct Section {
+            std::uint64_t Offset;
+            std::uint64_t Count;
+        };
+
+        struct String {
+            std::uint32_t Offset;
+            std::uint32_t Size;
+        };
+
+        struct Mesh {
+            String        Name;
+            std::uint32_t FirstSubmesh;
+            std::uint32_t SubmeshCount;
+            std::uint32_t FirstVertex;
+            std::uint32_t VertexCount;
+            std::uint32_t FirstIndex;
+            std::uint32_t IndexCount;
+            std::uint32_t FirstMeshlet;
+            std::uint32_t MeshletCount;
+            std::uint32_t FirstMeshletVertex;
+            std::uint32_t MeshletVertexCount;
+            std::uint32_t FirstMeshletTriangle;
+            std::uint32_t MeshletTriangleCount;
+        };
+
+        struct Texture {
+            String        Name;
+            std::uint32_t Width;
+            std::uint32_t Height;
+            std::uint32_t ChannelCount;
+            std::uint32_t MipCount;
+            std::uint64_t DataOffset;
+            std::uint64_t DataSize;
+        };
+
+        struct Material {
+            glm::vec4     BaseColorFactor;
+            String        Name;
+            float         MetallicFactor;
+            float         RoughnessFactor;
+            std::int32_t  BaseColorTexture;
+            std::int32_t  MetallicRoughnessTexture;
+            std::int32_t  NormalTexture;
+            std::uint32_t Padding;
+        };
+
+        struct Node {
+            glm::mat4     LocalTransform;
+            glm::mat4     WorldTransform;
+            String        Name;
+            std::int32_t  Parent;
+            std::int32_t  Mesh;
+            std::uint32_t FirstChild;
+            std::uint32_t ChildCount;
+        };
+
+        // Section offsets are relative to the start of the file, everything nested in a section is relative to that section.
+        struct Header {
+            std::uint32_t Magic;
+            std::uint32_t Version;
+            std::uint64_t Size;
+
+            Section<Mesh>               Meshes;
+            Section<Texture>            Textures;
+            Section<Material>           Materials;
+            Section<Node>               Nodes;
+            Section<std::uint32_t>      RootNodes;
+            Section<std::uint32_t>      Children;
+            Section<MeshAsset::Submesh> Submeshes;
+            Section<MeshAsset::Vertex>  Vertices;
+            Section<std::uint32_t>      Indices;
+            Section<MeshAsset::Meshlet> Meshlets;
+            Section<std::uint32_t>      MeshletVertices;
+            Section<std::uint32_t>      MeshletTriangles;
+            Section<std::byte>          TextureData;
+            Section<char>               Strings;
+        };
+
+        static constexpr std::uint32_t MAGIC             = 0x4E435356u;
+        static constexpr std::uint32_t VERSION           = 2u;
+        static constexpr std::uint64_t SECTION_ALIGNMENT = 256u;
+        static constexpr const char   *EXTENSION         = ".vscene";
+
+       public:
+        static CookedSceneAsset FromPath(const fs::path &path);
+
+        static void Write(const fs::path &path, const SceneAsset &scene);
+
+       public:
+        CookedSceneAsset(const fs::path &path, std::shared_ptr<MappedFile> &&file);
+
+        CookedSceneAsset()  = default;
+        ~CookedSceneAsset() = default;
+
+        void release() override;
+
+        InternedPath     getInternedPath() const;
+        std::string_view getPath() const;
+        std::string_view getDirectory() const;
+        std::string_view getName() const;
+        std::string_view getExtension() const;
+
+        const Header &getHeader() const;
+
+        std::span<const Mesh>          getMeshes() const;
+        std::span<const Texture>       getTextures() const;
+        std::span<const Material>      getMaterials() const;
+        std::span<const Node>          getNodes() const;
+        std::span<const std::uint32_t> getRootNodes() const;
+
+        std::span<const MeshAsset::Vertex>  getVertices() const;
+        std::span<const std::uint32_t>      getIndices() const;
+        std::span<const MeshAsset::Meshlet> getMeshlets() const;
+        std::span<const std::uint32_t>      getMeshletVertices() const;
+        std::span<const std::uint32_t>      getMeshletTriangles() const;
+
+        std::span<const MeshAsset::Submesh> getSubmeshes(const Mesh &mesh) const;
+        std::span<const MeshAsset::Vertex>  getVertices(const Mesh &mesh) const;
+        std::span<const std::uint32_t>      getIndices(const Mesh &mesh) const;
+        std::span<const MeshAsset::Meshlet> getMeshlets(const Mesh &mesh) const;
+        std::span<const std::uint32_t>      getMeshletVertices(const Mesh &mesh) const;
+        std::span<const std::uint32_t>      getMeshletTriangles(const Mesh &mesh) const;
+        std::span<const std::uint32_t>      getChildren(const Node &node) const;
+        std::span<const std::byte>          getTextureData(const Texture &texture) const;
+        std::string_view                    getString(const String &string) const;
+
+       private:
+        InternedPath m_Path;
+
+        std::shared_ptr<MappedFile> m_File;
+        const Header               *m_Header{nullptr};
+
+       private:
+        template <typename T>
+        std::span<const T> getSection(const Section<T> &section) const {
+            DVRE_ASSERT(m_Header != nullptr, "vre::CookedSceneAsset is not loaded");
+            return std::span<const T>{reinterpret_cast<const T *>(m_File->getData() + section.Offset), std::size_t(section.Count)};
+        }
+
+        void validate() const;
+    };
+}  // namespace vre
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <VREngine/Core.hpp>
 #include <VREngine/Assets/AssetHandle.hpp>
+#include <VREngine/Assets/AssetIO.hpp>
 
 namespace vre {
     class FileAsset : public IAsset {
@@ -10,6 +11,10 @@ namespace vre {
         static FileAsset FromPath(const fs::path &path);
         static FileAsset FromPathBinary(const fs::path &path);
 
+        // Reads through vre::AssetIO when it is initialized. On a vre::ThreadPool worker the files are read directly instead,
+        // since AssetIO can complete its reads on the same pool and a worker waiting on them could wait on itself.
+        static std::vector<FileAsset> FromPathsBinary(std::span<const fs::path> paths);
+
        public:
         FileAsset(const fs::path &path, const std::string &content);
 
@@ -18,20 +23,18 @@ namespace vre {
 
         void release() override;
 
-        std::string getPath() const;
-        std::string getDirectory() const;
-        std::string getName() const;
-        std::string getExtension() const;
+        InternedPath     getInternedPath() const;
+        std::string_view getPath() const;
+        std::string_view getDirectory() const;
+        std::string_view getName() const;
+        std::string_view getExtension() const;
         std::string getContent() const;
 
         const std::string &operator*() const;
         operator const std::string &() const;
 
        private:
-        std::string m_Path;
-        std::string m_Directory;
-        std::string m_Name;
-        std::string m_Extension;
-        std::string m_Content;
+        InternedPath m_Path;
+        std::string  m_Content;
     };
 }  // namespace vre
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/AssetHandle.hpp>
+
+namespace vre {
+    class MeshAsset : public IAsset {
+       public:
+        struct Vertex {
+            glm::vec3 Position{0.0f};
+            glm::vec3 Normal{0.0f, 0.0f, 1.0f};
+            glm::vec2 UV{0.0f};
+            glm::vec4 Color{1.0f};
+        };
+
+        struct Submesh {
+            std::uint32_t FirstIndex;
+            std::uint32_t IndexCount;
+            std::int32_t  MaterialIndex;
+        };
+
+        struct Meshlet {
+            glm::vec4     BoundingSphere;
+            glm::vec4     Cone;
+            std::uint32_t VertexOffset;
+            std::uint32_t TriangleOffset;
+            std::uint32_t VertexCount;
+            std::uint32_t TriangleCount;
+            std::uint32_t FirstIndex;
+            std::uint32_t Submesh;
+            std::uint32_t Padding[2];
+        };
+
+       public:
+        static MeshAsset FromData(
+            const std::string          &name,
+            std::vector<Vertex>        &&vertices,
+            std::vector<std::uint32_t> &&indices,
+            std::vector<Submesh>       &&submeshes);
+        static MeshAsset FromData(
+            const std::string                &name,
+            const std::vector<Vertex>        &vertices,
+            const std::vector<std::uint32_t> &indices);
+
+       public:
+        MeshAsset(
+            const std::string          &name,
+            std::vector<Vertex>        &&vertices,
+            std::vector<std::uint32_t> &&indices,
+            std::vector<Submesh>       &&submeshes);
+
+        MeshAsset()  = default;
+        ~MeshAsset() = default;
+
+        void release() override;
+
+        std::string getName() const;
+
+        const std::vector<Vertex>        &getVertices() const;
+        const std::vector<std::uint32_t> &getIndices() const;
+        const std::vector<Submesh>       &getSubmeshes() const;
+
+        std::vector<Vertex>        &getVertices();
+        std::vector<std::uint32_t> &getIndices();
+        std::vector<Submesh>       &getSubmeshes();
+
+        void setMeshlets(
+            std::vector<Meshlet>       &&meshlets,
+            std::vector<std::uint32_t> &&meshletVertices,
+            std::vector<std::uint32_t> &&meshletTriangles);
+
+        const std::vector<Meshlet>       &getMeshlets() const;
+        const std::vector<std::uint32_t> &getMeshletVertices() const;
+        const std::vector<std::uint32_t> &getMeshletTriangles() const;
+
+        std::uint32_t getVertexCount() const;
+        std::uint32_t getIndexCount() const;
+        std::uint64_t getVerticesSize() const;
+        std::uint64_t getIndicesSize() const;
+
+       private:
+        std::string m_Name;
+
+        std::vector<Vertex>        m_Vertices;
+        std::vector<std::uint32_t> m_Indices;
+        std::vector<Submesh>       m_Submeshes;
+        std::vector<Meshlet>       m_Meshlets;
+        std::vector<std::uint32_t> m_MeshletVertices;
+        std::vector<std::uint32_t> m_MeshletTriangles;
+    };
+}  // namespace vre
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+
+namespace vre::MeshOptimizer {
+    struct Settings {
+        std::uint32_t CacheSize{16u};
+        float         OverdrawThreshold{1.05f};
+        bool          WeldVertices{true};
+        bool          OptimizeOverdraw{true};
+    };
+
+    struct VertexCacheStatistics {
+        std::uint32_t VerticesTransformed{0u};
+        float         ACMR{0.0f};
+        float         ATVR{0.0f};
+    };
+
+    struct Statistics {
+        VertexCacheStatistics Before;
+        VertexCacheStatistics After;
+        std::uint32_t         VerticesBefore{0u};
+        std::uint32_t         VerticesAfter{0u};
+    };
+
+    VertexCacheStatistics AnalyzeVertexCache(
+        std::span<const std::uint32_t> indices,
+        std::uint32_t                  vertexCount,
+        std::uint32_t                  cacheSize = 16u);
+
+    std::uint32_t WeldVertices(std::vector<MeshAsset::Vertex> &vertices, std::span<std::uint32_t> indices);
+
+    void OptimizeVertexCache(std::span<std::uint32_t> indices, std::uint32_t vertexCount);
+    void OptimizeOverdraw(
+        std::span<std::uint32_t>           indices,
+        std::span<const MeshAsset::Vertex> vertices,
+        std::uint32_t                      cacheSize,
+        float                              threshold);
+
+    std::uint32_t OptimizeVertexFetch(std::vector<MeshAsset::Vertex> &vertices, std::span<std::uint32_t> indices);
+
+    Statistics Optimize(MeshAsset &mesh, const Settings &settings);
+    Statistics Optimize(MeshAsset &mesh);
+}  // namespace vre::MeshOptimizer
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+
+namespace vre::MeshletBuilder {
+    constexpr std::uint32_t MAX_MESHLET_VERTICES  = 64u;
+    constexpr std::uint32_t MAX_MESHLET_TRIANGLES = 124u;
+
+    struct Settings {
+        std::uint32_t MaxVertices{MAX_MESHLET_VERTICES};
+        std::uint32_t MaxTriangles{MAX_MESHLET_TRIANGLES};
+    };
+
+    void ComputeBounds(
+        MeshAsset::Meshlet                 &meshlet,
+        std::span<const MeshAsset::Vertex> vertices,
+        std::span<const std::uint32_t>     meshletVertices,
+        std::span<const std::uint32_t>     meshletTriangles);
+
+    void Build(MeshAsset &mesh, const Settings &settings);
+    void Build(MeshAsset &mesh);
+}  // namespace vre::MeshletBuilder
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+
+namespace vre::PixelConversion {
+    enum class InstructionSet : std::uint8_t {
+        eScalar,
+        eSSE41,
+        eAVX2,
+    };
+
+    InstructionSet GetSupportedInstructionSet();
+    InstructionSet GetInstructionSet();
+    void           SetInstructionSet(InstructionSet instructionSet);
+
+    // Source and destination may alias for the same-size conversions, never for expansions or packing.
+    void ExpandRGBToRGBA(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount, std::uint8_t alpha = 255u);
+    void ExpandRGBToRGBA(const float *source, float *destination, std::size_t pixelCount, float alpha = 1.0f);
+    void SwapRedBlue(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount);
+    void SRGBToLinear(const std::uint8_t *source, float *destination, std::size_t pixelCount);
+    void LinearToSRGB(const float *source, std::uint8_t *destination, std::size_t pixelCount);
+    void PremultiplyAlpha(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount);
+    void FloatToHalf(const float *source, std::uint16_t *destination, std::size_t count);
+    void HalfToFloat(const std::uint16_t *source, float *destination, std::size_t count);
+
+    std::vector<std::uint16_t> PackRGBA16F(const float *source, std::uint32_t channelCount, std::size_t pixelCount);
+}  // namespace vre::PixelConversion
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/AssetHandle.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+#include <VREngine/Assets/TextureAsset.hpp>
+
+namespace vre {
+    class SceneAsset : public IAsset {
+       public:
+        struct Material {
+            std::string  Name;
+            glm::vec4    BaseColorFactor{1.0f};
+            float        MetallicFactor{1.0f};
+            float        RoughnessFactor{1.0f};
+            std::int32_t BaseColorTexture{-1};
+            std::int32_t MetallicRoughnessTexture{-1};
+            std::int32_t NormalTexture{-1};
+        };
+
+        struct Node {
+            std::string                Name;
+            std::int32_t               Parent{-1};
+            std::int32_t               Mesh{-1};
+            std::vector<std::uint32_t> Children;
+            glm::mat4                  LocalTransform{1.0f};
+            glm::mat4                  WorldTransform{1.0f};
+        };
+
+       public:
+        static SceneAsset FromPath(const fs::path &path, bool optimizeMeshes = true);
+        static SceneAsset FromCookedPath(const fs::path &path);
+
+        // Reports a missing or malformed glTF file instead of aborting.
+        static std::optional<SceneAsset> TryFromPath(const fs::path &path, bool optimizeMeshes = true);
+
+       public:
+        SceneAsset(
+            const fs::path              &path,
+            std::vector<MeshAsset>     &&meshes,
+            std::vector<TextureAsset>  &&textures,
+            std::vector<Material>      &&materials,
+            std::vector<Node>          &&nodes,
+            std::vector<std::uint32_t> &&rootNodes);
+
+        SceneAsset()  = default;
+        ~SceneAsset() = default;
+
+        void release() override;
+
+        InternedPath     getInternedPath() const;
+        std::string_view getPath() const;
+        std::string_view getDirectory() const;
+        std::string_view getName() const;
+        std::string_view getExtension() const;
+
+        const std::vector<MeshAsset>     &getMeshes() const;
+        const std::vector<TextureAsset>  &getTextures() const;
+        const std::vector<Material>      &getMaterials() const;
+        const std::vector<Node>          &getNodes() const;
+        const std::vector<std::uint32_t> &getRootNodes() const;
+
+        std::vector<MeshAsset>    &getMeshes();
+        std::vector<TextureAsset> &getTextures();
+
+       private:
+        InternedPath m_Path;
+
+        std::vector<MeshAsset>     m_Meshes;
+        std::vector<TextureAsset>  m_Textures;
+        std::vector<Material>      m_Materials;
+        std::vector<Node>          m_Nodes;
+        std::vector<std::uint32_t> m_RootNodes;
+    };
+}  // namespace vre
\ No newline at end of file
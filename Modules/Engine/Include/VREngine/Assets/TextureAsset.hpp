@@ -5,9 +5,37 @@
 
 namespace vre {
     class TextureAsset : public IAsset {
+       public:
+        // Every texture is stored as four channels, Radiance HDR images keep their range as half floats.
+        enum class Format : std::uint8_t {
+            eRGBA8,
+            eRGBA16F,
+        };
+
+        struct CookedHeader {
+            std::uint32_t Magic;
+            std::uint32_t Version;
+            std::uint32_t Width;
+            std::uint32_t Height;
+            std::uint32_t ChannelCount;
+            std::uint32_t MipCount;
+            std::uint64_t Size;
+        };
+
+        static constexpr std::uint32_t COOKED_MAGIC     = 0x58455456u;
+        static constexpr std::uint32_t COOKED_VERSION   = 2u;
+        static constexpr const char   *COOKED_EXTENSION = ".vtex";
+
        public:
         static TextureAsset FromData(const fs::path &path, void *data, std::size_t size, bool flipVertically = true);
+        static TextureAsset FromPixels(const fs::path &path, const void *pixels, std::size_t size, std::uint32_t width, std::uint32_t height, std::uint32_t mipCount = 1u);
         static TextureAsset FromPath(const fs::path &path, bool flipVertically = true);
+        static TextureAsset FromCookedPath(const fs::path &path, bool flipVertically = true);
+
+        // Same as FromData(), FromPath() and FromCookedPath() but undecodable or missing files are reported instead of aborting.
+        static std::optional<TextureAsset> TryFromData(const fs::path &path, const void *data, std::size_t size, bool flipVertically = true);
+        static std::optional<TextureAsset> TryFromPath(const fs::path &path, bool flipVertically = true);
+        static std::optional<TextureAsset> TryFromCookedPath(const fs::path &path, bool flipVertically = true);
 
        public:
         TextureAsset(const fs::path &path, void *data, std::size_t size, std::uint32_t width, std::uint32_t height, std::uint32_t channelCount, std::uint32_t stride);
@@ -17,29 +45,42 @@ namespace vre {
 
         void release() override;
 
-        std::string getPath() const;
-        std::string getDirectory() const;
-        std::string getName() const;
-        std::string getExtension() const;
+        InternedPath     getInternedPath() const;
+        std::string_view getPath() const;
+        std::string_view getDirectory() const;
+        std::string_view getName() const;
+        std::string_view getExtension() const;
 
         void         *getData() const;
         std::size_t   getSize() const;
         std::uint32_t getWidth() const;
         std::uint32_t getHeight() const;
         std::uint32_t getChannelCount() const;
+        Format        getFormat() const;
+        std::uint32_t getTexelSize() const;
         std::uint32_t getStride() const;
+        std::uint32_t getMipCount() const;
+        std::size_t   getMipOffset(std::uint32_t mip) const;
+        std::size_t   getMipSize(std::uint32_t mip) const;
+
+        // Only callers that know the texture holds sRGB colors pass isSRGB, its color channels are then filtered in linear
+        // space. Alpha and everything else is filtered as stored.
+        void generateMips(bool isSRGB = false);
+        void save(const fs::path &path) const;
+
+       private:
+        InternedPath m_Path;
+
+        void         *m_Data{nullptr};
+        std::size_t   m_Size{0u};
+        std::uint32_t m_Width{0u};
+        std::uint32_t m_Height{0u};
+        std::uint32_t m_ChannelCount{0u};
+        Format        m_Format{Format::eRGBA8};
+        std::uint32_t m_Stride{0u};
+        std::uint32_t m_MipCount{1u};
 
        private:
-        std::string m_Path;
-        std::string m_Directory;
-        std::string m_Name;
-        std::string m_Extension;
-
-        void         *m_Data;
-        std::size_t   m_Size;
-        std::uint32_t m_Width;
-        std::uint32_t m_Height;
-        std::uint32_t m_ChannelCount;
-        std::uint32_t m_Stride;
+        static std::optional<TextureAsset> FromDecoded(const fs::path &path, void *rawData, std::int32_t width, std::int32_t height, std::int32_t channelCount, bool isHDR);
     };
 }  // namespace vre
\ No newline at end of file
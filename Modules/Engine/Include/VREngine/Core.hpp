@@ -2,4 +2,10 @@
 
 #include <VREngine/Core/Includes.hpp>
 #include <VREngine/Core/Logger.hpp>
-#include <VREngine/Core/EventObserver.hpp>
\ No newline at end of file
+#include <VREngine/Core/EventObserver.hpp>
+#include <VREngine/Core/ThreadPool.hpp>
+#include <VREngine/Core/EpochReclaimer.hpp>
+#include <VREngine/Core/Hash.hpp>
+#include <VREngine/Core/PathTable.hpp>
+#include <VREngine/Core/OffsetAllocator.hpp>
+#include <VREngine/Core/MappedFile.hpp>
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+
+namespace vre {
+    class EpochReclaimer {
+       public:
+        // Threads give their slot back when they exit, so this only bounds the number of threads alive at the same time.
+        static constexpr std::uint32_t MAX_THREADS = 128u;
+
+        class Guard {
+           public:
+            Guard(std::atomic<std::uint64_t> &slot, std::uint64_t epoch);
+            ~Guard();
+
+            Guard(const Guard &)            = delete;
+            Guard &operator=(const Guard &) = delete;
+
+           private:
+            std::atomic<std::uint64_t> *m_Slot;
+            bool                        m_IsOutermost;
+        };
+
+       public:
+        EpochReclaimer() = default;
+        ~EpochReclaimer();
+
+        EpochReclaimer(const EpochReclaimer &)            = delete;
+        EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+        Guard pin();
+
+        void retire(std::function<void()> &&deleter);
+        void collect();
+        void flush();
+
+        std::size_t getRetiredCount();
+
+       private:
+        static constexpr std::uint64_t INACTIVE = std::numeric_limits<std::uint64_t>::max();
+
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> Epoch{INACTIVE};
+        };
+
+        struct Retired {
+            std::uint64_t         Epoch;
+            std::function<void()> Deleter;
+        };
+
+       private:
+        std::array<Slot, MAX_THREADS> m_Slots;
+        std::atomic<std::uint64_t>    m_Epoch{0u};
+        std::mutex                    m_Mutex;
+        std::vector<Retired>          m_Retired;
+
+       private:
+        static std::uint32_t GetThreadIndex();
+    };
+}  // namespace vre
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+
+namespace vre::Hash {
+    std::uint64_t Bytes(const void *data, std::size_t size, std::uint64_t seed = 0u);
+    std::uint64_t String(std::string_view string, std::uint64_t seed = 0u);
+    std::uint64_t File(const fs::path &path, std::uint64_t seed = 0u);
+    std::uint64_t Combine(std::uint64_t seed, std::uint64_t value);
+
+    std::optional<std::uint64_t> TryFile(const fs::path &path, std::uint64_t seed = 0u);
+
+    template <typename T>
+    std::uint64_t Value(const T &value, std::uint64_t seed = 0u) {
+        static_assert(std::is_trivially_copyable_v<T>, "vre::Hash::Value needs a trivially copyable type");
+        return Bytes(&value, sizeof(T), seed);
+    }
+}  // namespace vre::Hash
\ No newline at end of file
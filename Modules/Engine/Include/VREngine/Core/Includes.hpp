@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <source_location>
 #include <vector>
@@ -16,6 +17,9 @@
 #include <string>
 #include <functional>
 #include <algorithm>
+#include <numeric>
+#include <bit>
+#include <charconv>
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
@@ -30,6 +34,12 @@
 #include <typeinfo>
 #include <limits>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <atomic>
+#include <deque>
+#include <optional>
 #include <cmath>
 
 #define VULKAN_HPP_NO_EXCEPTIONS
@@ -45,6 +55,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/string_cast.hpp>
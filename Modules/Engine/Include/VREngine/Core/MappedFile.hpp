@@ -0,0 +1,31 @@
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+
+namespace vre {
+    class MappedFile {
+       public:
+        MappedFile(const fs::path &path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &)            = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool isOpen() const;
+
+        const std::byte *getData() const;
+        std::size_t      getSize() const;
+
+       private:
+        const std::byte *m_Data{nullptr};
+        std::size_t      m_Size{0u};
+
+#ifdef VRE_PLATFORM_WINDOWS
+        void *m_File{nullptr};
+        void *m_Mapping{nullptr};
+#else
+        int m_File{-1};
+#endif
+    };
+}  // namespace vre
\ No newline at end of file
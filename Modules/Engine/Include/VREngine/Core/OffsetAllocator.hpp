@@ -0,0 +1,97 @@
+// Based on OffsetAllocator by Sebastian Aaltonen (https://github.com/sebbbi/OffsetAllocator).
+//
+// MIT License
+//
+// Copyright (c) 2023 Sebastian Aaltonen
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+
+namespace vre {
+    // Two-level segregated fit allocator over an abstract range of units, it never touches the memory it manages.
+    class OffsetAllocator {
+       public:
+        struct Allocation {
+            std::uint32_t Offset{NO_SPACE};
+            std::uint32_t NodeIndex{NO_SPACE};
+
+            bool isValid() const;
+        };
+
+        struct StorageReport {
+            std::uint32_t TotalFreeSpace;
+            std::uint32_t LargestFreeRegion;
+            std::uint32_t FreeRegionCount;
+            std::uint32_t AllocationCount;
+        };
+
+        static constexpr std::uint32_t NO_SPACE = 0xFFFFFFFFu;
+
+       public:
+        OffsetAllocator(std::uint32_t size, std::uint32_t maxAllocations = 128u * 1024u);
+        OffsetAllocator() = default;
+
+        Allocation allocate(std::uint32_t size);
+        void       free(const Allocation &allocation);
+        void       reset();
+
+        std::uint32_t getAllocationSize(const Allocation &allocation) const;
+        std::uint32_t getSize() const;
+        StorageReport getStorageReport() const;
+
+       private:
+        struct Node {
+            static constexpr std::uint32_t UNUSED = 0xFFFFFFFFu;
+
+            std::uint32_t DataOffset{0u};
+            std::uint32_t DataSize{0u};
+            std::uint32_t BinListPrev{UNUSED};
+            std::uint32_t BinListNext{UNUSED};
+            std::uint32_t NeighborPrev{UNUSED};
+            std::uint32_t NeighborNext{UNUSED};
+            bool          IsUsed{false};
+        };
+
+        static constexpr std::uint32_t TOP_BIN_COUNT  = 32u;
+        static constexpr std::uint32_t BINS_PER_LEAF  = 8u;
+        static constexpr std::uint32_t LEAF_BIN_COUNT = TOP_BIN_COUNT * BINS_PER_LEAF;
+
+       private:
+        std::uint32_t m_Size{0u};
+        std::uint32_t m_MaxAllocations{0u};
+        std::uint32_t m_FreeStorage{0u};
+        std::uint32_t m_FreeRegionCount{0u};
+        std::uint32_t m_AllocationCount{0u};
+
+        std::uint32_t                             m_UsedBinsTop{0u};
+        std::array<std::uint8_t, TOP_BIN_COUNT>   m_UsedBins{};
+        std::array<std::uint32_t, LEAF_BIN_COUNT> m_BinIndices{};
+
+        std::vector<Node>          m_Nodes;
+        std::vector<std::uint32_t> m_FreeNodes;
+
+       private:
+        std::uint32_t insertNodeIntoBin(std::uint32_t size, std::uint32_t dataOffset);
+        void          removeNodeFromBin(std::uint32_t nodeIndex);
+    };
+}  // namespace vre
\ No newline at end of file
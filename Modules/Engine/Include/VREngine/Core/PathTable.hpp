@@ -0,0 +1,63 @@
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+#include <VREngine/Core/Hash.hpp>
+
+namespace vre {
+    class PathTable {
+       public:
+        using Id = std::uint32_t;
+
+        struct Entry {
+            std::string   Path;
+            std::uint64_t Hash{0u};
+            std::uint32_t DirectoryLength{0u};
+            std::uint32_t NameOffset{0u};
+            std::uint32_t ExtensionOffset{0u};
+        };
+
+        static constexpr Id            INVALID_ID = 0u;
+        static constexpr std::uint32_t CHUNK_SIZE = 4096u;
+        static constexpr std::uint32_t MAX_CHUNKS = 1024u;
+
+       public:
+        static Id           Intern(const fs::path &path);
+        static Id           Find(std::string_view path);
+        static const Entry &Get(Id id);
+        static std::size_t  GetCount();
+
+       private:
+        static std::array<std::unique_ptr<Entry[]>, MAX_CHUNKS> g_Chunks;
+        static std::unordered_map<std::string_view, Id>         g_Ids;
+        static std::mutex                                       g_Mutex;
+        static std::atomic<std::uint32_t>                       g_Count;
+    };
+
+    class InternedPath {
+       public:
+        InternedPath() = default;
+        InternedPath(const fs::path &path);
+
+        bool          isValid() const;
+        PathTable::Id getId() const;
+        std::uint64_t getHash() const;
+
+        std::string_view getPath() const;
+        std::string_view getDirectory() const;
+        std::string_view getName() const;
+        std::string_view getExtension() const;
+
+        bool operator==(const InternedPath &) const = default;
+
+       private:
+        PathTable::Id m_Id{PathTable::INVALID_ID};
+    };
+}  // namespace vre
+
+template <>
+struct std::hash<vre::InternedPath> {
+    std::size_t operator()(const vre::InternedPath &path) const noexcept {
+        return std::hash<vre::PathTable::Id>{}(path.getId());
+    }
+};
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <VREngine/Core/Includes.hpp>
+#include <VREngine/Core/Logger.hpp>
+
+namespace vre {
+    class ThreadPool {
+       public:
+        struct Settings {
+            std::uint32_t ThreadCount{0u};
+        };
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        static std::uint32_t GetThreadCount();
+        static bool          IsWorkerThread();
+
+        template <typename Function>
+        static std::future<std::invoke_result_t<Function>> Submit(Function &&function) {
+            DVRE_ASSERT(g_IsInitialized, "vre::ThreadPool must be initialized");
+            using Result = std::invoke_result_t<Function>;
+
+            std::shared_ptr<std::packaged_task<Result()>> task =
+                std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+            std::future<Result> future = task->get_future();
+            Enqueue([task] { (*task)(); });
+            return future;
+        }
+
+        static void ParallelFor(
+            std::size_t                                                   count,
+            std::size_t                                                   grainSize,
+            const std::function<void(std::size_t begin, std::size_t end)> &function);
+        static void ParallelFor(
+            std::size_t                                    count,
+            const std::function<void(std::size_t index)> &function);
+
+       private:
+        static std::vector<std::thread>          g_Workers;
+        static std::deque<std::function<void()>> g_Tasks;
+        static std::mutex                        g_Mutex;
+        static std::condition_variable           g_Condition;
+        static bool                              g_IsStopping;
+        static bool                              g_IsInitialized;
+        static thread_local bool                 g_IsWorkerThread;
+        static ThreadPool                        g_State;
+
+       private:
+        ThreadPool() = default;
+        ~ThreadPool();
+
+        static void Enqueue(std::function<void()> &&task);
+        static void WorkerLoop();
+    };
+}  // namespace vre
\ No newline at end of file
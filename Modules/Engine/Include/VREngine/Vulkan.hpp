@@ -10,4 +10,15 @@
 #include <VREngine/Vulkan/Descriptor.hpp>
 #include <VREngine/Vulkan/Pipeline.hpp>
 #include <VREngine/Vulkan/RenderPass.hpp>
-#include <VREngine/Vulkan/Shader.hpp>
\ No newline at end of file
+#include <VREngine/Vulkan/Shader.hpp>
+#include <VREngine/Vulkan/VertexFormat.hpp>
+#include <VREngine/Vulkan/TextureResidency.hpp>
+#include <VREngine/Vulkan/UploadContext.hpp>
+#include <VREngine/Vulkan/FrameAllocator.hpp>
+#include <VREngine/Vulkan/GeometryHeap.hpp>
+#include <VREngine/Vulkan/VertexPulling.hpp>
+#include <VREngine/Vulkan/BindlessTable.hpp>
+#include <VREngine/Vulkan/DescriptorBuffer.hpp>
+#include <VREngine/Vulkan/ObjectCache.hpp>
+#include <VREngine/Vulkan/Defragmenter.hpp>
+#include <VREngine/Vulkan/MeshletRenderer.hpp>
\ No newline at end of file
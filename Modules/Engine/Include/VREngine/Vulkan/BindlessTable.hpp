@@ -0,0 +1,92 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan {
+    // One update-after-bind set holding every sampled image, sampler and storage buffer, which shaders index by slot.
+    class BindlessTable {
+       public:
+        struct Settings {
+            std::uint32_t        MaxSampledImages{16u * 1024u};
+            std::uint32_t        MaxSamplers{256u};
+            std::uint32_t        MaxStorageBuffers{16u * 1024u};
+            std::uint32_t        FramesInFlight{3u};
+            vk::ShaderStageFlags StageFlags{vk::ShaderStageFlagBits::eAll};
+        };
+
+        using Slot = std::uint32_t;
+
+        static constexpr Slot          INVALID_SLOT           = 0xFFFFFFFFu;
+        static constexpr std::uint32_t SET_INDEX              = 0u;
+        static constexpr std::uint32_t SAMPLED_IMAGE_BINDING  = 0u;
+        static constexpr std::uint32_t SAMPLER_BINDING        = 1u;
+        static constexpr std::uint32_t STORAGE_BUFFER_BINDING = 2u;
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        static Slot AddSampledImage(const vk::ImageView &view, vk::ImageLayout layout = vk::ImageLayout::eShaderReadOnlyOptimal);
+        static Slot AddSampler(const vk::Sampler &sampler);
+        static Slot AddStorageBuffer(const Buffer::Allocation &buffer);
+        static Slot AddStorageBuffer(const vk::Buffer &buffer, std::uint64_t offset, std::uint64_t size);
+
+        // Only valid while no pending frame reads the slot, otherwise add a new slot and remove the old one.
+        static void SetSampledImage(Slot slot, const vk::ImageView &view, vk::ImageLayout layout = vk::ImageLayout::eShaderReadOnlyOptimal);
+
+        // Slots are handed out again once FramesInFlight calls to Update() have passed.
+        static void RemoveSampledImage(Slot slot);
+        static void RemoveSampler(Slot slot);
+        static void RemoveStorageBuffer(Slot slot);
+        static void Update();
+
+        static void Bind(const vk::CommandBuffer &commandBuffer, vk::PipelineBindPoint bindPoint, const vk::PipelineLayout &layout);
+
+        static vk::DescriptorSetLayout GetLayout();
+        static vk::DescriptorSet       GetSet();
+        static std::uint32_t           GetSampledImageCount();
+        static std::uint32_t           GetSamplerCount();
+        static std::uint32_t           GetStorageBufferCount();
+
+       private:
+        struct Retired {
+            Slot          Index;
+            std::uint64_t Frame;
+        };
+
+        // Live has a bit per slot so a slot removed twice is caught before it lands in Free twice.
+        struct Table {
+            std::uint32_t       Capacity{0u};
+            std::vector<bool>   Live;
+            std::uint32_t       Next{0u};
+            std::uint32_t       Count{0u};
+            std::vector<Slot>   Free;
+            std::deque<Retired> Pending;
+        };
+
+       private:
+        static Settings                g_Settings;
+        static vk::DescriptorSetLayout g_Layout;
+        static vk::DescriptorPool      g_Pool;
+        static vk::DescriptorSet       g_Set;
+        static Table                   g_SampledImages;
+        static Table                   g_Samplers;
+        static Table                   g_StorageBuffers;
+        static std::uint64_t           g_Frame;
+
+        static bool          g_IsInitialized;
+        static BindlessTable g_State;
+
+       private:
+        BindlessTable() = default;
+        ~BindlessTable();
+
+        static Slot Acquire(Table &table, const char *name);
+        static void Retire(Table &table, Slot slot);
+        static void Recycle(Table &table);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -35,5 +35,21 @@ namespace vre::Vulkan::Buffer {
         vk::BufferUsageFlags usageFlags,
         const VmaAllocator  &allocator);
 
+    vk::BufferMemoryBarrier2 GetOwnershipBarrier(
+        const Allocation &buffer,
+        std::uint64_t     offset,
+        std::uint64_t     size,
+        std::uint32_t     sourceQueueFamilyIndex,
+        std::uint32_t     destinationQueueFamilyIndex);
+    void TransferOwnership(
+        const vk::CommandBuffer &commandBuffer,
+        const Allocation        &buffer,
+        std::uint64_t            offset,
+        std::uint64_t            size,
+        std::uint32_t            sourceQueueFamilyIndex,
+        std::uint32_t            destinationQueueFamilyIndex);
+
+    vk::DeviceAddress GetAddress(const Allocation &buffer, std::uint64_t offset = 0u);
+
     void Release(const Allocation &buffer);
 }  // namespace vre::Vulkan::Buffer
\ No newline at end of file
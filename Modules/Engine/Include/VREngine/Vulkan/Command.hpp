@@ -112,6 +112,19 @@ namespace vre::Vulkan {
             const vk::CommandBuffer  &buffer,
             const Buffer::Allocation &source,
             const Image::Allocation  &destination);
+        void CopyBufferToImage(
+            const vk::CommandBuffer  &buffer,
+            const Buffer::Allocation &source,
+            const Image::Allocation  &destination,
+            std::uint64_t             sourceOffset,
+            std::uint32_t             mipLevel);
+        void CopyBufferToImage(
+            const vk::CommandBuffer  &buffer,
+            const Buffer::Allocation &source,
+            const Image::Allocation  &destination,
+            std::uint64_t             sourceOffset,
+            std::uint32_t             firstMipLevel,
+            std::uint32_t             mipLevelCount);
         void CopyBufferToImage(
             const vk::CommandBuffer  &buffer,
             const Buffer::Allocation &source,
@@ -146,5 +159,11 @@ namespace vre::Vulkan {
             const vk::Buffer        &destination,
             const vk::Extent3D      &size);
 
+        void DrawMeshTasks(
+            const vk::CommandBuffer &buffer,
+            std::uint32_t            groupCountX,
+            std::uint32_t            groupCountY,
+            std::uint32_t            groupCountZ);
+        void DrawMeshTasks(const vk::CommandBuffer &buffer, std::uint32_t groupCount);
     }  // namespace CommandBuffer
 }  // namespace vre::Vulkan
\ No newline at end of file
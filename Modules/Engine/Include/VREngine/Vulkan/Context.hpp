@@ -27,8 +27,11 @@ namespace vre::Vulkan {
         static vk::PhysicalDevice         GetPhysicalDevice();
         static vk::Device                 GetDevice();
         static std::uint32_t              GetQueueFamilyIndex();
+        static std::uint32_t              GetComputeQueueFamilyIndex();
+        static std::uint32_t              GetTransferQueueFamilyIndex();
         static vk::Queue                  GetGraphicsQueue();
         static vk::Queue                  GetComputeQueue();
+        static vk::Queue                  GetTransferQueue();
         static vk::Queue                  GetPresentQueue();
         static vk::SwapchainKHR           GetSwapchain();
         static vk::Format                 GetSwapchainFormat();
@@ -39,6 +42,20 @@ namespace vre::Vulkan {
         static std::vector<vk::ImageView> GetSwapchainImageViews();
         static VmaAllocator               GetVmaAllocator();
 
+        static bool                      IsMeshShaderSupported();
+        static PFN_vkCmdDrawMeshTasksEXT GetCmdDrawMeshTasksFunction();
+
+        static bool IsMemoryBudgetSupported();
+
+        static bool                                      IsPushDescriptorSupported();
+        static PFN_vkCmdPushDescriptorSetKHR             GetCmdPushDescriptorSetFunction();
+        static PFN_vkCmdPushDescriptorSetWithTemplateKHR GetCmdPushDescriptorSetWithTemplateFunction();
+
+        static bool IsDescriptorBufferSupported();
+
+        static bool IsComputeQueueDedicated();
+        static bool IsTransferQueueDedicated();
+
        private:
         static vk::Instance               g_Instance;
         static vk::DebugUtilsMessengerEXT g_DebugMessenger;
@@ -47,8 +64,12 @@ namespace vre::Vulkan {
         static vk::Device                 g_Device;
         static std::uint32_t              g_QueueFamilyIndex;
         static std::uint32_t              g_QueueFamilyQueueCount;
+        static std::uint32_t              g_ComputeQueueFamilyIndex;
+        static std::uint32_t              g_TransferQueueFamilyIndex;
+        static std::uint32_t              g_TransferQueueIndex;
         static vk::Queue                  g_GraphicsQueue;
         static vk::Queue                  g_ComputeQueue;
+        static vk::Queue                  g_TransferQueue;
         static vk::Queue                  g_PresentQueue;
         static vk::SwapchainKHR           g_Swapchain;
         static vk::SurfaceFormatKHR       g_SwapchainFormat;
@@ -60,6 +81,17 @@ namespace vre::Vulkan {
         static std::vector<vk::ImageView> g_SwapchainImageViews;
         static VmaAllocator               g_VmaAllocator;
 
+        static bool                      g_IsMeshShaderSupported;
+        static PFN_vkCmdDrawMeshTasksEXT g_CmdDrawMeshTasks;
+
+        static bool g_IsMemoryBudgetSupported;
+
+        static bool                                      g_IsPushDescriptorSupported;
+        static PFN_vkCmdPushDescriptorSetKHR             g_CmdPushDescriptorSet;
+        static PFN_vkCmdPushDescriptorSetWithTemplateKHR g_CmdPushDescriptorSetWithTemplate;
+
+        static bool g_IsDescriptorBufferSupported;
+
         static bool    g_IsInitialized;
         static Context g_State;
 
@@ -69,6 +101,7 @@ namespace vre::Vulkan {
 
         static void SelectPhysicalDevice(const std::vector<const char *> &requiredExtensions, const Settings &settings);
         static void SelectQueueFamilyIndex();
+        static void SelectDedicatedQueueFamilyIndices();
         static void SelectSwapchainImageCount(const Settings &settings);
         static void SelectSwapchainFormat(const Settings &settings);
         static void SelectSwapchainPresentMode(const Settings &settings);
@@ -78,6 +111,8 @@ namespace vre::Vulkan {
 
         static bool CheckInstanceLayerSupport(const std::vector<const char *> &requiredLayers);
         static bool CheckPhysicalDeviceFeatureSupport(const vk::PhysicalDevice &physicalDevice);
+        static bool CheckPhysicalDeviceMeshShaderSupport(const vk::PhysicalDevice &physicalDevice);
+        static bool CheckPhysicalDeviceDescriptorBufferSupport(const vk::PhysicalDevice &physicalDevice);
         static bool CheckPhysicalDeviceSwapchainSupport(const vk::PhysicalDevice &physicalDevice, const vk::SurfaceKHR &surface, const Settings &settings);
         static bool CheckPhysicalDeviceExtensionSupport(const vk::PhysicalDevice &physicalDevice, const std::vector<const char *> &requiredExtensions);
 
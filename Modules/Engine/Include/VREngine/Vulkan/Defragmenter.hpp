@@ -0,0 +1,144 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+#include <VREngine/Vulkan/UploadContext.hpp>
+
+namespace vre::Vulkan {
+    class BufferMovedEvent : public IEvent {
+       public:
+        Buffer::Allocation Old;
+        Buffer::Allocation New;
+
+        BufferMovedEvent(const Buffer::Allocation &oldBuffer, const Buffer::Allocation &newBuffer)
+            : Old{oldBuffer}, New{newBuffer} {}
+    };
+
+    class ImageMovedEvent : public IEvent {
+       public:
+        Image::Allocation                                    Old;
+        Image::Allocation                                    New;
+        std::vector<std::pair<vk::ImageView, vk::ImageView>> Views;
+
+        ImageMovedEvent(
+            const Image::Allocation                                    &oldImage,
+            const Image::Allocation                                    &newImage,
+            const std::vector<std::pair<vk::ImageView, vk::ImageView>> &views)
+            : Old{oldImage}, New{newImage}, Views{views} {}
+    };
+
+    // Compacts device local memory a few moves at a time. Only registered resources are moved, their owners are told about
+    // the new handles through BufferMovedEvent and ImageMovedEvent before any command that could use them is recorded.
+    // The VmaAllocation of a moved resource stays the same, old handles and views are destroyed FramesInFlight frames later.
+    class Defragmenter {
+       public:
+        struct Settings {
+            std::uint32_t           FramesInFlight{3u};
+            std::uint32_t           MaxMovesPerPass{32u};
+            std::uint64_t           MaxBytesPerPass{std::uint64_t(32u) << 20};
+            std::uint32_t           CheckIntervalFrames{600u};
+            float                   FragmentationThreshold{0.3f};
+            VmaDefragmentationFlags Algorithm{VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT};
+        };
+
+        struct Statistics {
+            std::uint64_t Passes;
+            std::uint64_t Moves;
+            std::uint64_t BytesMoved;
+            std::uint64_t BytesFreed;
+            std::uint32_t DeviceMemoryBlocksFreed;
+            float         Fragmentation;
+            bool          IsRunning;
+        };
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        // Registered resources must be created with both transfer source and destination usage and released through Release().
+        static void          Register(const Buffer::Allocation &buffer);
+        static void          Register(const Image::Allocation &image, const vk::ImageCreateInfo &info, vk::ImageLayout layout);
+        static vk::ImageView CreateView(const Image::Allocation &image, const vk::ImageViewCreateInfo &info);
+        static void          DestroyView(const vk::ImageView &view);
+        static void          Release(const Buffer::Allocation &buffer);
+        static void          Release(const Image::Allocation &image);
+        // A resource is not moved until the latest upload into it has completed, otherwise the copy would race the upload.
+        static void SetUploadTicket(const Buffer::Allocation &buffer, UploadContext::Ticket ticket);
+        static void SetUploadTicket(const Image::Allocation &image, UploadContext::Ticket ticket);
+
+        // Update() must be called once per frame after the fence of the frame has signaled, the copies are recorded into commandBuffer.
+        static void Start();
+        static void Update(const vk::CommandBuffer &commandBuffer);
+
+        static Statistics GetStatistics();
+
+       private:
+        struct View {
+            vk::ImageView           Handle;
+            vk::ImageViewCreateInfo Info;
+        };
+
+        struct Resource {
+            bool                IsImage{false};
+            bool                  IsReleased{false};
+            Buffer::Allocation    BufferAllocation{};
+            Image::Allocation     ImageAllocation{};
+            vk::ImageCreateInfo   ImageInfo{};
+            vk::ImageLayout       Layout{vk::ImageLayout::eUndefined};
+            std::vector<View>     Views;
+            UploadContext::Ticket UploadTicket{UploadContext::INVALID_TICKET};
+        };
+
+        struct Retired {
+            vk::Buffer                 Buffer;
+            vk::Image                  Image;
+            std::vector<vk::ImageView> Views;
+        };
+
+       private:
+        static Settings                                       g_Settings;
+        static vk::Device                                     g_Device;
+        static VmaAllocator                                   g_Allocator;
+        static std::unordered_map<VmaAllocation, Resource>    g_Resources;
+        static std::unordered_map<VkImageView, VmaAllocation> g_Views;
+        static VmaDefragmentationContext                      g_Context;
+        static VmaDefragmentationPassMoveInfo                 g_Pass;
+        static std::vector<Retired>                           g_Retired;
+        static bool                                           g_IsPassActive;
+        static std::uint64_t                                  g_PassFrame;
+        static std::uint64_t                                  g_Frame;
+        static Statistics                                     g_Statistics;
+        static std::mutex                                     g_Mutex;
+
+        static bool         g_IsInitialized;
+        static Defragmenter g_State;
+
+       private:
+        Defragmenter() = default;
+        ~Defragmenter();
+
+        static float GetFragmentation();
+        static void  BeginDefragmentation();
+        static void  EndDefragmentation();
+        static void  BeginPass(
+            const vk::CommandBuffer       &commandBuffer,
+            std::vector<BufferMovedEvent> &bufferEvents,
+            std::vector<ImageMovedEvent>  &imageEvents);
+        static void EndPass();
+        static void MoveBuffer(
+            const vk::CommandBuffer       &commandBuffer,
+            const VmaDefragmentationMove  &move,
+            Resource                      &resource,
+            std::vector<BufferMovedEvent> &events);
+        static void MoveImage(
+            const vk::CommandBuffer      &commandBuffer,
+            const VmaDefragmentationMove &move,
+            Resource                     &resource,
+            std::vector<ImageMovedEvent> &events);
+        static void Destroy(const Resource &resource, VmaAllocation allocation);
+        static void SetUploadTicket(VmaAllocation allocation, UploadContext::Ticket ticket);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -21,6 +21,9 @@ namespace vre::Vulkan {
                 const vk::Device    &device);
             vk::DescriptorSetLayout build(const vk::Device &device);
 
+            vk::DescriptorSetLayoutCreateFlags                 getFlags() const;
+            const std::vector<vk::DescriptorSetLayoutBinding> &getBindings() const;
+
            private:
             std::vector<vk::DescriptorSetLayoutBinding> m_Bindings;
             vk::DescriptorSetLayoutCreateFlags          m_Flags;
@@ -83,8 +86,33 @@ namespace vre::Vulkan {
             ~Binder() = default;
 
             void clear();
-            void bind(const vk::DescriptorSet &set, const vk::Device &device);
-            void bind(const vk::Device &device);
+            void bind(const vk::DescriptorSet &set, const vk::Device &device) const;
+            void bind(const vk::Device &device) const;
+
+            std::uint64_t getHash() const;
+            bool          references(const vk::Buffer &buffer) const;
+            bool          references(const vk::ImageView &view) const;
+            bool          references(const vk::Sampler &sampler) const;
+
+            bool operator==(const Binder &other) const;
+
+            // Needs VK_KHR_push_descriptor and a set layout built with vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR.
+            void push(
+                const vk::CommandBuffer  &commandBuffer,
+                vk::PipelineBindPoint     bindPoint,
+                const vk::PipelineLayout &layout,
+                std::uint32_t             set) const;
+
+            // Template data holds one vk::DescriptorBufferInfo or vk::DescriptorImageInfo per binding, in the order the
+            // bindings were added. Both are 24 bytes, so a struct declaring them in that order matches getDataSize().
+            vk::DescriptorUpdateTemplate createUpdateTemplate(const vk::DescriptorSetLayout &layout, const vk::Device &device) const;
+            vk::DescriptorUpdateTemplate createPushTemplate(
+                vk::PipelineBindPoint     bindPoint,
+                const vk::PipelineLayout &layout,
+                std::uint32_t             set,
+                const vk::Device         &device) const;
+            std::uint32_t                getDataSize() const;
+            void                         pack(void *data) const;
 
             Binder &addUniformBuffer(
                 const vk::DescriptorSet  &set,
@@ -167,6 +195,7 @@ namespace vre::Vulkan {
                 std::uint32_t      Binding;
                 vk::DescriptorType Type;
                 std::uint32_t      InfoIndex;
+                std::uint32_t      Order;
             };
 
            private:
@@ -175,8 +204,175 @@ namespace vre::Vulkan {
 
             std::vector<Binding> m_BufferBindings;
             std::vector<Binding> m_ImageBindings;
+
+           private:
+            std::vector<vk::WriteDescriptorSet>            getWrites(const vk::DescriptorSet &set) const;
+            std::vector<vk::DescriptorUpdateTemplateEntry> getTemplateEntries() const;
         };
 
+        // Grows a list of pools on demand. Sets are never freed one by one, clear() resets every pool at once instead.
+        class Allocator {
+           public:
+            struct Statistics {
+                std::uint32_t PoolCount;
+                std::uint32_t FullPoolCount;
+                std::uint32_t SetCapacity;
+                std::uint32_t AllocatedSets;
+                std::uint32_t PeakAllocatedSets;
+                std::uint32_t GrowCount;
+            };
+
+            static constexpr std::uint32_t MAX_SETS_PER_POOL = 4096u;
+
+           public:
+            Allocator()  = default;
+            ~Allocator() = default;
+
+            void init(
+                std::uint32_t                                        initialSets,
+                const vk::ArrayProxy<DescriptorPool::PoolSizeRatio> &poolSizeRatios,
+                const vk::Device                                    &device);
+            void clear();
+            void release();
+
+            vk::DescriptorSet allocate(const vk::DescriptorSetLayout &layout, const void *next = nullptr);
+
+            Statistics getStatistics() const;
+
+           private:
+            std::vector<DescriptorPool::PoolSizeRatio> m_PoolSizeRatios;
+            std::vector<vk::DescriptorPool>            m_ReadyPools;
+            std::vector<vk::DescriptorPool>            m_FullPools;
+            std::uint32_t                              m_SetsPerPool{0u};
+            std::uint32_t                              m_SetCapacity{0u};
+            std::uint32_t                              m_AllocatedSets{0u};
+            std::uint32_t                              m_PeakAllocatedSets{0u};
+            std::uint32_t                              m_GrowCount{0u};
+            vk::Device                                 m_Device;
+
+           private:
+            vk::DescriptorPool acquirePool();
+            vk::DescriptorPool createPool(std::uint32_t setCount);
+        };
+
+        // Returns the same set for the same layout and contents, written only once. Entries not asked for in
+        // MAX_UNUSED_FRAMES calls to update() are evicted, sets of evicted and invalidated entries are reused once
+        // FramesInFlight calls to update() have passed. Initialized caches are registered, InvalidateAll() is called by the
+        // paths destroying buffers, image views and samplers so a later handle with the same value never hits a stale set.
+        // Those paths may run on any thread, every member locks the cache.
+        class Cache {
+           public:
+            struct Statistics {
+                std::uint64_t Hits;
+                std::uint64_t Misses;
+                std::uint64_t Invalidations;
+                std::uint64_t Evictions;
+                std::uint32_t EntryCount;
+            };
+
+            static constexpr std::uint32_t MAX_UNUSED_FRAMES = 240u;
+
+           public:
+            static void InvalidateAll(const vk::Buffer &buffer);
+            static void InvalidateAll(const vk::ImageView &view);
+            static void InvalidateAll(const vk::Sampler &sampler);
+
+            Cache()  = default;
+            ~Cache() = default;
+
+            Cache(const Cache &)            = delete;
+            Cache &operator=(const Cache &) = delete;
+
+            void init(
+                std::uint32_t                                        framesInFlight,
+                std::uint32_t                                        initialSets,
+                const vk::ArrayProxy<DescriptorPool::PoolSizeRatio> &poolSizeRatios,
+                const vk::Device                                    &device);
+            void update();
+            void release();
+
+            // The binder must only hold bindings added without an explicit set.
+            vk::DescriptorSet get(const vk::DescriptorSetLayout &layout, const Binder &binder);
+
+            void invalidate(const vk::Buffer &buffer);
+            void invalidate(const vk::ImageView &view);
+            void invalidate(const vk::Sampler &sampler);
+
+            Statistics getStatistics() const;
+
+           private:
+            struct Entry {
+                vk::DescriptorSetLayout Layout;
+                Binder                  Contents;
+                vk::DescriptorSet       Set;
+                std::uint64_t           LastUsedFrame;
+            };
+
+            struct Retired {
+                vk::DescriptorSetLayout Layout;
+                vk::DescriptorSet       Set;
+                std::uint64_t           Frame;
+            };
+
+           private:
+            Allocator                                                                 m_Allocator;
+            std::unordered_map<std::uint64_t, Entry>                                  m_Entries;
+            std::unordered_map<VkDescriptorSetLayout, std::vector<vk::DescriptorSet>> m_FreeSets;
+            std::deque<Retired>                                                       m_Retired;
+            std::uint32_t                                                             m_FramesInFlight{0u};
+            std::uint64_t                                                             m_Frame{0u};
+            std::uint64_t                                                             m_Hits{0u};
+            std::uint64_t                                                             m_Misses{0u};
+            std::uint64_t                                                             m_Invalidations{0u};
+            std::uint64_t                                                             m_Evictions{0u};
+            vk::Device                                                                m_Device;
+            mutable std::mutex                                                        m_Mutex;
+
+            static std::vector<Cache *> g_Caches;
+            static std::mutex           g_CachesMutex;
+
+           private:
+            template <typename Handle>
+            static void InvalidateRegistered(const Handle &handle);
+
+            template <typename Predicate>
+            void invalidateIf(const Predicate &predicate);
+            void retire(const Entry &entry);
+        };
+
+        void UpdateWithTemplate(
+            const vk::DescriptorSet            &set,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const void                         *data,
+            const vk::Device                   &device);
+        void PushWithTemplate(
+            const vk::CommandBuffer            &commandBuffer,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const vk::PipelineLayout           &layout,
+            std::uint32_t                       set,
+            const void                         *data);
+
+        template <typename T>
+        void UpdateWithTemplate(
+            const vk::DescriptorSet            &set,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const T                            &data,
+            const vk::Device                   &device) {
+            static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>, "Template data must be a packed POD struct");
+            UpdateWithTemplate(set, updateTemplate, static_cast<const void *>(&data), device);
+        }
+
+        template <typename T>
+        void PushWithTemplate(
+            const vk::CommandBuffer            &commandBuffer,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const vk::PipelineLayout           &layout,
+            std::uint32_t                       set,
+            const T                            &data) {
+            static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>, "Template data must be a packed POD struct");
+            PushWithTemplate(commandBuffer, updateTemplate, layout, set, static_cast<const void *>(&data));
+        }
+
         vk::DescriptorSet Allocate(
             const vk::DescriptorPool      &pool,
             const vk::DescriptorSetLayout &layout,
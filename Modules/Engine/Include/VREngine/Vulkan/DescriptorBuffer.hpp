@@ -0,0 +1,142 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+
+namespace vre::Vulkan {
+    // VK_EXT_descriptor_buffer backend: sets are offsets into two mapped buffers, without pools or vk::DescriptorSet.
+    // Layouts must come from CreateLayout() and pipelines need vk::PipelineCreateFlagBits::eDescriptorBufferEXT.
+    class DescriptorBuffer {
+       public:
+        struct Settings {
+            std::uint64_t ResourceSize{std::uint64_t(4u) << 20};
+            std::uint64_t ResourceFrameSize{std::uint64_t(1u) << 20};
+            std::uint64_t SamplerSize{std::uint64_t(64u) << 10};
+            std::uint64_t SamplerFrameSize{std::uint64_t(64u) << 10};
+            std::uint32_t FramesInFlight{3u};
+        };
+
+        struct Set {
+            vk::DescriptorSetLayout     Layout;
+            std::uint32_t               BufferIndex;
+            std::uint64_t               Offset;
+            std::byte                  *Data;
+            OffsetAllocator::Allocation Allocation;
+        };
+
+        static constexpr std::uint32_t RESOURCE_BUFFER_INDEX = 0u;
+        static constexpr std::uint32_t SAMPLER_BUFFER_INDEX  = 1u;
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        // Replaces the flags of the builder. Layouts with samplers go to the sampler buffer, every other layout to the resource buffer.
+        static vk::DescriptorSetLayout CreateLayout(DescriptorLayout::Builder &builder, vk::ShaderStageFlags stageFlags);
+        static vk::DescriptorSetLayout CreateLayout(DescriptorLayout::Builder &builder);
+        static void                    DestroyLayout(const vk::DescriptorSetLayout &layout);
+
+        // Must only be called once the fence of the frame that last used this partition has signaled.
+        static void BeginFrame(std::uint32_t frameIndex);
+        static void EndFrame();
+
+        // Persistent sets live until freed and are reused after FramesInFlight frames, frame sets until their partition comes back.
+        static Set  Allocate(const vk::DescriptorSetLayout &layout);
+        static Set  AllocateFrame(const vk::DescriptorSetLayout &layout);
+        static void Free(const Set &set);
+
+        // Writes copy straight into mapped memory, so any thread may write as long as no two threads write the same set.
+        static void WriteUniformBuffer(const Set &set, std::uint32_t binding, const Buffer::Allocation &buffer);
+        static void WriteStorageBuffer(const Set &set, std::uint32_t binding, const Buffer::Allocation &buffer);
+        static void WriteUniformBuffer(
+            const Set        &set,
+            std::uint32_t     binding,
+            vk::DeviceAddress address,
+            std::uint64_t     size);
+        static void WriteStorageBuffer(
+            const Set        &set,
+            std::uint32_t     binding,
+            vk::DeviceAddress address,
+            std::uint64_t     size);
+        static void WriteSampledImage(
+            const Set           &set,
+            std::uint32_t        binding,
+            const vk::ImageView &view,
+            vk::ImageLayout      layout);
+        static void WriteStorageImage(
+            const Set           &set,
+            std::uint32_t        binding,
+            const vk::ImageView &view,
+            vk::ImageLayout      layout);
+        static void WriteSampler(
+            const Set         &set,
+            std::uint32_t      binding,
+            const vk::Sampler &sampler);
+        static void WriteCombinedImageSampler(
+            const Set           &set,
+            std::uint32_t        binding,
+            const vk::ImageView &view,
+            vk::ImageLayout      layout,
+            const vk::Sampler   &sampler);
+
+        static void Bind(const vk::CommandBuffer &commandBuffer);
+        static void BindSet(
+            const vk::CommandBuffer  &commandBuffer,
+            vk::PipelineBindPoint     bindPoint,
+            const vk::PipelineLayout &layout,
+            std::uint32_t             setIndex,
+            const Set                &set);
+
+       private:
+        struct LayoutInfo {
+            std::uint64_t Size;
+            std::uint32_t BufferIndex;
+        };
+
+        struct Retired {
+            OffsetAllocator::Allocation Allocation;
+            std::uint64_t               Frame;
+        };
+
+        struct Heap {
+            Buffer::Allocation         Storage;
+            std::byte                 *Data{nullptr};
+            std::uint64_t              PersistentSize{0u};
+            std::uint64_t              FrameSize{0u};
+            std::uint64_t              FrameBase{0u};
+            std::atomic<std::uint64_t> FrameOffset{0u};
+            OffsetAllocator            Persistent;
+            std::deque<Retired>        Pending;
+        };
+
+       private:
+        static Settings                                              g_Settings;
+        static vk::Device                                            g_Device;
+        static vk::PhysicalDeviceDescriptorBufferPropertiesEXT       g_Properties;
+        static std::array<Heap, 2>                                   g_Heaps;
+        static std::unordered_map<VkDescriptorSetLayout, LayoutInfo> g_Layouts;
+        static std::mutex                                            g_Mutex;
+        static std::uint64_t                                         g_Frame;
+
+        static PFN_vkGetDescriptorSetLayoutSizeEXT          g_GetDescriptorSetLayoutSize;
+        static PFN_vkGetDescriptorSetLayoutBindingOffsetEXT g_GetDescriptorSetLayoutBindingOffset;
+        static PFN_vkGetDescriptorEXT                       g_GetDescriptor;
+        static PFN_vkCmdBindDescriptorBuffersEXT            g_CmdBindDescriptorBuffers;
+        static PFN_vkCmdSetDescriptorBufferOffsetsEXT       g_CmdSetDescriptorBufferOffsets;
+
+        static bool             g_IsInitialized;
+        static DescriptorBuffer g_State;
+
+       private:
+        DescriptorBuffer() = default;
+        ~DescriptorBuffer();
+
+        static vk::DescriptorSetLayout RegisterLayout(const DescriptorLayout::Builder &builder, const vk::DescriptorSetLayout &layout);
+        static LayoutInfo              GetLayoutInfo(const vk::DescriptorSetLayout &layout);
+        static void                    Write(const Set &set, std::uint32_t binding, const vk::DescriptorGetInfoEXT &info, std::size_t size);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
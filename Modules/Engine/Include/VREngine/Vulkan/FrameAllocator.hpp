@@ -0,0 +1,71 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan {
+    class FrameAllocator {
+       public:
+        struct Settings {
+            std::uint64_t        FrameSize{std::uint64_t(16u) << 20};
+            std::uint32_t        FramesInFlight{3u};
+            vk::BufferUsageFlags UsageFlags{
+                vk::BufferUsageFlagBits::eUniformBuffer |
+                vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eVertexBuffer |
+                vk::BufferUsageFlagBits::eIndexBuffer |
+                vk::BufferUsageFlagBits::eShaderDeviceAddress};
+        };
+
+        struct Allocation {
+            vk::Buffer        Buffer;
+            std::uint64_t     Offset;
+            std::uint64_t     Size;
+            std::byte        *Data;
+            vk::DeviceAddress Address;
+        };
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        // Must only be called once the fence of the frame that last used this partition has signaled.
+        static void BeginFrame(std::uint32_t frameIndex);
+        static void EndFrame();
+
+        static Allocation Allocate(std::uint64_t size, std::uint64_t alignment);
+        static Allocation AllocateUniform(std::uint64_t size);
+        static Allocation AllocateStorage(std::uint64_t size);
+        static Allocation AllocateVertex(std::uint64_t size);
+
+        template <typename T>
+        static Allocation PushUniform(const T &value) {
+            Allocation allocation = AllocateUniform(sizeof(T));
+            std::memcpy(allocation.Data, &value, sizeof(T));
+            return allocation;
+        }
+
+        static vk::Buffer    GetBuffer();
+        static std::uint64_t GetFrameUsage();
+
+       private:
+        static Settings                   g_Settings;
+        static Buffer::Allocation         g_Buffer;
+        static std::byte                 *g_Data;
+        static std::uint64_t              g_FrameStride;
+        static std::uint64_t              g_FrameBase;
+        static std::uint64_t              g_UniformAlignment;
+        static std::uint64_t              g_StorageAlignment;
+        static std::atomic<std::uint64_t> g_Offset;
+
+        static bool           g_IsInitialized;
+        static FrameAllocator g_State;
+
+       private:
+        FrameAllocator() = default;
+        ~FrameAllocator();
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
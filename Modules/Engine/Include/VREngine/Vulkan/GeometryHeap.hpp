@@ -0,0 +1,118 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+#include <VREngine/Vulkan/UploadContext.hpp>
+#include <VREngine/Vulkan/Defragmenter.hpp>
+
+namespace vre::Vulkan {
+    // Shared vertex and index buffers for many meshes, so that a whole scene draws with a single buffer bind. The buffers are
+    // registered with vre::Vulkan::Defragmenter when it is initialized, the owner forwards BufferMovedEvent to onBufferMoved().
+    class GeometryHeap {
+       public:
+        struct Settings {
+            std::uint32_t VertexStride{0u};
+            std::uint32_t VertexCapacity{1u << 20};
+            std::uint32_t IndexCapacity{3u << 20};
+            vk::IndexType IndexType{vk::IndexType::eUint32};
+            std::uint32_t MaxMeshes{16u * 1024u};
+            std::uint32_t FramesInFlight{3u};
+        };
+
+        struct Mesh {
+            std::int32_t  VertexOffset;
+            std::uint32_t VertexCount;
+            std::uint32_t FirstIndex;
+            std::uint32_t IndexCount;
+        };
+
+        struct Statistics {
+            std::uint32_t VertexCapacity;
+            std::uint32_t VertexUsed;
+            std::uint32_t VertexLargestFreeRegion;
+            std::uint32_t IndexCapacity;
+            std::uint32_t IndexUsed;
+            std::uint32_t IndexLargestFreeRegion;
+            std::uint32_t MeshCount;
+            float         Fragmentation;
+        };
+
+        using MeshId             = std::uint32_t;
+        using RelocationCallback = std::function<void(MeshId, const Mesh &)>;
+
+        static constexpr MeshId INVALID_MESH = 0xFFFFFFFFu;
+
+       public:
+        static GeometryHeap Create(const Settings &settings);
+
+        GeometryHeap() = default;
+
+        // Returns INVALID_MESH once either buffer has no region left that is large enough.
+        MeshId                allocate(std::uint32_t vertexCount, std::uint32_t indexCount);
+        UploadContext::Ticket upload(MeshId mesh, const void *vertices, const void *indices);
+        // The ranges stay valid until FramesInFlight calls to update() have passed.
+        void free(MeshId mesh);
+        void update();
+
+        const Mesh &getMesh(MeshId mesh) const;
+        Statistics  getStatistics() const;
+
+        void bind(const vk::CommandBuffer &commandBuffer) const;
+        void draw(const vk::CommandBuffer &commandBuffer, MeshId mesh, std::uint32_t instanceCount = 1u, std::uint32_t firstInstance = 0u) const;
+
+        // Repacks every live mesh to the front of new buffers, the old ones are released once no frame uses them anymore.
+        // Ids are kept, only their offsets change, which the relocation callback is told about.
+        bool compact(const vk::CommandBuffer &commandBuffer);
+        void setRelocationCallback(const RelocationCallback &callback);
+        void onBufferMoved(const BufferMovedEvent &event);
+
+        const Buffer::Allocation &getVertexBuffer() const;
+        const Buffer::Allocation &getIndexBuffer() const;
+
+        void release();
+
+       private:
+        struct Entry {
+            Mesh                        Range;
+            OffsetAllocator::Allocation VertexAllocation;
+            OffsetAllocator::Allocation IndexAllocation;
+            bool                        IsAlive{false};
+        };
+
+        struct PendingFree {
+            OffsetAllocator::Allocation VertexAllocation;
+            OffsetAllocator::Allocation IndexAllocation;
+            MeshId                      Id;
+            std::uint64_t               Frame;
+        };
+
+        struct PendingRelease {
+            Buffer::Allocation Target;
+            std::uint64_t      Frame;
+        };
+
+       private:
+        Settings m_Settings;
+
+        Buffer::Allocation m_VertexBuffer;
+        Buffer::Allocation m_IndexBuffer;
+        std::uint32_t      m_IndexSize{0u};
+        bool               m_IsDefragmented{false};
+
+        OffsetAllocator m_VertexAllocator;
+        OffsetAllocator m_IndexAllocator;
+
+        std::vector<Entry>         m_Entries;
+        std::vector<MeshId>        m_FreeIds;
+        std::uint32_t              m_MeshCount{0u};
+        std::deque<PendingFree>    m_PendingFrees;
+        std::deque<PendingRelease> m_PendingReleases;
+        std::uint64_t              m_Frame{0u};
+        UploadContext::Ticket      m_LastUploadTicket{UploadContext::INVALID_TICKET};
+        RelocationCallback         m_RelocationCallback;
+
+       private:
+        Buffer::Allocation allocateBuffer(std::uint64_t size, vk::BufferUsageFlags usageFlags) const;
+        void               releaseBuffer(const Buffer::Allocation &buffer) const;
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -13,6 +13,12 @@ namespace vre::Vulkan::Image {
         const vk::CommandBuffer &commandBuffer,
         const Allocation        &image,
         vk::ImageLayout          newLayout);
+    void TransitionLayout(
+        const vk::CommandBuffer         &commandBuffer,
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout);
     void TransitionLayout(
         const vk::CommandBuffer &commandBuffer,
         const vk::Image         &image,
@@ -23,11 +29,28 @@ namespace vre::Vulkan::Image {
         const vk::Image         &image,
         vk::ImageLayout          newLayout);
 
+    vk::ImageMemoryBarrier2 GetOwnershipBarrier(
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout,
+        std::uint32_t                    sourceQueueFamilyIndex,
+        std::uint32_t                    destinationQueueFamilyIndex);
+    void TransferOwnership(
+        const vk::CommandBuffer         &commandBuffer,
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout,
+        std::uint32_t                    sourceQueueFamilyIndex,
+        std::uint32_t                    destinationQueueFamilyIndex);
+
     void Release(const Allocation &image);
 
     vk::ImageSubresourceRange GetSubresourceRange(vk::ImageAspectFlags aspectFlags);
     vk::ImageSubresourceRange GetColorRange();
     vk::ImageSubresourceRange GetDepthRange();
+    vk::ImageSubresourceRange GetColorMipRange(std::uint32_t baseMipLevel, std::uint32_t mipLevelCount);
 
     vk::ImageCreateInfo GetCreateInfo(
         vk::Format          format,
@@ -70,6 +93,14 @@ namespace vre::Vulkan::Image {
         vk::ImageUsageFlags      usageFlags,
         const vk::Extent2D      &extent,
         const VmaAllocator      &allocator);
+    Allocation Allocate(
+        VmaAllocationCreateFlags vmaFlags,
+        vk::MemoryPropertyFlags  memoryFlags,
+        vk::Format               format,
+        vk::ImageUsageFlags      usageFlags,
+        const vk::Extent2D      &extent,
+        std::uint32_t            mipLevels,
+        const VmaAllocator      &allocator);
     Allocation Allocate(
         vk::MemoryPropertyFlags memoryFlags,
         vk::Format              format,
@@ -83,11 +114,24 @@ namespace vre::Vulkan::Image {
         const vk::Extent2D     &extent,
         const VmaAllocator     &allocator);
 
+    std::optional<Allocation> TryAllocate(
+        VmaAllocationCreateFlags vmaFlags,
+        vk::MemoryPropertyFlags  memoryFlags,
+        vk::Format               format,
+        vk::ImageUsageFlags      usageFlags,
+        const vk::Extent2D      &extent,
+        std::uint32_t            mipLevels,
+        const VmaAllocator      &allocator);
+
     vk::ImageView CreateView(
         const Allocation    &image,
         vk::ImageAspectFlags aspectFlags,
         const vk::Device    &device);
     vk::ImageView CreateColorView(const Allocation &image, const vk::Device &device);
+    vk::ImageView CreateColorView(
+        const Allocation &image,
+        std::uint32_t     baseMipLevel,
+        const vk::Device &device);
     vk::ImageView CreateDepthView(const Allocation &image, const vk::Device &device);
     vk::ImageView CreateView3D(
         const vk::Image     &image,
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/MeshAsset.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+#include <VREngine/Vulkan/UploadContext.hpp>
+
+namespace vre::Vulkan {
+    // Draws a mesh built into meshlets with per-meshlet frustum and normal cone culling. The mesh shader path culls in the
+    // task shader of Meshlet.slang, the compute path writes one indexed indirect draw per meshlet with MeshletCull.slang.
+    class MeshletRenderer {
+       public:
+        enum class Path {
+            eMeshShader,
+            eComputeCull,
+        };
+
+        struct Settings {
+            vk::Format    ColorFormat{vk::Format::eUndefined};
+            vk::Format    DepthFormat{vk::Format::eUndefined};
+            std::uint32_t FramesInFlight{3u};
+            fs::path      ShaderDirectory{fs::path("Assets") / fs::path("Shaders")};
+        };
+
+        struct Camera {
+            glm::mat4 ViewProjection{1.0f};
+            glm::mat4 Model{1.0f};
+            glm::vec3 Position{0.0f};
+        };
+
+       public:
+        static MeshletRenderer Create(const Settings &settings, const MeshAsset &mesh);
+
+        static bool IsPathSupported(Path path);
+
+        MeshletRenderer() = default;
+
+        void setPath(Path path);
+        Path getPath() const;
+
+        std::uint32_t getMeshletCount() const;
+        bool          isReady() const;
+
+        // Must be recorded outside of rendering, draw() with the same frame index then renders inside of it.
+        void cull(const vk::CommandBuffer &commandBuffer, std::uint32_t frameIndex, const Camera &camera);
+        void draw(const vk::CommandBuffer &commandBuffer, std::uint32_t frameIndex) const;
+
+        void release();
+
+       private:
+        // Matches MeshletScene in Meshlet.slangh with std140 layout, the trailing uint3 starts on its own 16 bytes.
+        struct Scene {
+            glm::mat4     ViewProjection;
+            glm::mat4     Model;
+            glm::vec4     CameraPosition;
+            std::uint32_t MeshletCount;
+            std::uint32_t Padding[7];
+        };
+
+        struct Frame {
+            Buffer::Allocation SceneBuffer;
+            std::byte         *SceneData{nullptr};
+            Buffer::Allocation DrawCommands;
+            vk::DescriptorSet  Set;
+        };
+
+       private:
+        Settings m_Settings;
+        Path     m_Path{Path::eComputeCull};
+
+        Buffer::Allocation m_Vertices;
+        Buffer::Allocation m_Indices;
+        Buffer::Allocation m_Meshlets;
+        Buffer::Allocation m_MeshletVertices;
+        Buffer::Allocation m_MeshletTriangles;
+        std::uint32_t      m_MeshletCount{0u};
+        std::uint32_t      m_MaxDrawIndirectCount{1u};
+
+        UploadContext::Ticket m_UploadTicket{UploadContext::INVALID_TICKET};
+
+        vk::DescriptorSetLayout  m_SetLayout;
+        vk::PipelineLayout       m_PipelineLayout;
+        vk::Pipeline             m_MeshPipeline;
+        vk::Pipeline             m_CullPipeline;
+        vk::Pipeline             m_IndirectPipeline;
+        DescriptorSet::Allocator m_Descriptors;
+        std::vector<Frame>       m_Frames;
+
+       private:
+        Buffer::Allocation upload(const void *data, std::uint64_t size, vk::BufferUsageFlags usageFlags);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+
+namespace vre::Vulkan {
+    // Hands out one shared handle per unique create info. Every Acquire*() must be paired with a Release(), objects without
+    // references are destroyed once FramesInFlight calls to Update() have passed unless they are acquired again before that.
+    class ObjectCache {
+       public:
+        struct Settings {
+            std::uint32_t FramesInFlight{3u};
+        };
+
+        struct Statistics {
+            std::uint32_t SamplerCount;
+            std::uint32_t ImageViewCount;
+            std::uint32_t DescriptorSetLayoutCount;
+            std::uint32_t PipelineLayoutCount;
+            std::uint64_t Hits;
+            std::uint64_t Misses;
+        };
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        // Create infos with a pNext chain cannot be cached.
+        static vk::Sampler             AcquireSampler(const vk::SamplerCreateInfo &info);
+        static vk::ImageView           AcquireImageView(const vk::ImageViewCreateInfo &info);
+        static vk::DescriptorSetLayout AcquireDescriptorSetLayout(const DescriptorLayout::Builder &builder);
+        static vk::DescriptorSetLayout AcquireDescriptorSetLayout(
+            vk::DescriptorSetLayoutCreateFlags                    flags,
+            const vk::ArrayProxy<vk::DescriptorSetLayoutBinding> &bindings);
+        static vk::PipelineLayout AcquirePipelineLayout(const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts);
+        static vk::PipelineLayout AcquirePipelineLayout(
+            const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts,
+            const vk::ArrayProxy<vk::PushConstantRange>   &pushConstants);
+
+        static void Release(const vk::Sampler &sampler);
+        static void Release(const vk::ImageView &view);
+        static void Release(const vk::DescriptorSetLayout &layout);
+        static void Release(const vk::PipelineLayout &layout);
+        static void Update();
+
+        // Image handles are reused once destroyed, so views cached for an image must be dropped before it is destroyed.
+        // Views still referenced are destroyed FramesInFlight frames later as well.
+        static void Invalidate(const vk::Image &image);
+
+        static Statistics GetStatistics();
+
+       private:
+        // Immutable samplers are copied by handle and the pImmutableSamplers of the bindings are left null, so layouts
+        // compare by the samplers they hold instead of by the address the caller kept them at.
+        struct DescriptorSetLayoutInfo {
+            vk::DescriptorSetLayoutCreateFlags          Flags;
+            std::vector<vk::DescriptorSetLayoutBinding> Bindings;
+            std::vector<std::vector<vk::Sampler>>       ImmutableSamplers;
+
+            bool operator==(const DescriptorSetLayoutInfo &other) const = default;
+        };
+
+        struct PipelineLayoutInfo {
+            std::vector<vk::DescriptorSetLayout> SetLayouts;
+            std::vector<vk::PushConstantRange>   PushConstants;
+
+            bool operator==(const PipelineLayoutInfo &other) const = default;
+        };
+
+        template <typename Handle, typename Description>
+        struct Table {
+            struct Entry {
+                Description   Info;
+                Handle        Object;
+                std::uint32_t References;
+                std::uint64_t ReleaseFrame;
+            };
+
+            std::unordered_multimap<std::uint64_t, Entry>             Entries;
+            std::unordered_map<typename Handle::CType, std::uint64_t> Hashes;
+            std::vector<Handle>                                       Unreferenced;
+            std::vector<std::pair<Handle, std::uint64_t>>             Invalidated;
+        };
+
+       private:
+        static Settings                                                g_Settings;
+        static vk::Device                                              g_Device;
+        static Table<vk::Sampler, vk::SamplerCreateInfo>               g_Samplers;
+        static Table<vk::ImageView, vk::ImageViewCreateInfo>           g_ImageViews;
+        static Table<vk::DescriptorSetLayout, DescriptorSetLayoutInfo> g_DescriptorSetLayouts;
+        static Table<vk::PipelineLayout, PipelineLayoutInfo>           g_PipelineLayouts;
+        static std::uint64_t                                           g_Frame;
+        static std::uint64_t                                           g_Hits;
+        static std::uint64_t                                           g_Misses;
+        static std::mutex                                              g_Mutex;
+
+        static bool        g_IsInitialized;
+        static ObjectCache g_State;
+
+       private:
+        ObjectCache() = default;
+        ~ObjectCache();
+
+        static DescriptorSetLayoutInfo GetDescriptorSetLayoutInfo(
+            vk::DescriptorSetLayoutCreateFlags                    flags,
+            const vk::ArrayProxy<vk::DescriptorSetLayoutBinding> &bindings);
+
+        static std::uint64_t HashInfo(const vk::SamplerCreateInfo &info);
+        static std::uint64_t HashInfo(const vk::ImageViewCreateInfo &info);
+        static std::uint64_t HashInfo(const DescriptorSetLayoutInfo &info);
+        static std::uint64_t HashInfo(const PipelineLayoutInfo &info);
+
+        static vk::Sampler             CreateObject(const vk::SamplerCreateInfo &info);
+        static vk::ImageView           CreateObject(const vk::ImageViewCreateInfo &info);
+        static vk::DescriptorSetLayout CreateObject(const DescriptorSetLayoutInfo &info);
+        static vk::PipelineLayout      CreateObject(const PipelineLayoutInfo &info);
+
+        template <typename Handle, typename Description>
+        static Handle Acquire(Table<Handle, Description> &table, const Description &info);
+        template <typename Handle, typename Description>
+        static void Release(Table<Handle, Description> &table, const Handle &handle);
+        template <typename Handle, typename Description>
+        static void Collect(Table<Handle, Description> &table);
+        template <typename Handle, typename Description>
+        static void Clear(Table<Handle, Description> &table, const char *name);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
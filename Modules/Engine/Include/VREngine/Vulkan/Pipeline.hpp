@@ -15,6 +15,12 @@ namespace vre::Vulkan {
     }  // namespace PipelineLayout
 
     namespace ComputePipeline {
+        vk::Pipeline Create(
+            vk::PipelineCreateFlags   flags,
+            const std::string        &entry,
+            const vk::ShaderModule   &module,
+            const vk::PipelineLayout &layout,
+            const vk::Device         &device);
         vk::Pipeline Create(
             const std::string        &entry,
             const vk::ShaderModule   &module,
@@ -30,9 +36,12 @@ namespace vre::Vulkan {
 
             void clear();
 
+            Builder &setFlags(vk::PipelineCreateFlags flags);
             Builder &setShaders(const std::vector<Shader::StageInfo> &shaders);
             Builder &setVertexShader(const std::string &entry, const vk::ShaderModule &shader);
             Builder &setFragmentShader(const std::string &entry, const vk::ShaderModule &shader);
+            Builder &setTaskShader(const std::string &entry, const vk::ShaderModule &shader);
+            Builder &setMeshShader(const std::string &entry, const vk::ShaderModule &shader);
             Builder &setVertexLayouts(const std::vector<VertexLayout> &layouts);
             Builder &setVertexLayout(const VertexLayout &layout);
             Builder &setInputTopology(vk::PrimitiveTopology topology);
@@ -61,6 +70,7 @@ namespace vre::Vulkan {
             vk::PipelineDepthStencilStateCreateInfo          m_DepthStencil;
             vk::PipelineRenderingCreateInfo                  m_RenderingInfo;
             std::vector<vk::Format>                          m_ColorAttachmentFormats;
+            vk::PipelineCreateFlags                          m_Flags;
         };
     }  // namespace GraphicsPipeline
 }  // namespace vre::Vulkan
\ No newline at end of file
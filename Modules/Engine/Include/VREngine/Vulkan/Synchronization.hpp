@@ -19,6 +19,10 @@ namespace vre::Vulkan {
 
         vk::Semaphore Create(vk::SemaphoreCreateFlags flags, const vk::Device &device);
         vk::Semaphore Create(const vk::Device &device);
+        vk::Semaphore CreateTimeline(std::uint64_t initialValue, const vk::Device &device);
+
+        std::uint64_t GetValue(const vk::Semaphore &semaphore, const vk::Device &device);
+        void          Wait(std::uint64_t value, const vk::Semaphore &semaphore, const vk::Device &device);
 
         vk::SemaphoreSubmitInfo GetSubmitInfo(
             std::uint64_t           value,
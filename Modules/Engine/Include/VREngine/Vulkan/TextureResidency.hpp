@@ -0,0 +1,149 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Assets/TextureAsset.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan {
+    class TextureResidency {
+       public:
+        struct Settings {
+            std::uint64_t BudgetBytes{0u};
+            float         BudgetFraction{0.8f};
+            std::uint32_t LowMipSize{64u};
+            std::uint32_t FramesInFlight{3u};
+            std::uint32_t MaxUploadsPerFrame{4u};
+            std::uint32_t RetryDelayFrames{120u};
+            std::uint32_t MaxTextures{4096u};
+            bool          EnableFeedback{true};
+            vk::Format    Format{vk::Format::eR8G8B8A8Unorm};
+        };
+
+        struct Feedback {
+            std::uint32_t Width;
+            std::uint32_t Height;
+            std::uint32_t ResidentMip;
+            std::uint32_t RequestedMip;
+        };
+
+        enum class Residency : std::uint8_t {
+            eEvicted,
+            eLowMip,
+            eResident,
+        };
+
+        using TextureId = std::uint32_t;
+
+        static constexpr TextureId     INVALID_TEXTURE  = std::numeric_limits<TextureId>::max();
+        static constexpr std::uint32_t FEEDBACK_NONE    = 0xFFFFFFFFu;
+        static constexpr std::uint32_t FEEDBACK_UNKNOWN = 0xFFFFFFFEu;
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        static TextureId Register(const fs::path &path);
+        static void      Unregister(TextureId texture);
+
+        static vk::ImageView Request(TextureId texture);
+        static vk::ImageView Request(TextureId texture, std::uint32_t desiredMip);
+        static void          Update();
+
+        static Residency                 GetResidency(TextureId texture);
+        static std::uint32_t             GetResidentMip(TextureId texture);
+        static bool                      IsLoading(TextureId texture);
+        static vk::ImageView             GetPlaceholderView();
+        static const Buffer::Allocation &GetFeedbackBuffer();
+        static std::uint64_t             GetBudget();
+        static std::uint64_t             GetUsage();
+
+       private:
+        struct Texture {
+            std::string                              Path;
+            bool                                     IsRegistered{false};
+            bool                                     IsLoading{false};
+            bool                                     IsUploading{false};
+            bool                                     IsDemoting{false};
+            bool                                     IsFailed{false};
+            std::uint64_t                            LastUsedFrame{0u};
+            std::uint64_t                            RetryFrame{0u};
+            std::uint32_t                            Width{0u};
+            std::uint32_t                            Height{0u};
+            std::uint32_t                            MipCount{0u};
+            std::uint32_t                            LowMip{0u};
+            std::uint32_t                            DesiredMip{FEEDBACK_NONE};
+            std::uint32_t                            ImageMip{0u};
+            std::uint32_t                            ResidentMip{FEEDBACK_NONE};
+            std::vector<std::byte>                   LowMipData;
+            std::vector<std::byte>                   MipData;
+            Vulkan::Image::Allocation                Image{};
+            vk::ImageView                            View;
+            std::uint64_t                            Size{0u};
+            std::future<std::optional<TextureAsset>> Pending;
+        };
+
+        struct Swap {
+            TextureId                 Texture;
+            Vulkan::Image::Allocation Image;
+            std::uint32_t             ImageMip;
+            std::uint32_t             ResidentMip;
+            std::uint64_t             Size;
+        };
+
+        struct Submission {
+            vk::CommandBuffer               CommandBuffer;
+            vk::Fence                       Fence;
+            std::vector<Buffer::Allocation> Staging;
+            std::vector<Swap>               Swaps;
+        };
+
+        struct Garbage {
+            std::uint64_t             Frame;
+            Vulkan::Image::Allocation Image;
+            vk::ImageView             View;
+        };
+
+       private:
+        static Settings                        g_Settings;
+        static std::vector<Texture>            g_Textures;
+        static std::vector<TextureId>          g_FreeTextures;
+        static std::vector<Submission>         g_InFlight;
+        static std::vector<Submission>         g_FreeSubmissions;
+        static Submission                      g_Current;
+        static std::vector<Garbage>            g_Garbage;
+        static std::vector<Buffer::Allocation> g_FeedbackBuffers;
+        static vk::CommandPool                 g_CommandPool;
+        static Image::Allocation               g_Placeholder;
+        static vk::ImageView                   g_PlaceholderView;
+        static std::uint64_t                   g_FrameIndex;
+        static std::uint64_t                   g_Usage;
+        static std::uint64_t                   g_PendingRelease;
+
+        static bool             g_IsInitialized;
+        static TextureResidency g_State;
+
+       private:
+        TextureResidency() = default;
+        ~TextureResidency();
+
+        static void StartLoad(Texture &texture);
+        static void OnLoaded(TextureId texture, TextureAsset &asset);
+        static bool Promote(TextureId texture, std::uint32_t imageMip, std::uint32_t firstMip, const std::byte *data, bool makeRoom);
+        static void Stream(TextureId texture, std::uint32_t mip);
+        static bool MakeRoom(std::uint64_t required, TextureId exclude);
+        static void Evict(TextureId texture);
+        static void ReleaseImage(Texture &texture);
+        static void TryFree(TextureId texture);
+
+        static void Upload(const Image::Allocation &image, std::uint32_t firstMipLevel, std::uint32_t mipLevelCount, const void *data, std::uint64_t size);
+        static void ReadFeedback();
+        static void WriteFeedback();
+        static void BeginSubmission();
+        static void EndSubmission();
+        static void RetireSubmissions();
+        static void CollectGarbage(bool force);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -8,6 +8,7 @@ namespace vre::Vulkan {
             vk::Image     Image;
             vk::Extent3D  Extent;
             vk::Format    Format;
+            std::uint32_t MipLevels{1u};
             VmaAllocation Allocation;
             VmaAllocator  Allocator;
         };
@@ -20,6 +21,7 @@ namespace vre::Vulkan {
             std::uint64_t        Size;
             VmaAllocation        Allocation;
             VmaAllocator         Allocator;
+            vk::DeviceAddress    Address{0u};
         };
     }  // namespace Buffer
 
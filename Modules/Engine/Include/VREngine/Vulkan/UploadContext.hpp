@@ -0,0 +1,98 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan {
+    class UploadContext {
+       public:
+        struct Settings {
+            std::uint64_t RingSize{std::uint64_t(64u) << 20};
+            std::uint64_t Alignment{16u};
+        };
+
+        using Ticket = std::uint64_t;
+
+        static constexpr Ticket INVALID_TICKET = 0u;
+
+       public:
+        static void Initialize(const Settings &settings);
+        static void Initialize();
+        static void Shutdown();
+
+        static bool IsInitialized();
+
+        // Copies are recorded into the pending batch. Its ticket completes once the batch has executed and, with a dedicated
+        // transfer queue, once the graphics queue has acquired the destinations, so they may only be used after that.
+        static Ticket UploadBuffer(const Buffer::Allocation &destination, std::uint64_t destinationOffset, const void *data, std::uint64_t size);
+        static Ticket UploadBuffer(const Buffer::Allocation &destination, const void *data, std::uint64_t size);
+        static Ticket UploadImage(const Image::Allocation &destination, std::uint32_t firstMipLevel, std::uint32_t mipLevelCount, const void *data, std::uint64_t size);
+        static Ticket UploadImage(const Image::Allocation &destination, const void *data, std::uint64_t size);
+
+        static Ticket Flush();
+        static bool   IsComplete(Ticket ticket);
+        static void   Wait(Ticket ticket);
+        static void   Update();
+
+        static std::uint64_t GetRingUsage();
+
+       private:
+        struct BufferOwnership {
+            Buffer::Allocation Target;
+            std::uint64_t      Offset;
+            std::uint64_t      Size;
+        };
+
+        struct ImageOwnership {
+            Image::Allocation         Target;
+            vk::ImageSubresourceRange Range;
+        };
+
+        struct Submission {
+            vk::CommandBuffer               CommandBuffer;
+            vk::CommandBuffer               AcquireCommandBuffer;
+            std::uint64_t                   Id{INVALID_TICKET};
+            std::uint64_t                   RingEnd{0u};
+            std::vector<Buffer::Allocation> Staging;
+            std::vector<BufferOwnership>    Buffers;
+            std::vector<ImageOwnership>     Images;
+        };
+
+        struct Staging {
+            Buffer::Allocation Source;
+            std::uint64_t      Offset;
+        };
+
+       private:
+        static Settings                g_Settings;
+        static Buffer::Allocation      g_Ring;
+        static std::byte              *g_RingData;
+        static std::uint64_t           g_Head;
+        static std::uint64_t           g_Tail;
+        static std::deque<Submission>  g_InFlight;
+        static std::deque<Submission>  g_Acquiring;
+        static std::vector<Submission> g_FreeSubmissions;
+        static Submission              g_Current;
+        static vk::CommandPool         g_CommandPool;
+        static vk::CommandPool         g_AcquireCommandPool;
+        static vk::Semaphore           g_TransferTimeline;
+        static vk::Semaphore           g_AcquireTimeline;
+        static Ticket                  g_NextTicket;
+        static Ticket                  g_CompletedTicket;
+
+        static bool          g_IsInitialized;
+        static UploadContext g_State;
+
+       private:
+        UploadContext() = default;
+        ~UploadContext();
+
+        static Staging                      Stage(const void *data, std::uint64_t size, std::uint64_t alignment);
+        static std::optional<std::uint64_t> Reserve(std::uint64_t size, std::uint64_t alignment);
+        static void                         BeginSubmission();
+        static void                         RetireSubmissions(bool wait);
+        static void                         Acquire(Submission &submission);
+        static void                         Recycle(Submission &submission);
+        static void                         TransferOwnership(const vk::CommandBuffer &commandBuffer, const Submission &submission);
+    };
+}  // namespace vre::Vulkan
\ No newline at end of file
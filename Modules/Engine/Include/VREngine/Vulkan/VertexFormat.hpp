@@ -0,0 +1,151 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan {
+    namespace VertexAttribute {
+        struct Float2 {
+            using Source = glm::vec2;
+
+            static constexpr vk::Format    Format = vk::Format::eR32G32Sfloat;
+            static constexpr std::uint32_t Size   = 8u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Float3 {
+            using Source = glm::vec3;
+
+            static constexpr vk::Format    Format = vk::Format::eR32G32B32Sfloat;
+            static constexpr std::uint32_t Size   = 12u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Float4 {
+            using Source = glm::vec4;
+
+            static constexpr vk::Format    Format = vk::Format::eR32G32B32A32Sfloat;
+            static constexpr std::uint32_t Size   = 16u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Half2 {
+            using Source = glm::vec2;
+
+            static constexpr vk::Format    Format = vk::Format::eR16G16Sfloat;
+            static constexpr std::uint32_t Size   = 4u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Half4 {
+            using Source = glm::vec4;
+
+            static constexpr vk::Format    Format = vk::Format::eR16G16B16A16Sfloat;
+            static constexpr std::uint32_t Size   = 8u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Snorm16x4 {
+            using Source = glm::vec4;
+
+            static constexpr vk::Format    Format = vk::Format::eR16G16B16A16Snorm;
+            static constexpr std::uint32_t Size   = 8u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct OctahedralNormal {
+            using Source = glm::vec3;
+
+            static constexpr vk::Format    Format = vk::Format::eR16G16Snorm;
+            static constexpr std::uint32_t Size   = 4u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        struct Unorm8x4 {
+            using Source = glm::vec4;
+
+            static constexpr vk::Format    Format = vk::Format::eR8G8B8A8Unorm;
+            static constexpr std::uint32_t Size   = 4u;
+
+            static void Encode(const Source &value, std::byte *destination);
+        };
+
+        glm::vec2 EncodeOctahedral(const glm::vec3 &normal);
+        glm::vec3 DecodeOctahedral(const glm::vec2 &encoded);
+    }  // namespace VertexAttribute
+
+    template <typename... Attributes>
+    class VertexFormat {
+       public:
+        static constexpr std::uint32_t AttributeCount = sizeof...(Attributes);
+        static constexpr std::uint32_t Stride         = (Attributes::Size + ...);
+
+        static_assert(((Attributes::Size % 4u == 0u) && ...), "Vertex attributes must be 4 byte aligned");
+
+        struct Vertex {
+            std::array<std::byte, Stride> Data;
+        };
+
+        static_assert(sizeof(Vertex) == Stride);
+
+       public:
+        static Vertex Pack(const typename Attributes::Source &...values) {
+            Vertex        vertex{};
+            std::uint32_t attribute = 0u;
+            (Attributes::Encode(values, vertex.Data.data() + Offsets[attribute++]), ...);
+            return vertex;
+        }
+
+        static constexpr std::array<vk::VertexInputAttributeDescription, AttributeCount> GetAttributeDescriptions(
+            std::uint32_t binding       = 0u,
+            std::uint32_t firstLocation = 0u) {
+            std::array<vk::VertexInputAttributeDescription, AttributeCount> descriptions{};
+            std::uint32_t                                                   attribute = 0u;
+            ((descriptions[attribute] = vk::VertexInputAttributeDescription{
+                  firstLocation + attribute,
+                  binding,
+                  Attributes::Format,
+                  Offsets[attribute],
+              },
+              attribute++),
+             ...);
+            return descriptions;
+        }
+
+        static VertexLayout GetLayout(std::uint32_t binding = 0u, std::uint32_t firstLocation = 0u) {
+            std::array<vk::VertexInputAttributeDescription, AttributeCount> descriptions =
+                GetAttributeDescriptions(binding, firstLocation);
+            return VertexLayout{
+                vk::VertexInputBindingDescription{
+                    binding,
+                    Stride,
+                    vk::VertexInputRate::eVertex,
+                },
+                {descriptions.begin(), descriptions.end()},
+            };
+        }
+
+       private:
+        static constexpr std::array<std::uint32_t, AttributeCount> Offsets = [] {
+            std::array<std::uint32_t, AttributeCount> offsets{};
+            std::uint32_t                             attribute = 0u;
+            std::uint32_t                             offset    = 0u;
+            ((offsets[attribute++] = offset, offset += Attributes::Size), ...);
+            return offsets;
+        }();
+    };
+
+    namespace IndexFormat {
+        vk::IndexType SelectType(std::uint32_t vertexCount);
+        std::uint32_t GetSize(vk::IndexType type);
+
+        std::vector<std::byte> Pack(std::span<const std::uint32_t> indices, vk::IndexType type);
+    }  // namespace IndexFormat
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <VREngine/Core.hpp>
+#include <VREngine/Vulkan/Types.hpp>
+
+namespace vre::Vulkan::VertexPulling {
+    // Matches PulledDraw in VertexPulling.slangh. Pointers the shader does not read may be left at 0.
+    struct PushConstants {
+        vk::DeviceAddress Vertices{0u};
+        vk::DeviceAddress Instances{0u};
+        vk::DeviceAddress Materials{0u};
+    };
+
+    // Task and mesh stages are included when the device supports them.
+    vk::ShaderStageFlags  GetStageFlags();
+    vk::PushConstantRange GetPushConstantRange();
+
+    // Pipelines built for vertex pulling leave the vertex layout of GraphicsPipeline::Builder empty.
+    vk::PipelineLayout CreateLayout(
+        const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts,
+        const vk::Device                              &device);
+    vk::PipelineLayout CreateLayout(const vk::Device &device);
+
+    void Push(
+        const vk::CommandBuffer  &commandBuffer,
+        const vk::PipelineLayout &layout,
+        const PushConstants      &pushConstants);
+}  // namespace vre::Vulkan::VertexPulling
\ No newline at end of file
@@ -0,0 +1,387 @@
+#include <VREngine/Assets/AssetIO.hpp>
+
+#ifdef VRE_HAS_IO_URING
+#include <liburing.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace vre {
+    AssetIO::Settings                      AssetIO::g_Settings{};
+    AssetIO::Backend                       AssetIO::g_Backend{AssetIO::Backend::eThreadPool};
+    std::vector<AssetIO::RegisteredBuffer> AssetIO::g_Buffers{};
+    std::mutex                             AssetIO::g_Mutex{};
+    std::deque<AssetIO::Chunk *>           AssetIO::g_Backlog{};
+    std::uint32_t                          AssetIO::g_InFlight{0u};
+    std::thread                            AssetIO::g_Reaper{};
+    void                                  *AssetIO::g_Ring{nullptr};
+    bool                                   AssetIO::g_IsInitialized{false};
+    AssetIO                                AssetIO::g_State{};
+
+    void AssetIO::Initialize(const Settings &settings) {
+        DVRE_ASSERT(!g_IsInitialized, "vre::AssetIO must be shut down before initializing");
+        DLOG_INFO("Initializing vre::AssetIO");
+
+        g_Settings            = settings;
+        g_Settings.QueueDepth = std::max(g_Settings.QueueDepth, 1u);
+        g_Settings.ChunkSize  = std::clamp<std::uint64_t>(
+            g_Settings.ChunkSize & ~(DIRECT_IO_ALIGNMENT - 1u),
+            DIRECT_IO_ALIGNMENT,
+            std::uint64_t(1u) << 30);
+        g_Backend = Backend::eThreadPool;
+
+        if (g_Settings.PreferredBackend == Backend::eIoUring) {
+#ifdef VRE_HAS_IO_URING
+            if (InitializeRing())
+                g_Backend = Backend::eIoUring;
+            else
+                LOG_WARN("Failed to create an io_uring instance, falling back to the thread pool");
+#else
+            DLOG_WARN("vre::AssetIO was built without io_uring support, falling back to the thread pool");
+#endif
+        }
+
+        DLOG_INFO("vre::AssetIO uses the {} backend", g_Backend == Backend::eIoUring ? "io_uring" : "thread pool");
+        g_IsInitialized = true;
+    }
+
+    void AssetIO::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void AssetIO::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetIO must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::AssetIO down");
+
+#ifdef VRE_HAS_IO_URING
+        if (g_Backend == Backend::eIoUring) ShutdownRing();
+#endif
+
+        g_Buffers.clear();
+        g_Backend       = Backend::eThreadPool;
+        g_IsInitialized = false;
+    }
+
+    bool AssetIO::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    AssetIO::Backend AssetIO::GetBackend() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetIO must be initialized");
+        return g_Backend;
+    }
+
+    std::uint32_t AssetIO::RegisterBuffer(void *data, std::size_t size) {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetIO must be initialized");
+        DVRE_ASSERT(data != nullptr && size > 0u, "vre::AssetIO cannot register an empty buffer");
+
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        DVRE_ASSERT(g_InFlight == 0u && g_Backlog.empty(), "vre::AssetIO buffers must be registered while no reads are in flight");
+
+        g_Buffers.push_back(RegisteredBuffer{(std::byte *)data, size});
+#ifdef VRE_HAS_IO_URING
+        if (g_Backend == Backend::eIoUring && !RegisterRingBuffers()) {
+            g_Buffers.pop_back();
+            if (!RegisterRingBuffers()) g_Buffers.clear();
+            return INVALID_BUFFER;
+        }
+#endif
+        return std::uint32_t(g_Buffers.size() - 1u);
+    }
+
+    void AssetIO::UnregisterBuffers() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetIO must be initialized");
+
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        DVRE_ASSERT(g_InFlight == 0u && g_Backlog.empty(), "vre::AssetIO buffers must be unregistered while no reads are in flight");
+
+        g_Buffers.clear();
+#ifdef VRE_HAS_IO_URING
+        if (g_Backend == Backend::eIoUring) io_uring_unregister_buffers((io_uring *)g_Ring);
+#endif
+    }
+
+    void AssetIO::Read(const Request &request, Callback &&callback) {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetIO must be initialized");
+        DVRE_ASSERT(request.Size == 0u || request.Destination != nullptr, "vre::AssetIO read needs a destination: '{}'", request.Path.string());
+
+        if (request.Size == 0u) {
+            callback(true);
+            return;
+        }
+
+#ifdef VRE_HAS_IO_URING
+        if (g_Backend == Backend::eIoUring) {
+            SubmitRing(request, std::move(callback));
+            return;
+        }
+#endif
+
+        ThreadPool::Submit([request, callback = std::move(callback)] { callback(ReadBlocking(request)); });
+    }
+
+    std::future<bool> AssetIO::Read(const Request &request) {
+        std::shared_ptr<std::promise<bool>> promise = std::make_shared<std::promise<bool>>();
+        std::future<bool>                   future  = promise->get_future();
+        Read(request, [promise](bool success) { promise->set_value(success); });
+        return future;
+    }
+
+    std::vector<std::future<bool>> AssetIO::Read(std::span<const Request> requests) {
+        std::vector<std::future<bool>> futures{};
+        futures.reserve(requests.size());
+        for (const Request &request : requests)
+            futures.push_back(Read(request));
+        return futures;
+    }
+
+    std::future<std::vector<std::byte>> AssetIO::ReadFile(const fs::path &path) {
+        std::shared_ptr<std::promise<std::vector<std::byte>>> promise =
+            std::make_shared<std::promise<std::vector<std::byte>>>();
+        std::future<std::vector<std::byte>> future = promise->get_future();
+
+        std::error_code     error{};
+        const std::uint64_t size = fs::file_size(path, error);
+        if (error) {
+            LOG_ERROR("Failed to find a file from path: '{}'", path.string());
+            promise->set_value({});
+            return future;
+        }
+
+        std::shared_ptr<std::vector<std::byte>> data = std::make_shared<std::vector<std::byte>>(size);
+        Read(Request{path, 0u, size, data->data()}, [promise, data](bool success) {
+            if (!success) data->clear();
+            promise->set_value(std::move(*data));
+        });
+        return future;
+    }
+
+    bool AssetIO::ReadBlocking(const Request &request) {
+        std::ifstream ifile{request.Path, std::ios::binary};
+        if (!ifile.is_open()) {
+            LOG_ERROR("Failed to open a file from path: '{}'", request.Path.string());
+            return false;
+        }
+
+        ifile.seekg(std::streamoff(request.Offset));
+        ifile.read((char *)request.Destination, std::streamsize(request.Size));
+        if (std::uint64_t(ifile.gcount()) != request.Size) {
+            LOG_ERROR("Failed to read {} bytes at offset {} from path: '{}'", request.Size, request.Offset, request.Path.string());
+            return false;
+        }
+        return true;
+    }
+
+#ifdef VRE_HAS_IO_URING
+    bool AssetIO::InitializeRing() {
+        io_uring   *ring   = new io_uring{};
+        const int   result = io_uring_queue_init(g_Settings.QueueDepth, ring, 0u);
+        if (result < 0) {
+            DLOG_WARN("io_uring_queue_init failed: '{}'", std::strerror(-result));
+            delete ring;
+            return false;
+        }
+
+        g_Ring     = ring;
+        g_InFlight = 0u;
+        g_Reaper   = std::thread{ReapLoop};
+        return true;
+    }
+
+    void AssetIO::ShutdownRing() {
+        io_uring *ring = (io_uring *)g_Ring;
+        {
+            // A null completion tells the reaper to exit once every queued read has finished.
+            std::lock_guard<std::mutex> lock{g_Mutex};
+            io_uring_sqe               *sqe = io_uring_get_sqe(ring);
+            VRE_ASSERT(sqe != nullptr, "Failed to stop the vre::AssetIO reaper");
+            io_uring_prep_nop(sqe);
+            io_uring_sqe_set_data(sqe, nullptr);
+            io_uring_submit(ring);
+        }
+        g_Reaper.join();
+
+        io_uring_queue_exit(ring);
+        delete ring;
+        g_Ring = nullptr;
+    }
+
+    bool AssetIO::RegisterRingBuffers() {
+        io_uring *ring = (io_uring *)g_Ring;
+        io_uring_unregister_buffers(ring);
+        if (g_Buffers.empty()) return true;
+
+        std::vector<iovec> iovecs{};
+        iovecs.reserve(g_Buffers.size());
+        for (const RegisteredBuffer &buffer : g_Buffers)
+            iovecs.push_back(iovec{buffer.Data, buffer.Size});
+
+        const int result = io_uring_register_buffers(ring, iovecs.data(), unsigned(iovecs.size()));
+        if (result < 0) {
+            LOG_WARN("Failed to register io_uring buffers: '{}'", std::strerror(-result));
+            return false;
+        }
+        return true;
+    }
+
+    void AssetIO::SubmitRing(const Request &request, Callback &&callback) {
+        Operation *operation  = new Operation{};
+        operation->OnComplete = std::move(callback);
+        operation->File       = open(request.Path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (operation->File < 0) {
+            LOG_ERROR("Failed to open a file from path: '{}'", request.Path.string());
+            Finish(operation);
+            return;
+        }
+
+        std::byte    *destination = (std::byte *)request.Destination;
+        std::uint64_t directSize  = 0u;
+        if (g_Settings.EnableDirectIO && request.Size >= g_Settings.DirectIOThreshold &&
+            request.Offset % DIRECT_IO_ALIGNMENT == 0u && std::uintptr_t(destination) % DIRECT_IO_ALIGNMENT == 0u) {
+            operation->DirectFile = open(request.Path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+            if (operation->DirectFile >= 0) directSize = request.Size & ~(DIRECT_IO_ALIGNMENT - 1u);
+        }
+
+        // Large reads are split so a single file keeps several requests queued on the device.
+        std::vector<Chunk *> chunks{};
+        chunks.reserve(std::size_t((request.Size + g_Settings.ChunkSize - 1u) / g_Settings.ChunkSize) + 1u);
+        for (std::uint64_t offset = 0u; offset < request.Size;) {
+            const bool          isDirect = offset < directSize;
+            const std::uint64_t end      = isDirect ? directSize : request.Size;
+            const std::uint32_t size     = std::uint32_t(std::min(g_Settings.ChunkSize, end - offset));
+            chunks.push_back(new Chunk{operation, destination + offset, request.Offset + offset, size, INVALID_BUFFER, isDirect});
+            offset += size;
+        }
+
+        operation->Remaining = std::uint32_t(chunks.size());
+        Enqueue(chunks);
+    }
+
+    void AssetIO::Enqueue(std::span<Chunk *const> chunks) {
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        for (Chunk *chunk : chunks) {
+            chunk->Buffer = FindBuffer(chunk->Destination, chunk->Size);
+            g_Backlog.push_back(chunk);
+        }
+        SubmitBacklog();
+    }
+
+    void AssetIO::SubmitBacklog() {
+        io_uring     *ring     = (io_uring *)g_Ring;
+        std::uint32_t prepared = 0u;
+
+        while (!g_Backlog.empty() && g_InFlight < g_Settings.QueueDepth) {
+            io_uring_sqe *sqe = io_uring_get_sqe(ring);
+            if (sqe == nullptr) break;
+
+            Chunk *chunk = g_Backlog.front();
+            g_Backlog.pop_front();
+
+            const int file = chunk->IsDirect ? chunk->Owner->DirectFile : chunk->Owner->File;
+            if (chunk->Buffer != INVALID_BUFFER)
+                io_uring_prep_read_fixed(sqe, file, chunk->Destination, chunk->Size, chunk->Offset, int(chunk->Buffer));
+            else
+                io_uring_prep_read(sqe, file, chunk->Destination, chunk->Size, chunk->Offset);
+            io_uring_sqe_set_data(sqe, chunk);
+
+            g_InFlight++;
+            prepared++;
+        }
+
+        if (prepared == 0u) return;
+
+        const int result = io_uring_submit(ring);
+        if (result < 0) LOG_ERROR("Failed to submit io_uring reads: '{}'", std::strerror(-result));
+    }
+
+    void AssetIO::ReapLoop() {
+        io_uring     *ring       = (io_uring *)g_Ring;
+        bool          isStopping = false;
+        std::uint32_t backoff    = 0u;
+
+        while (true) {
+            io_uring_cqe *cqe    = nullptr;
+            const int     result = io_uring_wait_cqe(ring, &cqe);
+            if (result == -EINTR) continue;
+
+            // A persistent error would otherwise spin this thread, it is logged once and retried with a growing delay.
+            if (result < 0) {
+                if (backoff == 0u) LOG_ERROR("Failed to wait for io_uring completions: '{}'", std::strerror(-result));
+                backoff = std::min(std::max(backoff * 2u, 1u), 100u);
+                std::this_thread::sleep_for(std::chrono::milliseconds{backoff});
+                continue;
+            }
+            backoff = 0u;
+
+            do {
+                Chunk             *chunk = (Chunk *)io_uring_cqe_get_data(cqe);
+                const std::int32_t res   = cqe->res;
+                io_uring_cqe_seen(ring, cqe);
+
+                if (chunk == nullptr)
+                    isStopping = true;
+                else
+                    Complete(chunk, res);
+            } while (io_uring_peek_cqe(ring, &cqe) == 0);
+
+            std::lock_guard<std::mutex> lock{g_Mutex};
+            SubmitBacklog();
+            if (isStopping && g_InFlight == 0u && g_Backlog.empty()) return;
+        }
+    }
+
+    void AssetIO::Complete(Chunk *chunk, std::int32_t result) {
+        {
+            std::lock_guard<std::mutex> lock{g_Mutex};
+            g_InFlight--;
+
+            bool isRetry = result == -EAGAIN || result == -EINTR;
+            if (result == -EINVAL && chunk->IsDirect) {
+                chunk->IsDirect = false;
+                isRetry         = true;
+            } else if (result > 0 && std::uint32_t(result) < chunk->Size) {
+                chunk->Destination += result;
+                chunk->Offset += std::uint32_t(result);
+                chunk->Size -= std::uint32_t(result);
+                chunk->IsDirect = chunk->IsDirect && chunk->Offset % DIRECT_IO_ALIGNMENT == 0u;
+                isRetry         = true;
+            }
+
+            if (isRetry) {
+                g_Backlog.push_front(chunk);
+                return;
+            }
+        }
+
+        Operation *operation = chunk->Owner;
+        if (result <= 0) {
+            LOG_ERROR("Failed to read {} bytes at offset {}: '{}'",
+                      chunk->Size, chunk->Offset, result == 0 ? "unexpected end of file" : std::strerror(-result));
+            operation->IsFailed = true;
+        }
+        delete chunk;
+
+        if (operation->Remaining.fetch_sub(1u) == 1u) Finish(operation);
+    }
+
+    void AssetIO::Finish(Operation *operation) {
+        if (operation->File >= 0) close(operation->File);
+        if (operation->DirectFile >= 0) close(operation->DirectFile);
+
+        operation->OnComplete(operation->File >= 0 && !operation->IsFailed);
+        delete operation;
+    }
+
+    std::uint32_t AssetIO::FindBuffer(const std::byte *data, std::uint64_t size) {
+        for (std::size_t i = 0u; i < g_Buffers.size(); i++) {
+            const RegisteredBuffer &buffer = g_Buffers[i];
+            if (data >= buffer.Data && data + size <= buffer.Data + buffer.Size) return std::uint32_t(i);
+        }
+        return INVALID_BUFFER;
+    }
+#endif
+
+    AssetIO::~AssetIO() {
+        VRE_ASSERT(!g_IsInitialized, "vre::AssetIO must be shut down before closing!");
+    }
+}  // namespace vre
\ No newline at end of file
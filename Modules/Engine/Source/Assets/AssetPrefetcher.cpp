@@ -0,0 +1,204 @@
+#include <VREngine/Assets/AssetPrefetcher.hpp>
+
+#ifdef VRE_PLATFORM_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace vre {
+    namespace {
+        bool ParseUnsigned(std::string_view text, std::uint64_t &value) {
+            const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return error == std::errc{} && end == text.data() + text.size();
+        }
+    }  // namespace
+
+    AssetPrefetcher::Settings             AssetPrefetcher::g_Settings{};
+    std::chrono::steady_clock::time_point AssetPrefetcher::g_Start{};
+    std::vector<AssetPrefetcher::Access>  AssetPrefetcher::g_Accesses{};
+    std::unordered_set<std::string>       AssetPrefetcher::g_Recorded{};
+    std::mutex                            AssetPrefetcher::g_Mutex{};
+    std::future<void>                     AssetPrefetcher::g_Prefetch{};
+    std::atomic<bool>                     AssetPrefetcher::g_IsRecording{false};
+    std::atomic<bool>                     AssetPrefetcher::g_IsCancelled{false};
+    std::atomic<std::size_t>              AssetPrefetcher::g_PrefetchedCount{0u};
+    bool                                  AssetPrefetcher::g_IsInitialized{false};
+    AssetPrefetcher                       AssetPrefetcher::g_State{};
+
+    void AssetPrefetcher::Initialize(const Settings &settings) {
+        DVRE_ASSERT(!g_IsInitialized, "vre::AssetPrefetcher must be shut down before initializing");
+        DLOG_INFO("Initializing vre::AssetPrefetcher with manifest: '{}'", settings.ManifestPath.string());
+
+        g_Settings        = settings;
+        g_Start           = std::chrono::steady_clock::now();
+        g_IsCancelled     = false;
+        g_PrefetchedCount = 0u;
+
+        if (g_Settings.EnablePrefetch) {
+            std::vector<Access> accesses = Load();
+            if (!accesses.empty()) {
+                DVRE_ASSERT(ThreadPool::IsInitialized(), "vre::ThreadPool must be initialized to prefetch assets");
+                g_Prefetch = ThreadPool::Submit([accesses = std::move(accesses)] { Prefetch(accesses); });
+            }
+        }
+
+        g_IsRecording   = g_Settings.EnableRecording;
+        g_IsInitialized = true;
+    }
+
+    void AssetPrefetcher::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void AssetPrefetcher::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetPrefetcher must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::AssetPrefetcher down");
+
+        g_IsCancelled = true;
+        if (g_Prefetch.valid()) g_Prefetch.wait();
+        g_Prefetch = {};
+
+        Save();
+        g_IsRecording = false;
+
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        g_Accesses.clear();
+        g_Recorded.clear();
+        g_IsInitialized = false;
+    }
+
+    bool AssetPrefetcher::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    void AssetPrefetcher::RecordAccess(const fs::path &path) {
+        if (!g_IsRecording.load(std::memory_order_relaxed)) return;
+
+        std::string         key  = path.lexically_normal().generic_string();
+        const std::uint64_t time = std::uint64_t(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_Start).count());
+
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        if (g_Accesses.size() >= g_Settings.MaxEntries || g_Recorded.contains(key)) return;
+
+        std::error_code     error{};
+        const std::uint64_t size = fs::file_size(path, error);
+        if (error) return;
+
+        g_Recorded.insert(key);
+        g_Accesses.push_back(Access{std::move(key), time, size});
+    }
+
+    void AssetPrefetcher::Save() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetPrefetcher must be initialized");
+        if (!g_Settings.EnableRecording) return;
+
+        std::vector<Access> accesses = GetAccesses();
+        if (accesses.empty()) return;
+
+        std::ofstream ofile{g_Settings.ManifestPath, std::ios::trunc};
+        if (!ofile.is_open()) {
+            LOG_WARN("Failed to write an asset access manifest: '{}'", g_Settings.ManifestPath.string());
+            return;
+        }
+
+        ofile << std::format("VREPrefetch {}\n", MANIFEST_VERSION);
+        for (const Access &access : accesses)
+            ofile << std::format("A\t{}\t{}\t{}\n", access.Time, access.Size, access.Path);
+
+        DLOG_INFO("Recorded {} asset accesses into: '{}'", accesses.size(), g_Settings.ManifestPath.string());
+    }
+
+    std::vector<AssetPrefetcher::Access> AssetPrefetcher::GetAccesses() {
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        return g_Accesses;
+    }
+
+    std::size_t AssetPrefetcher::GetPrefetchedCount() {
+        return g_PrefetchedCount.load();
+    }
+
+    std::vector<AssetPrefetcher::Access> AssetPrefetcher::Load() {
+        std::ifstream ifile{g_Settings.ManifestPath};
+        if (!ifile.is_open()) return {};
+
+        std::string line{};
+        std::getline(ifile, line);
+        if (line != std::format("VREPrefetch {}", MANIFEST_VERSION)) {
+            LOG_INFO("Ignoring an outdated asset access manifest: '{}'", g_Settings.ManifestPath.string());
+            return {};
+        }
+
+        // The manifest is read before anything can catch an exception, so a malformed line is skipped instead of thrown on.
+        std::vector<Access> accesses{};
+        std::size_t         lineNumber = 1u;
+        while (std::getline(ifile, line)) {
+            lineNumber++;
+
+            std::istringstream fields{line};
+            std::string        type{};
+            std::string        time{};
+            std::string        size{};
+            std::string        path{};
+            if (!std::getline(fields, type, '\t') || type != "A") continue;
+
+            Access access{};
+            if (!std::getline(fields, time, '\t') || !std::getline(fields, size, '\t') || !std::getline(fields, path) ||
+                !ParseUnsigned(time, access.Time) || !ParseUnsigned(size, access.Size)) {
+                LOG_WARN("Skipping a malformed line {} in the asset access manifest: '{}'", lineNumber, g_Settings.ManifestPath.string());
+                continue;
+            }
+
+            access.Path = path;
+            accesses.push_back(std::move(access));
+        }
+
+        std::stable_sort(accesses.begin(), accesses.end(), [](const Access &a, const Access &b) { return a.Time < b.Time; });
+        return accesses;
+    }
+
+    void AssetPrefetcher::Prefetch(const std::vector<Access> &accesses) {
+        std::uint64_t budget = g_Settings.MaxPrefetchBytes;
+        for (const Access &access : accesses) {
+            if (g_IsCancelled.load(std::memory_order_relaxed)) return;
+
+            std::error_code     error{};
+            const std::uint64_t size = fs::file_size(access.Path, error);
+            if (error || size > budget) continue;
+
+            if (PrefetchFile(access.Path, size)) {
+                budget -= size;
+                g_PrefetchedCount++;
+            }
+        }
+
+        DLOG_INFO("Prefetched {} of {} recorded assets", g_PrefetchedCount.load(), accesses.size());
+    }
+
+    bool AssetPrefetcher::PrefetchFile(const fs::path &path, std::uint64_t size) {
+#ifdef VRE_PLATFORM_UNIX
+        const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) return false;
+
+        const int result = posix_fadvise(file, 0, off_t(size), POSIX_FADV_WILLNEED);
+        close(file);
+        return result == 0;
+#else
+        std::ifstream ifile{path, std::ios::binary};
+        if (!ifile.is_open()) return false;
+
+        // Without fadvise the file is read into a scratch buffer to warm the system cache.
+        std::vector<char> scratch(std::size_t(1u) << 20);
+        for (std::uint64_t remaining = size; remaining > 0u && !g_IsCancelled.load(std::memory_order_relaxed);) {
+            ifile.read(scratch.data(), std::streamsize(std::min<std::uint64_t>(remaining, scratch.size())));
+            if (ifile.gcount() <= 0) break;
+            remaining -= std::uint64_t(ifile.gcount());
+        }
+        return true;
+#endif
+    }
+
+    AssetPrefetcher::~AssetPrefetcher() {
+        VRE_ASSERT(!g_IsInitialized, "vre::AssetPrefetcher must be shut down before closing!");
+    }
+}  // namespace vre
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include <VREngine/Assets/AssetServer.hpp>
 
 namespace vre {
-    std::map<std::size_t, std::unique_ptr<AssetServer::IAssetVector>> AssetServer::g_AssetsMap{};
-    bool                                                              AssetServer::g_IsInitialized{false};
-    AssetServer::Status                                               AssetServer::g_Status{};
+    std::vector<std::unique_ptr<AssetServer::IAssetVector>> AssetServer::g_AssetVectors{};
+    std::mutex                                              AssetServer::g_AssetVectorsMutex{};
+    std::atomic<std::size_t>                                AssetServer::g_NextIndex{1u};
+    EpochReclaimer                                          AssetServer::g_Reclaimer{};
+    bool                                                    AssetServer::g_IsInitialized{false};
+    AssetServer::Status                                     AssetServer::g_Status{};
 
     void AssetServer::Initialize() {
         DVRE_ASSERT(!g_IsInitialized, "vre::AssetServer must be shut down before initializing");
@@ -15,10 +18,14 @@ namespace vre {
         DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized before shutting down");
         DLOG_INFO("Shutting vre::AssetServer down");
 
-        for (auto &[assetType, assetVector] : g_AssetsMap) {
-            assetVector->clear();
+        {
+            std::lock_guard<std::mutex> lock{g_AssetVectorsMutex};
+            for (std::unique_ptr<IAssetVector> &assetVector : g_AssetVectors) {
+                assetVector->clear();
+            }
         }
-        g_AssetsMap.clear();
+        g_Reclaimer.flush();
+        g_NextIndex.store(1u);
         g_IsInitialized = false;
     }
 
@@ -26,6 +33,18 @@ namespace vre {
         return g_IsInitialized;
     }
 
+    void AssetServer::Commit() {
+        DVRE_ASSERT(g_IsInitialized, "vre::AssetServer must be initialized");
+
+        {
+            std::lock_guard<std::mutex> lock{g_AssetVectorsMutex};
+            for (std::unique_ptr<IAssetVector> &assetVector : g_AssetVectors) {
+                assetVector->commit();
+            }
+        }
+        g_Reclaimer.collect();
+    }
+
     AssetServer::Status::~Status() {
         VRE_ASSERT(!g_IsInitialized, "vre::AssetServer must be shut down before closing!");
     }
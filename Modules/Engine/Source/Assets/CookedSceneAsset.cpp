@@ -0,0 +1,345 @@
+#include <VREngine/Assets/CookedSceneAsset.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
+
+namespace vre {
+    static_assert(sizeof(MeshAsset::Vertex) == 64u, "vre::MeshAsset::Vertex layout is part of the cooked scene format");
+    static_assert(sizeof(MeshAsset::Meshlet) == 64u, "vre::MeshAsset::Meshlet layout is part of the cooked scene format");
+    static_assert(sizeof(CookedSceneAsset::Mesh) == 56u);
+    static_assert(sizeof(CookedSceneAsset::Texture) == 40u);
+    static_assert(sizeof(CookedSceneAsset::Material) == 48u);
+    static_assert(sizeof(CookedSceneAsset::Node) == 160u);
+
+    template <typename T>
+    static CookedSceneAsset::Section<T> AppendSection(std::vector<std::byte> &data, const std::vector<T> &values) {
+        const std::uint64_t offset = (data.size() + CookedSceneAsset::SECTION_ALIGNMENT - 1u) & ~(CookedSceneAsset::SECTION_ALIGNMENT - 1u);
+        data.resize(offset + values.size() * sizeof(T));
+        if (!values.empty()) std::memcpy(data.data() + offset, values.data(), values.size() * sizeof(T));
+        return CookedSceneAsset::Section<T>{.Offset = offset, .Count = values.size()};
+    }
+
+    static bool IsInRange(std::uint64_t first, std::uint64_t count, std::uint64_t total) {
+        return first <= total && count <= total - first;
+    }
+
+    static bool IsValidIndex(std::int32_t index, std::uint64_t count) {
+        return index == -1 || (index >= 0 && std::uint64_t(index) < count);
+    }
+
+    static std::uint64_t GetMipChainSize(const CookedSceneAsset::Texture &texture) {
+        std::uint64_t size = 0u;
+        for (std::uint32_t mip = 0u; mip < texture.MipCount; mip++)
+            size += std::uint64_t(std::max(texture.Width >> mip, 1u)) * std::max(texture.Height >> mip, 1u) * texture.ChannelCount;
+        return size;
+    }
+
+    CookedSceneAsset::CookedSceneAsset(const fs::path &path, std::shared_ptr<MappedFile> &&file)
+        : m_Path{path}, m_File{std::move(file)} {
+        DVRE_INFO("Initializing a vre::CookedSceneAsset from path: '{}'", m_Path.getPath());
+
+        VRE_ASSERT(m_File->getSize() >= sizeof(Header), "Cooked scene is too small to be valid: '{}'", m_Path.getPath());
+        m_Header = reinterpret_cast<const Header *>(m_File->getData());
+    }
+
+    void CookedSceneAsset::release() {
+        DVRE_INFO("Releasing a vre::CookedSceneAsset from path: '{}'", m_Path.getPath());
+        m_Header = nullptr;
+        m_File.reset();
+    }
+
+    InternedPath CookedSceneAsset::getInternedPath() const { return m_Path; }
+
+    std::string_view CookedSceneAsset::getPath() const { return m_Path.getPath(); }
+
+    std::string_view CookedSceneAsset::getDirectory() const { return m_Path.getDirectory(); }
+
+    std::string_view CookedSceneAsset::getName() const { return m_Path.getName(); }
+
+    std::string_view CookedSceneAsset::getExtension() const { return m_Path.getExtension(); }
+
+    const CookedSceneAsset::Header &CookedSceneAsset::getHeader() const {
+        DVRE_ASSERT(m_Header != nullptr, "vre::CookedSceneAsset is not loaded");
+        return *m_Header;
+    }
+
+    std::span<const CookedSceneAsset::Mesh> CookedSceneAsset::getMeshes() const { return getSection(m_Header->Meshes); }
+
+    std::span<const CookedSceneAsset::Texture> CookedSceneAsset::getTextures() const { return getSection(m_Header->Textures); }
+
+    std::span<const CookedSceneAsset::Material> CookedSceneAsset::getMaterials() const { return getSection(m_Header->Materials); }
+
+    std::span<const CookedSceneAsset::Node> CookedSceneAsset::getNodes() const { return getSection(m_Header->Nodes); }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getRootNodes() const { return getSection(m_Header->RootNodes); }
+
+    std::span<const MeshAsset::Vertex> CookedSceneAsset::getVertices() const { return getSection(m_Header->Vertices); }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getIndices() const { return getSection(m_Header->Indices); }
+
+    std::span<const MeshAsset::Meshlet> CookedSceneAsset::getMeshlets() const { return getSection(m_Header->Meshlets); }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getMeshletVertices() const { return getSection(m_Header->MeshletVertices); }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getMeshletTriangles() const { return getSection(m_Header->MeshletTriangles); }
+
+    std::span<const MeshAsset::Submesh> CookedSceneAsset::getSubmeshes(const Mesh &mesh) const {
+        return getSection(m_Header->Submeshes).subspan(mesh.FirstSubmesh, mesh.SubmeshCount);
+    }
+
+    std::span<const MeshAsset::Vertex> CookedSceneAsset::getVertices(const Mesh &mesh) const {
+        return getVertices().subspan(mesh.FirstVertex, mesh.VertexCount);
+    }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getIndices(const Mesh &mesh) const {
+        return getIndices().subspan(mesh.FirstIndex, mesh.IndexCount);
+    }
+
+    std::span<const MeshAsset::Meshlet> CookedSceneAsset::getMeshlets(const Mesh &mesh) const {
+        return getMeshlets().subspan(mesh.FirstMeshlet, mesh.MeshletCount);
+    }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getMeshletVertices(const Mesh &mesh) const {
+        return getMeshletVertices().subspan(mesh.FirstMeshletVertex, mesh.MeshletVertexCount);
+    }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getMeshletTriangles(const Mesh &mesh) const {
+        return getMeshletTriangles().subspan(mesh.FirstMeshletTriangle, mesh.MeshletTriangleCount);
+    }
+
+    std::span<const std::uint32_t> CookedSceneAsset::getChildren(const Node &node) const {
+        return getSection(m_Header->Children).subspan(node.FirstChild, node.ChildCount);
+    }
+
+    std::span<const std::byte> CookedSceneAsset::getTextureData(const Texture &texture) const {
+        return getSection(m_Header->TextureData).subspan(texture.DataOffset, texture.DataSize);
+    }
+
+    std::string_view CookedSceneAsset::getString(const String &string) const {
+        return std::string_view{getSection(m_Header->Strings).subspan(string.Offset, string.Size).data(), string.Size};
+    }
+
+    void CookedSceneAsset::validate() const {
+        const Header     &header = *m_Header;
+        const std::size_t size   = m_File->getSize();
+
+        VRE_ASSERT(header.Magic == MAGIC, "File is not a cooked scene: '{}'", m_Path.getPath());
+        VRE_ASSERT(header.Version == VERSION, "Cooked scene '{}' has version {} but version {} is required, cook it again with VRECook", m_Path.getPath(), header.Version, VERSION);
+        VRE_ASSERT(header.Size == size, "Cooked scene is truncated: '{}'", m_Path.getPath());
+
+        auto validateSection = [&]<typename T>(const Section<T> &section) {
+            VRE_ASSERT(section.Offset % alignof(T) == 0u && section.Offset <= size && section.Count <= (size - section.Offset) / sizeof(T),
+                       "Cooked scene has a section out of range: '{}'", m_Path.getPath());
+        };
+        validateSection(header.Meshes);
+        validateSection(header.Textures);
+        validateSection(header.Materials);
+        validateSection(header.Nodes);
+        validateSection(header.RootNodes);
+        validateSection(header.Children);
+        validateSection(header.Submeshes);
+        validateSection(header.Vertices);
+        validateSection(header.Indices);
+        validateSection(header.Meshlets);
+        validateSection(header.MeshletVertices);
+        validateSection(header.MeshletTriangles);
+        validateSection(header.TextureData);
+        validateSection(header.Strings);
+
+        auto validateString = [&](const String &string) {
+            VRE_ASSERT(IsInRange(string.Offset, string.Size, header.Strings.Count), "Cooked scene has a string out of range: '{}'", m_Path.getPath());
+        };
+
+        for (const Mesh &mesh : getMeshes()) {
+            validateString(mesh.Name);
+            VRE_ASSERT(IsInRange(mesh.FirstSubmesh, mesh.SubmeshCount, header.Submeshes.Count) &&
+                           IsInRange(mesh.FirstVertex, mesh.VertexCount, header.Vertices.Count) &&
+                           IsInRange(mesh.FirstIndex, mesh.IndexCount, header.Indices.Count) &&
+                           IsInRange(mesh.FirstMeshlet, mesh.MeshletCount, header.Meshlets.Count) &&
+                           IsInRange(mesh.FirstMeshletVertex, mesh.MeshletVertexCount, header.MeshletVertices.Count) &&
+                           IsInRange(mesh.FirstMeshletTriangle, mesh.MeshletTriangleCount, header.MeshletTriangles.Count),
+                       "Cooked scene has a mesh out of range: '{}'", m_Path.getPath());
+        }
+        for (const Texture &texture : getTextures()) {
+            validateString(texture.Name);
+            VRE_ASSERT(IsInRange(texture.DataOffset, texture.DataSize, header.TextureData.Count), "Cooked scene has a texture out of range: '{}'", m_Path.getPath());
+            if (texture.DataSize == 0u) continue;
+
+            VRE_ASSERT(texture.Width != 0u && texture.Height != 0u && texture.ChannelCount == 4u && texture.MipCount >= 1u &&
+                           texture.MipCount <= std::uint32_t(std::bit_width(std::max(texture.Width, texture.Height))) &&
+                           texture.DataSize == GetMipChainSize(texture),
+                       "Cooked scene has a texture with a size that does not match its mip chain: '{}'", m_Path.getPath());
+        }
+        for (const Material &material : getMaterials()) {
+            validateString(material.Name);
+            VRE_ASSERT(IsValidIndex(material.BaseColorTexture, header.Textures.Count) &&
+                           IsValidIndex(material.MetallicRoughnessTexture, header.Textures.Count) &&
+                           IsValidIndex(material.NormalTexture, header.Textures.Count),
+                       "Cooked scene has a material texture out of range: '{}'", m_Path.getPath());
+        }
+        for (const Node &node : getNodes()) {
+            validateString(node.Name);
+            VRE_ASSERT(IsInRange(node.FirstChild, node.ChildCount, header.Children.Count), "Cooked scene has a node out of range: '{}'", m_Path.getPath());
+            VRE_ASSERT(IsValidIndex(node.Parent, header.Nodes.Count) && IsValidIndex(node.Mesh, header.Meshes.Count),
+                       "Cooked scene has a node parent or mesh out of range: '{}'", m_Path.getPath());
+        }
+        for (std::uint32_t node : getSection(header.Children))
+            VRE_ASSERT(node < header.Nodes.Count, "Cooked scene has a child node out of range: '{}'", m_Path.getPath());
+        for (std::uint32_t node : getRootNodes())
+            VRE_ASSERT(node < header.Nodes.Count, "Cooked scene has a root node out of range: '{}'", m_Path.getPath());
+
+        // The values read through the mesh ranges index into the vertex and meshlet arrays of the same mesh, every one of
+        // them is checked so a corrupt file can not make the loader or the GPU read past the end of a buffer.
+        for (const Mesh &mesh : getMeshes()) {
+            for (const MeshAsset::Submesh &submesh : getSubmeshes(mesh))
+                VRE_ASSERT(IsInRange(submesh.FirstIndex, submesh.IndexCount, mesh.IndexCount) && IsValidIndex(submesh.MaterialIndex, header.Materials.Count),
+                           "Cooked scene has a submesh out of range: '{}'", m_Path.getPath());
+
+            for (std::uint32_t index : getIndices(mesh))
+                VRE_ASSERT(index < mesh.VertexCount, "Cooked scene has a vertex index out of range: '{}'", m_Path.getPath());
+
+            for (std::uint32_t index : getMeshletVertices(mesh))
+                VRE_ASSERT(index < mesh.VertexCount, "Cooked scene has a meshlet vertex out of range: '{}'", m_Path.getPath());
+
+            std::span<const std::uint32_t> triangles = getMeshletTriangles(mesh);
+            for (const MeshAsset::Meshlet &meshlet : getMeshlets(mesh)) {
+                VRE_ASSERT(IsInRange(meshlet.VertexOffset, meshlet.VertexCount, mesh.MeshletVertexCount) &&
+                               IsInRange(meshlet.TriangleOffset, meshlet.TriangleCount, mesh.MeshletTriangleCount) &&
+                               meshlet.FirstIndex <= mesh.IndexCount && meshlet.Submesh < mesh.SubmeshCount,
+                           "Cooked scene has a meshlet out of range: '{}'", m_Path.getPath());
+
+                for (std::uint32_t triangle : triangles.subspan(meshlet.TriangleOffset, meshlet.TriangleCount))
+                    VRE_ASSERT(((triangle >> 0u) & 0xFFu) < meshlet.VertexCount && ((triangle >> 8u) & 0xFFu) < meshlet.VertexCount &&
+                                   ((triangle >> 16u) & 0xFFu) < meshlet.VertexCount,
+                               "Cooked scene has a meshlet triangle out of range: '{}'", m_Path.getPath());
+            }
+        }
+    }
+
+    CookedSceneAsset CookedSceneAsset::FromPath(const fs::path &path) {
+        VRE_ASSERT(fs::exists(path), "Failed to find a cooked scene from path: '{}'", path.string());
+        AssetPrefetcher::RecordAccess(path);
+
+        std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(path);
+        VRE_ASSERT(file->isOpen(), "Failed to map a cooked scene from path: '{}'", path.string());
+
+        CookedSceneAsset scene{path, std::move(file)};
+        scene.validate();
+        return scene;
+    }
+
+    void CookedSceneAsset::Write(const fs::path &path, const SceneAsset &scene) {
+        std::vector<Mesh>               meshes{};
+        std::vector<Texture>            textures{};
+        std::vector<Material>           materials{};
+        std::vector<Node>               nodes{};
+        std::vector<std::uint32_t>      children{};
+        std::vector<MeshAsset::Submesh> submeshes{};
+        std::vector<MeshAsset::Vertex>  vertices{};
+        std::vector<std::uint32_t>      indices{};
+        std::vector<MeshAsset::Meshlet> meshlets{};
+        std::vector<std::uint32_t>      meshletVertices{};
+        std::vector<std::uint32_t>      meshletTriangles{};
+        std::vector<std::byte>          textureData{};
+        std::vector<char>               strings{};
+
+        auto addString = [&strings](std::string_view string) {
+            const String result{.Offset = std::uint32_t(strings.size()), .Size = std::uint32_t(string.size())};
+            strings.insert(strings.end(), string.begin(), string.end());
+            return result;
+        };
+
+        auto append = [](auto &destination, const auto &source) {
+            destination.insert(destination.end(), source.begin(), source.end());
+        };
+
+        for (const MeshAsset &mesh : scene.getMeshes()) {
+            meshes.push_back(Mesh{
+                .Name                 = addString(mesh.getName()),
+                .FirstSubmesh         = std::uint32_t(submeshes.size()),
+                .SubmeshCount         = std::uint32_t(mesh.getSubmeshes().size()),
+                .FirstVertex          = std::uint32_t(vertices.size()),
+                .VertexCount          = std::uint32_t(mesh.getVertices().size()),
+                .FirstIndex           = std::uint32_t(indices.size()),
+                .IndexCount           = std::uint32_t(mesh.getIndices().size()),
+                .FirstMeshlet         = std::uint32_t(meshlets.size()),
+                .MeshletCount         = std::uint32_t(mesh.getMeshlets().size()),
+                .FirstMeshletVertex   = std::uint32_t(meshletVertices.size()),
+                .MeshletVertexCount   = std::uint32_t(mesh.getMeshletVertices().size()),
+                .FirstMeshletTriangle = std::uint32_t(meshletTriangles.size()),
+                .MeshletTriangleCount = std::uint32_t(mesh.getMeshletTriangles().size()),
+            });
+            append(submeshes, mesh.getSubmeshes());
+            append(vertices, mesh.getVertices());
+            append(indices, mesh.getIndices());
+            append(meshlets, mesh.getMeshlets());
+            append(meshletVertices, mesh.getMeshletVertices());
+            append(meshletTriangles, mesh.getMeshletTriangles());
+        }
+
+        for (const TextureAsset &texture : scene.getTextures()) {
+            const std::uint64_t offset = (textureData.size() + SECTION_ALIGNMENT - 1u) & ~(SECTION_ALIGNMENT - 1u);
+            const std::uint64_t size   = texture.getData() != nullptr ? texture.getSize() : 0u;
+
+            textureData.resize(offset + size);
+            if (size != 0u) std::memcpy(textureData.data() + offset, texture.getData(), size);
+
+            textures.push_back(Texture{
+                .Name         = addString(texture.getPath()),
+                .Width        = texture.getWidth(),
+                .Height       = texture.getHeight(),
+                .ChannelCount = texture.getChannelCount(),
+                .MipCount     = texture.getMipCount(),
+                .DataOffset   = offset,
+                .DataSize     = size,
+            });
+        }
+
+        for (const SceneAsset::Material &material : scene.getMaterials())
+            materials.push_back(Material{
+                .BaseColorFactor          = material.BaseColorFactor,
+                .Name                     = addString(material.Name),
+                .MetallicFactor           = material.MetallicFactor,
+                .RoughnessFactor          = material.RoughnessFactor,
+                .BaseColorTexture         = material.BaseColorTexture,
+                .MetallicRoughnessTexture = material.MetallicRoughnessTexture,
+                .NormalTexture            = material.NormalTexture,
+                .Padding                  = 0u,
+            });
+
+        for (const SceneAsset::Node &node : scene.getNodes()) {
+            nodes.push_back(Node{
+                .LocalTransform = node.LocalTransform,
+                .WorldTransform = node.WorldTransform,
+                .Name           = addString(node.Name),
+                .Parent         = node.Parent,
+                .Mesh           = node.Mesh,
+                .FirstChild     = std::uint32_t(children.size()),
+                .ChildCount     = std::uint32_t(node.Children.size()),
+            });
+            append(children, node.Children);
+        }
+
+        std::vector<std::byte> data(sizeof(Header));
+
+        Header header{.Magic = MAGIC, .Version = VERSION};
+        header.Meshes           = AppendSection(data, meshes);
+        header.Textures         = AppendSection(data, textures);
+        header.Materials        = AppendSection(data, materials);
+        header.Nodes            = AppendSection(data, nodes);
+        header.RootNodes        = AppendSection(data, scene.getRootNodes());
+        header.Children         = AppendSection(data, children);
+        header.Submeshes        = AppendSection(data, submeshes);
+        header.Vertices         = AppendSection(data, vertices);
+        header.Indices          = AppendSection(data, indices);
+        header.Meshlets         = AppendSection(data, meshlets);
+        header.MeshletVertices  = AppendSection(data, meshletVertices);
+        header.MeshletTriangles = AppendSection(data, meshletTriangles);
+        header.TextureData      = AppendSection(data, textureData);
+        header.Strings          = AppendSection(data, strings);
+        header.Size             = data.size();
+        std::memcpy(data.data(), &header, sizeof(Header));
+
+        std::ofstream ofile{path, std::ios::binary | std::ios::trunc};
+        VRE_ASSERT(ofile.is_open(), "Failed to open a cooked scene for writing: '{}'", path.string());
+        ofile.write((const char *)data.data(), data.size());
+    }
+}  // namespace vre
\ No newline at end of file
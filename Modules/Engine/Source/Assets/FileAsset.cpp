@@ -1,25 +1,25 @@
 #include <VREngine/Assets/FileAsset.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
 
 namespace vre {
     FileAsset::FileAsset(const fs::path &path, const std::string &content)
-        : m_Path{path.string()}, m_Content{content} {
-        DVRE_INFO("Initializing vre::FileAsset from path: '{}'", m_Path);
-        m_Directory = path.parent_path().string();
-        m_Name      = path.filename().string();
-        m_Extension = path.extension().string();
+        : m_Path{path}, m_Content{content} {
+        DVRE_INFO("Initializing vre::FileAsset from path: '{}'", m_Path.getPath());
     }
 
     void FileAsset::release() {
-        DVRE_INFO("Releasing vre::FileAsset from path: '{}'", m_Path);
+        DVRE_INFO("Releasing vre::FileAsset from path: '{}'", m_Path.getPath());
     }
 
-    std::string FileAsset::getPath() const { return m_Path; }
+    InternedPath FileAsset::getInternedPath() const { return m_Path; }
 
-    std::string FileAsset::getDirectory() const { return m_Directory; }
+    std::string_view FileAsset::getPath() const { return m_Path.getPath(); }
 
-    std::string FileAsset::getName() const { return m_Name; }
+    std::string_view FileAsset::getDirectory() const { return m_Path.getDirectory(); }
 
-    std::string FileAsset::getExtension() const { return m_Extension; }
+    std::string_view FileAsset::getName() const { return m_Path.getName(); }
+
+    std::string_view FileAsset::getExtension() const { return m_Path.getExtension(); }
 
     std::string FileAsset::getContent() const { return m_Content; }
 
@@ -37,6 +37,7 @@ namespace vre {
 
     FileAsset FileAsset::FromPath(const fs::path &path) {
         VRE_ASSERT(fs::exists(path), "Failed to find a file from path: '{}'", path.string());
+        AssetPrefetcher::RecordAccess(path);
 
         std::ifstream ifile{path, std::ios::ate};
         DVRE_ASSERT(ifile.is_open(), "Failed to open a file from path: '{}'", path.string());
@@ -54,6 +55,9 @@ namespace vre {
     FileAsset FileAsset::FromPathBinary(const fs::path &path) {
         VRE_ASSERT(fs::exists(path), "Failed to find a file from path: '{}'", path.string());
 
+        if (AssetIO::IsInitialized() && !ThreadPool::IsWorkerThread()) return std::move(FromPathsBinary({&path, 1u}).front());
+        AssetPrefetcher::RecordAccess(path);
+
         std::ifstream ifile{path, std::ios::ate | std::ios::binary};
         DVRE_ASSERT(ifile.is_open(), "Failed to open a file from path: '{}'", path.string());
 
@@ -66,4 +70,36 @@ namespace vre {
 
         return FileAsset{path, content};
     }
+
+    std::vector<FileAsset> FileAsset::FromPathsBinary(std::span<const fs::path> paths) {
+        VRE_ASSERT(AssetIO::IsInitialized(), "vre::AssetIO must be initialized to read files in a batch");
+
+        if (ThreadPool::IsWorkerThread()) {
+            std::vector<FileAsset> files{};
+            files.reserve(paths.size());
+            for (const fs::path &path : paths)
+                files.push_back(FromPathBinary(path));
+            return files;
+        }
+
+        std::vector<std::string>      contents(paths.size());
+        std::vector<AssetIO::Request> requests{};
+        requests.reserve(paths.size());
+        for (std::size_t i = 0u; i < paths.size(); i++) {
+            VRE_ASSERT(fs::exists(paths[i]), "Failed to find a file from path: '{}'", paths[i].string());
+            AssetPrefetcher::RecordAccess(paths[i]);
+            contents[i].resize(fs::file_size(paths[i]));
+            requests.push_back(AssetIO::Request{paths[i], 0u, contents[i].size(), contents[i].data()});
+        }
+
+        std::vector<std::future<bool>> reads = AssetIO::Read(requests);
+
+        std::vector<FileAsset> files{};
+        files.reserve(paths.size());
+        for (std::size_t i = 0u; i < paths.size(); i++) {
+            VRE_ASSERT(reads[i].get(), "Failed to read a file from path: '{}'", paths[i].string());
+            files.emplace_back(paths[i], contents[i]);
+        }
+        return files;
+    }
 }  // namespace vre
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <VREngine/Assets/MeshAsset.hpp>
+
+namespace vre {
+    MeshAsset::MeshAsset(
+        const std::string          &name,
+        std::vector<Vertex>        &&vertices,
+        std::vector<std::uint32_t> &&indices,
+        std::vector<Submesh>       &&submeshes)
+        : m_Name{name}, m_Vertices{std::move(vertices)}, m_Indices{std::move(indices)}, m_Submeshes{std::move(submeshes)} {
+        DVRE_INFO("Initializing a vre::MeshAsset: '{}' with {} vertices and {} indices", m_Name, m_Vertices.size(), m_Indices.size());
+    }
+
+    void MeshAsset::release() {
+        DVRE_INFO("Releasing a vre::MeshAsset: '{}'", m_Name);
+        m_Vertices.clear();
+        m_Vertices.shrink_to_fit();
+        m_Indices.clear();
+        m_Indices.shrink_to_fit();
+        m_Submeshes.clear();
+        m_Meshlets.clear();
+        m_Meshlets.shrink_to_fit();
+        m_MeshletVertices.clear();
+        m_MeshletVertices.shrink_to_fit();
+        m_MeshletTriangles.clear();
+        m_MeshletTriangles.shrink_to_fit();
+    }
+
+    std::string MeshAsset::getName() const { return m_Name; }
+
+    const std::vector<MeshAsset::Vertex> &MeshAsset::getVertices() const { return m_Vertices; }
+
+    const std::vector<std::uint32_t> &MeshAsset::getIndices() const { return m_Indices; }
+
+    const std::vector<MeshAsset::Submesh> &MeshAsset::getSubmeshes() const { return m_Submeshes; }
+
+    std::vector<MeshAsset::Vertex> &MeshAsset::getVertices() { return m_Vertices; }
+
+    std::vector<std::uint32_t> &MeshAsset::getIndices() { return m_Indices; }
+
+    std::vector<MeshAsset::Submesh> &MeshAsset::getSubmeshes() { return m_Submeshes; }
+
+    void MeshAsset::setMeshlets(
+        std::vector<Meshlet>       &&meshlets,
+        std::vector<std::uint32_t> &&meshletVertices,
+        std::vector<std::uint32_t> &&meshletTriangles) {
+        m_Meshlets         = std::move(meshlets);
+        m_MeshletVertices  = std::move(meshletVertices);
+        m_MeshletTriangles = std::move(meshletTriangles);
+    }
+
+    const std::vector<MeshAsset::Meshlet> &MeshAsset::getMeshlets() const { return m_Meshlets; }
+
+    const std::vector<std::uint32_t> &MeshAsset::getMeshletVertices() const { return m_MeshletVertices; }
+
+    const std::vector<std::uint32_t> &MeshAsset::getMeshletTriangles() const { return m_MeshletTriangles; }
+
+    std::uint32_t MeshAsset::getVertexCount() const { return std::uint32_t(m_Vertices.size()); }
+
+    std::uint32_t MeshAsset::getIndexCount() const { return std::uint32_t(m_Indices.size()); }
+
+    std::uint64_t MeshAsset::getVerticesSize() const { return sizeof(Vertex) * m_Vertices.size(); }
+
+    std::uint64_t MeshAsset::getIndicesSize() const { return sizeof(std::uint32_t) * m_Indices.size(); }
+
+    MeshAsset MeshAsset::FromData(
+        const std::string          &name,
+        std::vector<Vertex>        &&vertices,
+        std::vector<std::uint32_t> &&indices,
+        std::vector<Submesh>       &&submeshes) {
+        return MeshAsset{name, std::move(vertices), std::move(indices), std::move(submeshes)};
+    }
+
+    MeshAsset MeshAsset::FromData(
+        const std::string                &name,
+        const std::vector<Vertex>        &vertices,
+        const std::vector<std::uint32_t> &indices) {
+        std::vector<Vertex>        meshVertices{vertices};
+        std::vector<std::uint32_t> meshIndices{indices};
+        std::vector<Submesh>       submeshes{};
+        submeshes.push_back(Submesh{
+            .FirstIndex    = 0u,
+            .IndexCount    = std::uint32_t(indices.size()),
+            .MaterialIndex = -1,
+        });
+        return MeshAsset{name, std::move(meshVertices), std::move(meshIndices), std::move(submeshes)};
+    }
+}  // namespace vre
\ No newline at end of file
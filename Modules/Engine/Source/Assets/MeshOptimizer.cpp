@@ -0,0 +1,356 @@
+#include <VREngine/Assets/MeshOptimizer.hpp>
+
+namespace vre::MeshOptimizer {
+    static constexpr std::uint32_t c_ForsythCacheSize = 32u;
+
+    // Welding compares the bit patterns, so -0.0 and 0.0 stay apart and NaN vertices still weld with identical copies.
+    static std::array<std::uint32_t, 12> GetVertexBits(const MeshAsset::Vertex &vertex) {
+        return std::array<std::uint32_t, 12>{
+            std::bit_cast<std::uint32_t>(vertex.Position.x), std::bit_cast<std::uint32_t>(vertex.Position.y), std::bit_cast<std::uint32_t>(vertex.Position.z),
+            std::bit_cast<std::uint32_t>(vertex.Normal.x), std::bit_cast<std::uint32_t>(vertex.Normal.y), std::bit_cast<std::uint32_t>(vertex.Normal.z),
+            std::bit_cast<std::uint32_t>(vertex.UV.x), std::bit_cast<std::uint32_t>(vertex.UV.y),
+            std::bit_cast<std::uint32_t>(vertex.Color.x), std::bit_cast<std::uint32_t>(vertex.Color.y),
+            std::bit_cast<std::uint32_t>(vertex.Color.z), std::bit_cast<std::uint32_t>(vertex.Color.w)};
+    }
+
+    struct VertexHash {
+        const std::vector<MeshAsset::Vertex> *Vertices;
+
+        std::size_t operator()(std::uint32_t index) const {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (std::uint32_t field : GetVertexBits((*Vertices)[index])) {
+                hash ^= field;
+                hash *= 1099511628211ull;
+            }
+            return std::size_t(hash);
+        }
+    };
+
+    struct VertexEqual {
+        const std::vector<MeshAsset::Vertex> *Vertices;
+
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            return GetVertexBits((*Vertices)[a]) == GetVertexBits((*Vertices)[b]);
+        }
+    };
+
+    static float GetForsythVertexScore(std::int32_t cachePosition, std::uint32_t remainingTriangles) {
+        if (remainingTriangles == 0u) return -1.0f;
+
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3)
+                score = 0.75f;
+            else
+                score = std::pow(1.0f - float(cachePosition - 3) / float(c_ForsythCacheSize - 3u), 1.5f);
+        }
+        return score + 2.0f * std::pow(float(remainingTriangles), -0.5f);
+    }
+
+    VertexCacheStatistics AnalyzeVertexCache(
+        std::span<const std::uint32_t> indices,
+        std::uint32_t                  vertexCount,
+        std::uint32_t                  cacheSize) {
+        const std::size_t triangleCount = indices.size() / 3u;
+        if (triangleCount == 0u || vertexCount == 0u) return VertexCacheStatistics{};
+
+        std::vector<std::uint32_t> timestamps(vertexCount, 0u);
+        std::vector<std::uint8_t>  referenced(vertexCount, 0u);
+
+        std::uint32_t timestamp       = cacheSize + 1u;
+        std::uint32_t misses          = 0u;
+        std::uint32_t referencedCount = 0u;
+        for (std::size_t i = 0u; i < triangleCount * 3u; i++) {
+            const std::uint32_t vertex = indices[i];
+            if (timestamp - timestamps[vertex] > cacheSize) {
+                timestamps[vertex] = timestamp++;
+                misses++;
+            }
+            if (referenced[vertex] == 0u) {
+                referenced[vertex] = 1u;
+                referencedCount++;
+            }
+        }
+
+        return VertexCacheStatistics{
+            .VerticesTransformed = misses,
+            .ACMR                = float(misses) / float(triangleCount),
+            .ATVR                = float(misses) / float(referencedCount),
+        };
+    }
+
+    std::uint32_t WeldVertices(std::vector<MeshAsset::Vertex> &vertices, std::span<std::uint32_t> indices) {
+        const std::uint32_t vertexCount = std::uint32_t(vertices.size());
+
+        std::unordered_map<std::uint32_t, std::uint32_t, VertexHash, VertexEqual> unique(
+            vertices.size(),
+            VertexHash{&vertices},
+            VertexEqual{&vertices});
+
+        std::vector<std::uint32_t>     remap(vertexCount);
+        std::vector<MeshAsset::Vertex> welded{};
+        welded.reserve(vertexCount);
+        for (std::uint32_t vertex = 0u; vertex < vertexCount; vertex++) {
+            auto [it, inserted] = unique.try_emplace(vertex, std::uint32_t(welded.size()));
+            if (inserted) welded.push_back(vertices[vertex]);
+            remap[vertex] = it->second;
+        }
+
+        for (std::uint32_t &index : indices)
+            index = remap[index];
+
+        const std::uint32_t removed = vertexCount - std::uint32_t(welded.size());
+        vertices                    = std::move(welded);
+        return removed;
+    }
+
+    void OptimizeVertexCache(std::span<std::uint32_t> indices, std::uint32_t vertexCount) {
+        const std::size_t triangleCount = indices.size() / 3u;
+        if (triangleCount < 2u) return;
+
+        std::vector<std::uint32_t> offsets(vertexCount + 1u, 0u);
+        for (std::size_t i = 0u; i < triangleCount * 3u; i++)
+            offsets[indices[i] + 1u]++;
+
+        std::vector<std::uint32_t> remaining(vertexCount);
+        for (std::uint32_t vertex = 0u; vertex < vertexCount; vertex++) {
+            remaining[vertex]      = offsets[vertex + 1u];
+            offsets[vertex + 1u] += offsets[vertex];
+        }
+
+        std::vector<std::uint32_t> adjacency(triangleCount * 3u);
+        std::vector<std::uint32_t> fill{offsets.begin(), offsets.end() - 1};
+        for (std::size_t triangle = 0u; triangle < triangleCount; triangle++)
+            for (std::size_t k = 0u; k < 3u; k++)
+                adjacency[fill[indices[triangle * 3u + k]]++] = std::uint32_t(triangle);
+
+        std::vector<std::int32_t> cachePositions(vertexCount, -1);
+        std::vector<float>        vertexScores(vertexCount);
+        for (std::uint32_t vertex = 0u; vertex < vertexCount; vertex++)
+            vertexScores[vertex] = GetForsythVertexScore(-1, remaining[vertex]);
+
+        std::int64_t       bestTriangle = -1;
+        float              bestScore    = -1.0f;
+        std::vector<float> triangleScores(triangleCount);
+        for (std::size_t triangle = 0u; triangle < triangleCount; triangle++) {
+            triangleScores[triangle] = vertexScores[indices[triangle * 3u + 0u]] +
+                                       vertexScores[indices[triangle * 3u + 1u]] +
+                                       vertexScores[indices[triangle * 3u + 2u]];
+            if (triangleScores[triangle] > bestScore) {
+                bestScore    = triangleScores[triangle];
+                bestTriangle = std::int64_t(triangle);
+            }
+        }
+
+        std::vector<std::uint8_t>  emitted(triangleCount, 0u);
+        std::vector<std::uint32_t> result{};
+        result.reserve(triangleCount * 3u);
+
+        std::array<std::uint32_t, c_ForsythCacheSize + 3u> cache{};
+        std::array<std::uint32_t, c_ForsythCacheSize + 3u> newCache{};
+        std::uint32_t                                      cacheCount    = 0u;
+        std::size_t                                        nextCandidate = 0u;
+
+        for (std::size_t emittedCount = 0u; emittedCount < triangleCount; emittedCount++) {
+            if (bestTriangle < 0) {
+                while (emitted[nextCandidate] != 0u)
+                    nextCandidate++;
+                bestTriangle = std::int64_t(nextCandidate);
+            }
+
+            const std::uint32_t *triangle = indices.data() + bestTriangle * 3u;
+            result.insert(result.end(), triangle, triangle + 3u);
+            emitted[bestTriangle] = 1u;
+
+            std::uint32_t newCacheCount = 0u;
+            for (std::uint32_t k = 0u; k < 3u; k++) {
+                const std::uint32_t vertex = triangle[k];
+
+                std::uint32_t *begin = adjacency.data() + offsets[vertex];
+                std::uint32_t *end   = begin + remaining[vertex];
+                std::uint32_t *found = std::find(begin, end, std::uint32_t(bestTriangle));
+                std::swap(*found, *(end - 1));
+                remaining[vertex]--;
+
+                if (std::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+                    newCache[newCacheCount++] = vertex;
+            }
+
+            const std::uint32_t triangleVertexCount = newCacheCount;
+            for (std::uint32_t i = 0u; i < cacheCount; i++) {
+                const std::uint32_t vertex = cache[i];
+                if (std::find(newCache.begin(), newCache.begin() + triangleVertexCount, vertex) == newCache.begin() + triangleVertexCount)
+                    newCache[newCacheCount++] = vertex;
+            }
+
+            for (std::uint32_t i = 0u; i < newCacheCount; i++) {
+                const std::uint32_t vertex = newCache[i];
+                cachePositions[vertex]     = i < c_ForsythCacheSize ? std::int32_t(i) : -1;
+                vertexScores[vertex]       = GetForsythVertexScore(cachePositions[vertex], remaining[vertex]);
+            }
+
+            bestTriangle = -1;
+            bestScore    = -1.0f;
+            for (std::uint32_t i = 0u; i < newCacheCount; i++) {
+                const std::uint32_t vertex = newCache[i];
+                for (std::uint32_t j = 0u; j < remaining[vertex]; j++) {
+                    const std::uint32_t candidate = adjacency[offsets[vertex] + j];
+                    triangleScores[candidate]     = vertexScores[indices[candidate * 3u + 0u]] +
+                                                vertexScores[indices[candidate * 3u + 1u]] +
+                                                vertexScores[indices[candidate * 3u + 2u]];
+                    if (triangleScores[candidate] > bestScore) {
+                        bestScore    = triangleScores[candidate];
+                        bestTriangle = std::int64_t(candidate);
+                    }
+                }
+            }
+
+            cacheCount = std::min(newCacheCount, c_ForsythCacheSize);
+            std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+        }
+
+        std::copy(result.begin(), result.end(), indices.begin());
+    }
+
+    void OptimizeOverdraw(
+        std::span<std::uint32_t>           indices,
+        std::span<const MeshAsset::Vertex> vertices,
+        std::uint32_t                      cacheSize,
+        float                              threshold) {
+        const std::size_t triangleCount = indices.size() / 3u;
+        if (triangleCount < 2u) return;
+
+        std::vector<std::uint32_t> timestamps(vertices.size(), 0u);
+        std::vector<std::uint32_t> missPrefix(triangleCount + 1u, 0u);
+        std::vector<std::uint32_t> hardBoundaries{};
+
+        std::uint32_t timestamp = cacheSize + 1u;
+        for (std::size_t triangle = 0u; triangle < triangleCount; triangle++) {
+            std::uint32_t misses = 0u;
+            for (std::size_t k = 0u; k < 3u; k++) {
+                const std::uint32_t vertex = indices[triangle * 3u + k];
+                if (timestamp - timestamps[vertex] > cacheSize) {
+                    timestamps[vertex] = timestamp++;
+                    misses++;
+                }
+            }
+            if (triangle == 0u || misses == 3u) hardBoundaries.push_back(std::uint32_t(triangle));
+            missPrefix[triangle + 1u] = missPrefix[triangle] + misses;
+        }
+
+        const float meshACMR = float(missPrefix[triangleCount]) / float(triangleCount);
+
+        std::vector<std::uint32_t> clusters{0u};
+        for (std::size_t i = 1u; i < hardBoundaries.size(); i++) {
+            const std::uint32_t start    = clusters.back();
+            const std::uint32_t boundary = hardBoundaries[i];
+            const float         acmr     = float(missPrefix[boundary] - missPrefix[start]) / float(boundary - start);
+            if (acmr <= meshACMR * threshold) clusters.push_back(boundary);
+        }
+        if (clusters.size() < 2u) return;
+        clusters.push_back(std::uint32_t(triangleCount));
+
+        const std::size_t      clusterCount = clusters.size() - 1u;
+        std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3{0.0f});
+        std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3{0.0f});
+        std::vector<float>     clusterAreas(clusterCount, 0.0f);
+
+        glm::vec3 meshCentroid{0.0f};
+        float     meshArea = 0.0f;
+        for (std::size_t cluster = 0u; cluster < clusterCount; cluster++) {
+            for (std::uint32_t triangle = clusters[cluster]; triangle < clusters[cluster + 1u]; triangle++) {
+                const glm::vec3 &a = vertices[indices[triangle * 3u + 0u]].Position;
+                const glm::vec3 &b = vertices[indices[triangle * 3u + 1u]].Position;
+                const glm::vec3 &c = vertices[indices[triangle * 3u + 2u]].Position;
+
+                const glm::vec3 normal = glm::cross(b - a, c - a);
+                const float     area   = glm::length(normal);
+
+                clusterCentroids[cluster] += (a + b + c) * (area / 3.0f);
+                clusterNormals[cluster] += normal;
+                clusterAreas[cluster] += area;
+            }
+
+            meshCentroid += clusterCentroids[cluster];
+            meshArea += clusterAreas[cluster];
+        }
+        if (meshArea > 0.0f) meshCentroid /= meshArea;
+
+        std::vector<float> sortKeys(clusterCount, 0.0f);
+        for (std::size_t cluster = 0u; cluster < clusterCount; cluster++) {
+            const float normalLength = glm::length(clusterNormals[cluster]);
+            if (clusterAreas[cluster] <= 0.0f || normalLength <= 0.0f) continue;
+
+            const glm::vec3 centroid = clusterCentroids[cluster] / clusterAreas[cluster];
+            sortKeys[cluster]        = glm::dot(centroid - meshCentroid, clusterNormals[cluster] / normalLength);
+        }
+
+        std::vector<std::uint32_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&sortKeys](std::uint32_t a, std::uint32_t b) {
+            return sortKeys[a] > sortKeys[b];
+        });
+
+        std::vector<std::uint32_t> result{};
+        result.reserve(triangleCount * 3u);
+        for (std::uint32_t cluster : order)
+            result.insert(
+                result.end(),
+                indices.begin() + clusters[cluster] * 3u,
+                indices.begin() + clusters[cluster + 1u] * 3u);
+
+        std::copy(result.begin(), result.end(), indices.begin());
+    }
+
+    std::uint32_t OptimizeVertexFetch(std::vector<MeshAsset::Vertex> &vertices, std::span<std::uint32_t> indices) {
+        std::vector<std::uint32_t>     remap(vertices.size(), std::numeric_limits<std::uint32_t>::max());
+        std::vector<MeshAsset::Vertex> reordered{};
+        reordered.reserve(vertices.size());
+
+        for (std::uint32_t &index : indices) {
+            if (remap[index] == std::numeric_limits<std::uint32_t>::max()) {
+                remap[index] = std::uint32_t(reordered.size());
+                reordered.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+
+        vertices = std::move(reordered);
+        return std::uint32_t(vertices.size());
+    }
+
+    Statistics Optimize(MeshAsset &mesh, const Settings &settings) {
+        std::vector<MeshAsset::Vertex> &vertices = mesh.getVertices();
+        std::vector<std::uint32_t>     &indices  = mesh.getIndices();
+
+        Statistics statistics{
+            .Before         = AnalyzeVertexCache(indices, std::uint32_t(vertices.size()), settings.CacheSize),
+            .VerticesBefore = std::uint32_t(vertices.size()),
+        };
+
+        if (settings.WeldVertices) WeldVertices(vertices, indices);
+
+        for (const MeshAsset::Submesh &submesh : mesh.getSubmeshes()) {
+            std::span<std::uint32_t> submeshIndices{indices.data() + submesh.FirstIndex, submesh.IndexCount - submesh.IndexCount % 3u};
+
+            OptimizeVertexCache(submeshIndices, std::uint32_t(vertices.size()));
+            if (settings.OptimizeOverdraw)
+                OptimizeOverdraw(submeshIndices, vertices, settings.CacheSize, settings.OverdrawThreshold);
+        }
+
+        statistics.VerticesAfter = OptimizeVertexFetch(vertices, indices);
+        statistics.After         = AnalyzeVertexCache(indices, statistics.VerticesAfter, settings.CacheSize);
+
+        DVRE_INFO("Optimized a vre::MeshAsset: '{}' ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}",
+                  mesh.getName(),
+                  statistics.Before.ACMR, statistics.After.ACMR,
+                  statistics.Before.ATVR, statistics.After.ATVR,
+                  statistics.VerticesBefore, statistics.VerticesAfter);
+
+        return statistics;
+    }
+
+    Statistics Optimize(MeshAsset &mesh) {
+        return Optimize(mesh, Settings{});
+    }
+}  // namespace vre::MeshOptimizer
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include <VREngine/Assets/MeshletBuilder.hpp>
+
+namespace vre::MeshletBuilder {
+    void ComputeBounds(
+        MeshAsset::Meshlet                 &meshlet,
+        std::span<const MeshAsset::Vertex> vertices,
+        std::span<const std::uint32_t>     meshletVertices,
+        std::span<const std::uint32_t>     meshletTriangles) {
+        glm::vec3 minimum{std::numeric_limits<float>::max()};
+        glm::vec3 maximum{std::numeric_limits<float>::lowest()};
+        for (std::uint32_t i = 0u; i < meshlet.VertexCount; i++) {
+            const glm::vec3 &position = vertices[meshletVertices[meshlet.VertexOffset + i]].Position;
+
+            minimum = glm::min(minimum, position);
+            maximum = glm::max(maximum, position);
+        }
+
+        const glm::vec3 center = (minimum + maximum) * 0.5f;
+
+        float radius = 0.0f;
+        for (std::uint32_t i = 0u; i < meshlet.VertexCount; i++)
+            radius = std::max(radius, glm::length(vertices[meshletVertices[meshlet.VertexOffset + i]].Position - center));
+
+        std::vector<glm::vec3> normals{};
+        normals.reserve(meshlet.TriangleCount);
+
+        glm::vec3 axis{0.0f};
+        for (std::uint32_t i = 0u; i < meshlet.TriangleCount; i++) {
+            const std::uint32_t triangle = meshletTriangles[meshlet.TriangleOffset + i];
+
+            const glm::vec3 &a = vertices[meshletVertices[meshlet.VertexOffset + ((triangle >> 0u) & 0xFFu)]].Position;
+            const glm::vec3 &b = vertices[meshletVertices[meshlet.VertexOffset + ((triangle >> 8u) & 0xFFu)]].Position;
+            const glm::vec3 &c = vertices[meshletVertices[meshlet.VertexOffset + ((triangle >> 16u) & 0xFFu)]].Position;
+
+            const glm::vec3 normal = glm::cross(b - a, c - a);
+            const float     area   = glm::length(normal);
+            if (area <= 0.0f) continue;
+
+            normals.push_back(normal / area);
+            axis += normals.back();
+        }
+
+        float cutoff = 1.0f;
+        if (!normals.empty() && glm::length(axis) > 0.0f) {
+            axis = glm::normalize(axis);
+
+            float minimumDot = 1.0f;
+            for (const glm::vec3 &normal : normals)
+                minimumDot = std::min(minimumDot, glm::dot(normal, axis));
+
+            if (minimumDot > 0.1f) cutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+        }
+
+        meshlet.BoundingSphere = glm::vec4{center, radius};
+        meshlet.Cone           = glm::vec4{axis, cutoff};
+    }
+
+    void Build(MeshAsset &mesh, const Settings &settings) {
+        DVRE_ASSERT(settings.MaxVertices >= 3u && settings.MaxVertices <= 256u, "vre::MeshletBuilder supports between 3 and 256 vertices per meshlet");
+        DVRE_ASSERT(settings.MaxTriangles >= 1u, "vre::MeshletBuilder needs at least 1 triangle per meshlet");
+
+        const std::vector<MeshAsset::Vertex> &vertices = mesh.getVertices();
+        const std::vector<std::uint32_t>     &indices  = mesh.getIndices();
+
+        std::vector<MeshAsset::Meshlet> meshlets{};
+        std::vector<std::uint32_t>      meshletVertices{};
+        std::vector<std::uint32_t>      meshletTriangles{};
+        meshletTriangles.reserve(indices.size() / 3u);
+
+        std::vector<std::uint32_t> localIndices(vertices.size(), std::numeric_limits<std::uint32_t>::max());
+
+        const std::vector<MeshAsset::Submesh> &submeshes = mesh.getSubmeshes();
+        for (std::uint32_t s = 0u; s < std::uint32_t(submeshes.size()); s++) {
+            const MeshAsset::Submesh &submesh = submeshes[s];
+
+            MeshAsset::Meshlet meshlet{
+                .VertexOffset   = std::uint32_t(meshletVertices.size()),
+                .TriangleOffset = std::uint32_t(meshletTriangles.size()),
+                .FirstIndex     = submesh.FirstIndex,
+                .Submesh        = s,
+            };
+
+            auto flush = [&](std::uint32_t nextFirstIndex) {
+                if (meshlet.TriangleCount != 0u) {
+                    for (std::uint32_t i = 0u; i < meshlet.VertexCount; i++)
+                        localIndices[meshletVertices[meshlet.VertexOffset + i]] = std::numeric_limits<std::uint32_t>::max();
+
+                    ComputeBounds(meshlet, vertices, meshletVertices, meshletTriangles);
+                    meshlets.push_back(meshlet);
+                }
+
+                meshlet = MeshAsset::Meshlet{
+                    .VertexOffset   = std::uint32_t(meshletVertices.size()),
+                    .TriangleOffset = std::uint32_t(meshletTriangles.size()),
+                    .FirstIndex     = nextFirstIndex,
+                    .Submesh        = s,
+                };
+            };
+
+            const std::uint32_t triangleCount = submesh.IndexCount / 3u;
+            for (std::uint32_t t = 0u; t < triangleCount; t++) {
+                const std::uint32_t  firstIndex = submesh.FirstIndex + t * 3u;
+                const std::uint32_t *triangle   = indices.data() + firstIndex;
+
+                std::uint32_t newVertexCount = 0u;
+                for (std::uint32_t k = 0u; k < 3u; k++) {
+                    const bool isDuplicate = (k > 0u && triangle[k] == triangle[0]) || (k > 1u && triangle[k] == triangle[1]);
+                    if (!isDuplicate && localIndices[triangle[k]] == std::numeric_limits<std::uint32_t>::max()) newVertexCount++;
+                }
+
+                if (meshlet.VertexCount + newVertexCount > settings.MaxVertices || meshlet.TriangleCount + 1u > settings.MaxTriangles)
+                    flush(firstIndex);
+
+                std::uint32_t packed = 0u;
+                for (std::uint32_t k = 0u; k < 3u; k++) {
+                    std::uint32_t &local = localIndices[triangle[k]];
+                    if (local == std::numeric_limits<std::uint32_t>::max()) {
+                        local = meshlet.VertexCount++;
+                        meshletVertices.push_back(triangle[k]);
+                    }
+                    packed |= local << (k * 8u);
+                }
+
+                meshletTriangles.push_back(packed);
+                meshlet.TriangleCount++;
+            }
+
+            flush(submesh.FirstIndex + submesh.IndexCount);
+        }
+
+        DVRE_INFO("Built {} meshlets for a vre::MeshAsset: '{}'", meshlets.size(), mesh.getName());
+
+        mesh.setMeshlets(std::move(meshlets), std::move(meshletVertices), std::move(meshletTriangles));
+    }
+
+    void Build(MeshAsset &mesh) {
+        Build(mesh, Settings{});
+    }
+}  // namespace vre::MeshletBuilder
\ No newline at end of file
@@ -0,0 +1,628 @@
+#include <VREngine/Assets/PixelConversion.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define VRE_PIXEL_CONVERSION_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define VRE_TARGET(targets)
+#else
+#define VRE_TARGET(targets) __attribute__((target(targets)))
+#endif
+#endif
+
+namespace vre::PixelConversion {
+    static constexpr std::size_t PARALLEL_GRAIN = 16384u;
+
+    struct Kernels {
+        void (*ExpandRGB8)(const std::uint8_t *, std::uint8_t *, std::size_t, std::uint8_t);
+        void (*ExpandRGB32F)(const float *, float *, std::size_t, float);
+        void (*SwapRedBlue)(const std::uint8_t *, std::uint8_t *, std::size_t);
+        void (*SRGBToLinear)(const std::uint8_t *, float *, std::size_t);
+        void (*LinearToSRGB)(const float *, std::uint8_t *, std::size_t);
+        void (*PremultiplyAlpha)(const std::uint8_t *, std::uint8_t *, std::size_t);
+        void (*FloatToHalf)(const float *, std::uint16_t *, std::size_t);
+        void (*HalfToFloat)(const std::uint16_t *, float *, std::size_t);
+    };
+
+    static const std::array<float, 256> &GetSRGBToLinearTable() {
+        static const std::array<float, 256> table = [] {
+            std::array<float, 256> values{};
+            for (std::size_t i = 0u; i < values.size(); i++) {
+                const double x = double(i) / 255.0;
+                values[i]      = float(x <= 0.04045 ? x / 12.92 : std::pow((x + 0.055) / 1.055, 2.4));
+            }
+            return values;
+        }();
+        return table;
+    }
+
+    // Indexed by a 16-bit quantized linear value, padded so 32-bit gathers never read past the end.
+    static constexpr std::size_t LINEAR_TO_SRGB_SIZE = 65536u;
+
+    static const std::array<std::uint8_t, LINEAR_TO_SRGB_SIZE + 4u> &GetLinearToSRGBTable() {
+        static const std::array<std::uint8_t, LINEAR_TO_SRGB_SIZE + 4u> table = [] {
+            std::array<std::uint8_t, LINEAR_TO_SRGB_SIZE + 4u> values{};
+            for (std::size_t i = 0u; i < LINEAR_TO_SRGB_SIZE; i++) {
+                const double x    = double(i) / double(LINEAR_TO_SRGB_SIZE - 1u);
+                const double srgb = x <= 0.0031308 ? x * 12.92 : 1.055 * std::pow(x, 1.0 / 2.4) - 0.055;
+                values[i]         = std::uint8_t(std::lround(std::clamp(srgb, 0.0, 1.0) * 255.0));
+            }
+            return values;
+        }();
+        return table;
+    }
+
+    static std::uint32_t QuantizeLinear(float value) {
+        return std::uint32_t(std::clamp(value, 0.0f, 1.0f) * float(LINEAR_TO_SRGB_SIZE - 1u) + 0.5f);
+    }
+
+    static std::uint8_t QuantizeUnorm(float value) {
+        return std::uint8_t(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
+    static std::uint8_t Divide255(std::uint32_t value) {
+        value += 128u;
+        return std::uint8_t((value + (value >> 8u)) >> 8u);
+    }
+
+    namespace Scalar {
+        static void ExpandRGB8(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount, std::uint8_t alpha) {
+            for (std::size_t i = 0u; i < pixelCount; i++) {
+                destination[i * 4u + 0u] = source[i * 3u + 0u];
+                destination[i * 4u + 1u] = source[i * 3u + 1u];
+                destination[i * 4u + 2u] = source[i * 3u + 2u];
+                destination[i * 4u + 3u] = alpha;
+            }
+        }
+
+        static void ExpandRGB32F(const float *source, float *destination, std::size_t pixelCount, float alpha) {
+            for (std::size_t i = 0u; i < pixelCount; i++) {
+                destination[i * 4u + 0u] = source[i * 3u + 0u];
+                destination[i * 4u + 1u] = source[i * 3u + 1u];
+                destination[i * 4u + 2u] = source[i * 3u + 2u];
+                destination[i * 4u + 3u] = alpha;
+            }
+        }
+
+        static void SwapRedBlue(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                const std::uint8_t red  = source[i + 0u];
+                const std::uint8_t blue = source[i + 2u];
+                destination[i + 0u]     = blue;
+                destination[i + 1u]     = source[i + 1u];
+                destination[i + 2u]     = red;
+                destination[i + 3u]     = source[i + 3u];
+            }
+        }
+
+        static void SRGBToLinear(const std::uint8_t *source, float *destination, std::size_t pixelCount) {
+            const std::array<float, 256> &table = GetSRGBToLinearTable();
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                destination[i + 0u] = table[source[i + 0u]];
+                destination[i + 1u] = table[source[i + 1u]];
+                destination[i + 2u] = table[source[i + 2u]];
+                destination[i + 3u] = float(source[i + 3u]) * (1.0f / 255.0f);
+            }
+        }
+
+        static void LinearToSRGB(const float *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const auto &table = GetLinearToSRGBTable();
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                destination[i + 0u] = table[QuantizeLinear(source[i + 0u])];
+                destination[i + 1u] = table[QuantizeLinear(source[i + 1u])];
+                destination[i + 2u] = table[QuantizeLinear(source[i + 2u])];
+                destination[i + 3u] = QuantizeUnorm(source[i + 3u]);
+            }
+        }
+
+        static void PremultiplyAlpha(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                const std::uint32_t alpha = source[i + 3u];
+                destination[i + 0u]       = Divide255(source[i + 0u] * alpha);
+                destination[i + 1u]       = Divide255(source[i + 1u] * alpha);
+                destination[i + 2u]       = Divide255(source[i + 2u] * alpha);
+                destination[i + 3u]       = std::uint8_t(alpha);
+            }
+        }
+
+        static void FloatToHalf(const float *source, std::uint16_t *destination, std::size_t count) {
+            for (std::size_t i = 0u; i < count; i++)
+                destination[i] = std::uint16_t(glm::packHalf1x16(source[i]));
+        }
+
+        static void HalfToFloat(const std::uint16_t *source, float *destination, std::size_t count) {
+            for (std::size_t i = 0u; i < count; i++)
+                destination[i] = glm::unpackHalf1x16(source[i]);
+        }
+
+        static constexpr Kernels KERNELS{
+            ExpandRGB8,
+            ExpandRGB32F,
+            SwapRedBlue,
+            SRGBToLinear,
+            LinearToSRGB,
+            PremultiplyAlpha,
+            FloatToHalf,
+            HalfToFloat,
+        };
+    }  // namespace Scalar
+
+#ifdef VRE_PIXEL_CONVERSION_X86
+    namespace SSE41 {
+        VRE_TARGET("sse4.1")
+        static void ExpandRGB8(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount, std::uint8_t alpha) {
+            const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            const __m128i alphas  = _mm_set1_epi32(int(std::uint32_t(alpha) << 24u));
+
+            // Each load covers four pixels plus four bytes that are shuffled away, so stop before the last one overreads.
+            std::size_t i = 0u;
+            for (; i + 18u <= pixelCount; i += 16u) {
+                const std::uint8_t *input  = source + i * 3u;
+                std::uint8_t       *output = destination + i * 4u;
+                for (std::size_t j = 0u; j < 4u; j++) {
+                    const __m128i pixels = _mm_loadu_si128((const __m128i *)(input + j * 12u));
+                    _mm_storeu_si128((__m128i *)(output + j * 16u), _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), alphas));
+                }
+            }
+            Scalar::ExpandRGB8(source + i * 3u, destination + i * 4u, pixelCount - i, alpha);
+        }
+
+        VRE_TARGET("sse4.1")
+        static void ExpandRGB32F(const float *source, float *destination, std::size_t pixelCount, float alpha) {
+            const __m128 alphas = _mm_set1_ps(alpha);
+
+            std::size_t i = 0u;
+            for (; i + 4u <= pixelCount; i += 4u) {
+                const __m128i a = _mm_castps_si128(_mm_loadu_ps(source + i * 3u + 0u));
+                const __m128i b = _mm_castps_si128(_mm_loadu_ps(source + i * 3u + 4u));
+                const __m128i c = _mm_castps_si128(_mm_loadu_ps(source + i * 3u + 8u));
+
+                float *output = destination + i * 4u;
+                _mm_storeu_ps(output + 0u, _mm_blend_ps(_mm_castsi128_ps(a), alphas, 0x8));
+                _mm_storeu_ps(output + 4u, _mm_blend_ps(_mm_castsi128_ps(_mm_alignr_epi8(b, a, 12)), alphas, 0x8));
+                _mm_storeu_ps(output + 8u, _mm_blend_ps(_mm_castsi128_ps(_mm_alignr_epi8(c, b, 8)), alphas, 0x8));
+                _mm_storeu_ps(output + 12u, _mm_blend_ps(_mm_castsi128_ps(_mm_srli_si128(c, 4)), alphas, 0x8));
+            }
+            Scalar::ExpandRGB32F(source + i * 3u, destination + i * 4u, pixelCount - i, alpha);
+        }
+
+        VRE_TARGET("sse4.1")
+        static void SwapRedBlue(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            std::size_t i = 0u;
+            for (; i + 4u <= pixelCount; i += 4u) {
+                const __m128i pixels = _mm_loadu_si128((const __m128i *)(source + i * 4u));
+                _mm_storeu_si128((__m128i *)(destination + i * 4u), _mm_shuffle_epi8(pixels, shuffle));
+            }
+            Scalar::SwapRedBlue(source + i * 4u, destination + i * 4u, pixelCount - i);
+        }
+
+        VRE_TARGET("sse4.1")
+        static void SRGBToLinear(const std::uint8_t *source, float *destination, std::size_t pixelCount) {
+            const std::array<float, 256> &table = GetSRGBToLinearTable();
+
+            // Without a gather the color lookups stay scalar, they still beat evaluating the curve with a polynomial about
+            // twice over (VREPixelConversionBenchmark). AVX2 does them with one gather per two pixels.
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                const __m128 pixel = _mm_setr_ps(table[source[i + 0u]], table[source[i + 1u]], table[source[i + 2u]], float(source[i + 3u]));
+                _mm_storeu_ps(destination + i, _mm_mul_ps(pixel, _mm_setr_ps(1.0f, 1.0f, 1.0f, 1.0f / 255.0f)));
+            }
+        }
+
+        VRE_TARGET("sse4.1")
+        static void LinearToSRGB(const float *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const auto   &table   = GetLinearToSRGBTable();
+            const __m128  zero    = _mm_setzero_ps();
+            const __m128  one     = _mm_set1_ps(1.0f);
+            const __m128  scale   = _mm_setr_ps(float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), 255.0f);
+            const __m128  half    = _mm_set1_ps(0.5f);
+            const __m128i shuffle = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+            for (std::size_t i = 0u; i < pixelCount * 4u; i += 4u) {
+                const __m128  values  = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i), zero), one);
+                const __m128i indices = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, scale), half));
+
+                const __m128i pixel = _mm_setr_epi32(
+                    table[std::uint32_t(_mm_extract_epi32(indices, 0))],
+                    table[std::uint32_t(_mm_extract_epi32(indices, 1))],
+                    table[std::uint32_t(_mm_extract_epi32(indices, 2))],
+                    _mm_extract_epi32(indices, 3));
+                const int packed = _mm_cvtsi128_si32(_mm_shuffle_epi8(pixel, shuffle));
+                std::memcpy(destination + i, &packed, sizeof(packed));
+            }
+        }
+
+        VRE_TARGET("sse4.1")
+        static __m128i MultiplyAlpha(__m128i pixels, __m128i opaque) {
+            __m128i alphas = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, 0xFF), 0xFF);
+            alphas         = _mm_blend_epi16(alphas, opaque, 0x88);
+
+            __m128i products = _mm_add_epi16(_mm_mullo_epi16(pixels, alphas), _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(products, _mm_srli_epi16(products, 8)), 8);
+        }
+
+        VRE_TARGET("sse4.1")
+        static void PremultiplyAlpha(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const __m128i zero   = _mm_setzero_si128();
+            const __m128i opaque = _mm_set1_epi16(255);
+
+            std::size_t i = 0u;
+            for (; i + 4u <= pixelCount; i += 4u) {
+                const __m128i pixels = _mm_loadu_si128((const __m128i *)(source + i * 4u));
+                const __m128i low    = MultiplyAlpha(_mm_unpacklo_epi8(pixels, zero), opaque);
+                const __m128i high   = MultiplyAlpha(_mm_unpackhi_epi8(pixels, zero), opaque);
+                _mm_storeu_si128((__m128i *)(destination + i * 4u), _mm_packus_epi16(low, high));
+            }
+            Scalar::PremultiplyAlpha(source + i * 4u, destination + i * 4u, pixelCount - i);
+        }
+
+        // Without F16C the conversions are done with integer bit twiddling, rounding to nearest even like vcvtps2ph.
+        VRE_TARGET("sse4.1")
+        static __m128i PackHalves(__m128 values) {
+            const __m128i maxHalf    = _mm_set1_epi32((127 + 16) << 23);
+            const __m128i minNormal  = _mm_set1_epi32((127 - 14) << 23);
+            const __m128i subnormal  = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+            const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+            const __m128i infinity   = _mm_set1_epi32(0x7C00);
+            const __m128i quietNaN   = _mm_set1_epi32(0x200);
+            const __m128  signMask   = _mm_set1_ps(-0.0f);
+
+            const __m128  sign      = _mm_and_ps(values, signMask);
+            const __m128i absolute  = _mm_castps_si128(_mm_xor_ps(values, sign));
+            const __m128  isNaN     = _mm_cmpunord_ps(_mm_castsi128_ps(absolute), _mm_castsi128_ps(absolute));
+            const __m128i isFinite  = _mm_cmpgt_epi32(maxHalf, absolute);
+            const __m128i isSubnorm = _mm_cmpgt_epi32(minNormal, absolute);
+            const __m128i infOrNaN  = _mm_or_si128(_mm_and_si128(_mm_castps_si128(isNaN), quietNaN), infinity);
+
+            // Subnormal halves are rounded by the float adder, normal ones by adding the bias with the odd mantissa bit.
+            const __m128i subnormals = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absolute), _mm_castsi128_ps(subnormal))), subnormal);
+            const __m128i odd        = _mm_srai_epi32(_mm_slli_epi32(absolute, 31 - 13), 31);
+            const __m128i normals    = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absolute, normalBias), odd), 13);
+
+            const __m128i finite = _mm_blendv_epi8(normals, subnormals, isSubnorm);
+            const __m128i halves = _mm_blendv_epi8(infOrNaN, finite, isFinite);
+            return _mm_or_si128(halves, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+        }
+
+        VRE_TARGET("sse4.1")
+        static __m128 UnpackHalves(__m128i halves) {
+            const __m128i magnitudeMask = _mm_set1_epi32(0x7FFF);
+            const __m128  scale         = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+            const __m128i maxFinite     = _mm_set1_epi32(0x7BFF);
+            const __m128i infinity      = _mm_set1_epi32(0x7C00);
+            const __m128i infinityBits  = _mm_set1_epi32(255 << 23);
+            const __m128i quietNaN      = _mm_set1_epi32(1 << 22);
+
+            // Scaling the shifted bits by 2^112 rebiases the exponent and normalizes subnormal halves in one multiply.
+            const __m128i magnitude = _mm_and_si128(halves, magnitudeMask);
+            const __m128i sign      = _mm_slli_epi32(_mm_xor_si128(halves, magnitude), 16);
+            const __m128  scaled    = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(magnitude, 13)), scale);
+            const __m128i infOrNaN  = _mm_and_si128(_mm_cmpgt_epi32(magnitude, maxFinite), infinityBits);
+            const __m128i nan       = _mm_and_si128(_mm_cmpgt_epi32(magnitude, infinity), quietNaN);
+            return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, _mm_or_si128(infOrNaN, nan))));
+        }
+
+        VRE_TARGET("sse4.1")
+        static void FloatToHalf(const float *source, std::uint16_t *destination, std::size_t count) {
+            std::size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m128i low  = PackHalves(_mm_loadu_ps(source + i));
+                const __m128i high = PackHalves(_mm_loadu_ps(source + i + 4u));
+                _mm_storeu_si128((__m128i *)(destination + i), _mm_packus_epi32(low, high));
+            }
+            Scalar::FloatToHalf(source + i, destination + i, count - i);
+        }
+
+        VRE_TARGET("sse4.1")
+        static void HalfToFloat(const std::uint16_t *source, float *destination, std::size_t count) {
+            std::size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m128i halves = _mm_loadu_si128((const __m128i *)(source + i));
+                _mm_storeu_ps(destination + i, UnpackHalves(_mm_cvtepu16_epi32(halves)));
+                _mm_storeu_ps(destination + i + 4u, UnpackHalves(_mm_cvtepu16_epi32(_mm_srli_si128(halves, 8))));
+            }
+            Scalar::HalfToFloat(source + i, destination + i, count - i);
+        }
+
+        static constexpr Kernels KERNELS{
+            ExpandRGB8,
+            ExpandRGB32F,
+            SwapRedBlue,
+            SRGBToLinear,
+            LinearToSRGB,
+            PremultiplyAlpha,
+            FloatToHalf,
+            HalfToFloat,
+        };
+    }  // namespace SSE41
+
+    namespace AVX2 {
+        VRE_TARGET("avx2")
+        static void ExpandRGB8(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount, std::uint8_t alpha) {
+            const __m256i shuffle = _mm256_setr_epi8(
+                0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            const __m256i alphas = _mm256_set1_epi32(int(std::uint32_t(alpha) << 24u));
+
+            std::size_t i = 0u;
+            for (; i + 34u <= pixelCount; i += 32u) {
+                const std::uint8_t *input  = source + i * 3u;
+                std::uint8_t       *output = destination + i * 4u;
+                for (std::size_t j = 0u; j < 4u; j++) {
+                    const __m128i low    = _mm_loadu_si128((const __m128i *)(input + j * 24u));
+                    const __m128i high   = _mm_loadu_si128((const __m128i *)(input + j * 24u + 12u));
+                    const __m256i pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+                    _mm256_storeu_si256((__m256i *)(output + j * 32u), _mm256_or_si256(_mm256_shuffle_epi8(pixels, shuffle), alphas));
+                }
+            }
+            SSE41::ExpandRGB8(source + i * 3u, destination + i * 4u, pixelCount - i, alpha);
+        }
+
+        VRE_TARGET("avx2")
+        static void SwapRedBlue(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const __m256i shuffle = _mm256_setr_epi8(
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            std::size_t i = 0u;
+            for (; i + 8u <= pixelCount; i += 8u) {
+                const __m256i pixels = _mm256_loadu_si256((const __m256i *)(source + i * 4u));
+                _mm256_storeu_si256((__m256i *)(destination + i * 4u), _mm256_shuffle_epi8(pixels, shuffle));
+            }
+            SSE41::SwapRedBlue(source + i * 4u, destination + i * 4u, pixelCount - i);
+        }
+
+        VRE_TARGET("avx2")
+        static void SRGBToLinear(const std::uint8_t *source, float *destination, std::size_t pixelCount) {
+            const float *table = GetSRGBToLinearTable().data();
+            const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+
+            std::size_t i = 0u;
+            for (; i + 2u <= pixelCount; i += 2u) {
+                const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(source + i * 4u)));
+                const __m256  colors  = _mm256_i32gather_ps(table, indices, 4);
+                const __m256  alphas  = _mm256_mul_ps(_mm256_cvtepi32_ps(indices), scale);
+                _mm256_storeu_ps(destination + i * 4u, _mm256_blend_ps(colors, alphas, 0x88));
+            }
+
+            // An odd last pixel goes through the same table with a four lane gather.
+            if (i < pixelCount) {
+                std::int32_t bytes = 0;
+                std::memcpy(&bytes, source + i * 4u, sizeof(bytes));
+                const __m128i indices = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+                const __m128  colors  = _mm_i32gather_ps(table, indices, 4);
+                const __m128  alphas  = _mm_mul_ps(_mm_cvtepi32_ps(indices), _mm256_castps256_ps128(scale));
+                _mm_storeu_ps(destination + i * 4u, _mm_blend_ps(colors, alphas, 0x8));
+            }
+        }
+
+        VRE_TARGET("avx2,fma")
+        static void LinearToSRGB(const float *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const int   *table = (const int *)GetLinearToSRGBTable().data();
+            const __m256 zero  = _mm256_setzero_ps();
+            const __m256 one   = _mm256_set1_ps(1.0f);
+            const __m256 scale = _mm256_setr_ps(
+                float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), 255.0f,
+                float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), float(LINEAR_TO_SRGB_SIZE - 1u), 255.0f);
+            const __m256  half = _mm256_set1_ps(0.5f);
+            const __m256i mask = _mm256_set1_epi32(0xFF);
+
+            std::size_t i = 0u;
+            for (; i + 2u <= pixelCount; i += 2u) {
+                const __m256  values  = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(source + i * 4u), zero), one);
+                const __m256i indices = _mm256_cvttps_epi32(_mm256_fmadd_ps(values, scale, half));
+
+                // Gathers read four bytes per lane; the table is padded and the extra bytes are masked off.
+                const __m256i colors = _mm256_and_si256(_mm256_i32gather_epi32(table, indices, 1), mask);
+                const __m256i pixels = _mm256_blend_epi32(colors, indices, 0x88);
+
+                const __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(pixels), _mm256_extracti128_si256(pixels, 1));
+                _mm_storel_epi64((__m128i *)(destination + i * 4u), _mm_packus_epi16(words, words));
+            }
+
+            if (i < pixelCount) {
+                const __m128  values  = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i * 4u), _mm256_castps256_ps128(zero)), _mm256_castps256_ps128(one));
+                const __m128i indices = _mm_cvttps_epi32(_mm_fmadd_ps(values, _mm256_castps256_ps128(scale), _mm256_castps256_ps128(half)));
+                const __m128i colors  = _mm_and_si128(_mm_i32gather_epi32(table, indices, 1), _mm256_castsi256_si128(mask));
+                const __m128i pixel   = _mm_blend_epi32(colors, indices, 0x8);
+
+                const __m128i words  = _mm_packus_epi32(pixel, pixel);
+                const int     packed = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+                std::memcpy(destination + i * 4u, &packed, sizeof(packed));
+            }
+        }
+
+        VRE_TARGET("avx2")
+        static __m256i MultiplyAlpha(__m256i pixels, __m256i opaque) {
+            __m256i alphas = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pixels, 0xFF), 0xFF);
+            alphas         = _mm256_blend_epi16(alphas, opaque, 0x88);
+
+            __m256i products = _mm256_add_epi16(_mm256_mullo_epi16(pixels, alphas), _mm256_set1_epi16(128));
+            return _mm256_srli_epi16(_mm256_add_epi16(products, _mm256_srli_epi16(products, 8)), 8);
+        }
+
+        VRE_TARGET("avx2")
+        static void PremultiplyAlpha(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+            const __m256i zero   = _mm256_setzero_si256();
+            const __m256i opaque = _mm256_set1_epi16(255);
+
+            std::size_t i = 0u;
+            for (; i + 8u <= pixelCount; i += 8u) {
+                const __m256i pixels = _mm256_loadu_si256((const __m256i *)(source + i * 4u));
+                const __m256i low    = MultiplyAlpha(_mm256_unpacklo_epi8(pixels, zero), opaque);
+                const __m256i high   = MultiplyAlpha(_mm256_unpackhi_epi8(pixels, zero), opaque);
+                _mm256_storeu_si256((__m256i *)(destination + i * 4u), _mm256_packus_epi16(low, high));
+            }
+            SSE41::PremultiplyAlpha(source + i * 4u, destination + i * 4u, pixelCount - i);
+        }
+
+        VRE_TARGET("avx2,f16c")
+        static void FloatToHalf(const float *source, std::uint16_t *destination, std::size_t count) {
+            std::size_t i = 0u;
+            for (; i + 8u <= count; i += 8u) {
+                const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128((__m128i *)(destination + i), halves);
+            }
+            Scalar::FloatToHalf(source + i, destination + i, count - i);
+        }
+
+        VRE_TARGET("avx2,f16c")
+        static void HalfToFloat(const std::uint16_t *source, float *destination, std::size_t count) {
+            std::size_t i = 0u;
+            for (; i + 8u <= count; i += 8u)
+                _mm256_storeu_ps(destination + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(source + i))));
+            Scalar::HalfToFloat(source + i, destination + i, count - i);
+        }
+
+        static constexpr Kernels KERNELS{
+            ExpandRGB8,
+            SSE41::ExpandRGB32F,
+            SwapRedBlue,
+            SRGBToLinear,
+            LinearToSRGB,
+            PremultiplyAlpha,
+            FloatToHalf,
+            HalfToFloat,
+        };
+    }  // namespace AVX2
+
+    static InstructionSet DetectInstructionSet() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        std::array<int, 4> info{};
+        __cpuid(info.data(), 1);
+        const bool hasSSE41   = (info[2] & (1 << 19)) != 0;
+        const bool hasF16C    = (info[2] & (1 << 29)) != 0;
+        const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+        const bool hasYMM     = hasOSXSAVE && (_xgetbv(0) & 0x6u) == 0x6u;
+        __cpuidex(info.data(), 7, 0);
+        const bool hasAVX2 = hasYMM && (info[1] & (1 << 5)) != 0;
+        const bool hasFMA  = hasAVX2;
+#else
+        __builtin_cpu_init();
+        const bool hasSSE41 = __builtin_cpu_supports("sse4.1");
+        const bool hasAVX2  = __builtin_cpu_supports("avx2");
+        const bool hasF16C  = __builtin_cpu_supports("f16c");
+        const bool hasFMA   = __builtin_cpu_supports("fma");
+#endif
+        if (hasAVX2 && hasF16C && hasFMA) return InstructionSet::eAVX2;
+        if (hasSSE41) return InstructionSet::eSSE41;
+        return InstructionSet::eScalar;
+    }
+#else
+    static InstructionSet DetectInstructionSet() {
+        return InstructionSet::eScalar;
+    }
+#endif
+
+    static std::atomic<InstructionSet> g_InstructionSet{GetSupportedInstructionSet()};
+
+    static const Kernels &GetKernels() {
+        switch (g_InstructionSet.load(std::memory_order_relaxed)) {
+#ifdef VRE_PIXEL_CONVERSION_X86
+            case InstructionSet::eAVX2:
+                return AVX2::KERNELS;
+            case InstructionSet::eSSE41:
+                return SSE41::KERNELS;
+#endif
+            default:
+                return Scalar::KERNELS;
+        }
+    }
+
+    template <typename Kernel>
+    static void Run(std::size_t count, std::size_t grainSize, const Kernel &kernel) {
+        if (count > grainSize && ThreadPool::IsInitialized())
+            ThreadPool::ParallelFor(count, grainSize, kernel);
+        else
+            kernel(0u, count);
+    }
+
+    InstructionSet GetSupportedInstructionSet() {
+        static const InstructionSet supported = DetectInstructionSet();
+        return supported;
+    }
+
+    InstructionSet GetInstructionSet() {
+        return g_InstructionSet.load();
+    }
+
+    void SetInstructionSet(InstructionSet instructionSet) {
+        g_InstructionSet = std::min(instructionSet, GetSupportedInstructionSet());
+    }
+
+    void ExpandRGBToRGBA(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount, std::uint8_t alpha) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.ExpandRGB8(source + begin * 3u, destination + begin * 4u, end - begin, alpha);
+        });
+    }
+
+    void ExpandRGBToRGBA(const float *source, float *destination, std::size_t pixelCount, float alpha) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.ExpandRGB32F(source + begin * 3u, destination + begin * 4u, end - begin, alpha);
+        });
+    }
+
+    void SwapRedBlue(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.SwapRedBlue(source + begin * 4u, destination + begin * 4u, end - begin);
+        });
+    }
+
+    void SRGBToLinear(const std::uint8_t *source, float *destination, std::size_t pixelCount) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.SRGBToLinear(source + begin * 4u, destination + begin * 4u, end - begin);
+        });
+    }
+
+    void LinearToSRGB(const float *source, std::uint8_t *destination, std::size_t pixelCount) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.LinearToSRGB(source + begin * 4u, destination + begin * 4u, end - begin);
+        });
+    }
+
+    void PremultiplyAlpha(const std::uint8_t *source, std::uint8_t *destination, std::size_t pixelCount) {
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            kernels.PremultiplyAlpha(source + begin * 4u, destination + begin * 4u, end - begin);
+        });
+    }
+
+    void FloatToHalf(const float *source, std::uint16_t *destination, std::size_t count) {
+        const Kernels &kernels = GetKernels();
+        Run(count, PARALLEL_GRAIN * 4u, [&](std::size_t begin, std::size_t end) {
+            kernels.FloatToHalf(source + begin, destination + begin, end - begin);
+        });
+    }
+
+    void HalfToFloat(const std::uint16_t *source, float *destination, std::size_t count) {
+        const Kernels &kernels = GetKernels();
+        Run(count, PARALLEL_GRAIN * 4u, [&](std::size_t begin, std::size_t end) {
+            kernels.HalfToFloat(source + begin, destination + begin, end - begin);
+        });
+    }
+
+    std::vector<std::uint16_t> PackRGBA16F(const float *source, std::uint32_t channelCount, std::size_t pixelCount) {
+        VRE_ASSERT(channelCount == 3u || channelCount == 4u, "RGBA16F packing needs 3 or 4 channels, got {}", channelCount);
+
+        std::vector<std::uint16_t> destination(pixelCount * 4u);
+        if (channelCount == 4u) {
+            FloatToHalf(source, destination.data(), destination.size());
+            return destination;
+        }
+
+        const Kernels &kernels = GetKernels();
+        Run(pixelCount, PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end) {
+            std::vector<float> expanded((end - begin) * 4u);
+            kernels.ExpandRGB32F(source + begin * 3u, expanded.data(), end - begin, 1.0f);
+            kernels.FloatToHalf(expanded.data(), destination.data() + begin * 4u, expanded.size());
+        });
+        return destination;
+    }
+}  // namespace vre::PixelConversion
\ No newline at end of file
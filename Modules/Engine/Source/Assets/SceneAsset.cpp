@@ -0,0 +1,585 @@
+#include <VREngine/Assets/SceneAsset.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
+#include <VREngine/Assets/FileAsset.hpp>
+#include <VREngine/Assets/CookedSceneAsset.hpp>
+#include <VREngine/Assets/MeshOptimizer.hpp>
+#include <VREngine/Assets/MeshletBuilder.hpp>
+
+namespace vre {
+    enum class SceneImportStream {
+        ePositions,
+        eNormals,
+        eUVs,
+        eColors,
+        eIndices,
+    };
+
+    struct SceneImportPrimitive {
+        std::size_t   Mesh;
+        std::size_t   Primitive;
+        std::uint32_t BaseVertex;
+        std::uint32_t VertexCount;
+        std::uint32_t FirstIndex;
+        std::uint32_t IndexCount;
+    };
+
+    struct SceneImportJob {
+        std::size_t       Primitive;
+        SceneImportStream Stream;
+    };
+
+    static std::string ToString(std::string_view str) {
+        return std::string{str.begin(), str.end()};
+    }
+
+    static std::span<const std::byte> GetBufferBytes(const fastgltf::Buffer &buffer) {
+        std::span<const std::byte> bytes{};
+        std::visit(
+            [&bytes](const auto &source) {
+                if constexpr (requires { source.bytes.data(); source.bytes.size(); })
+                    bytes = std::span<const std::byte>{
+                        reinterpret_cast<const std::byte *>(source.bytes.data()),
+                        source.bytes.size(),
+                    };
+            },
+            buffer.data);
+        return bytes;
+    }
+
+    // Returns the file an image is read from or an empty path when it is embedded, compressed or not a local file.
+    static fs::path GetLocalImagePath(const fastgltf::Image &image, const fs::path &directory) {
+        fs::path path{};
+        std::visit(
+            [&](const auto &source) {
+                using Source = std::decay_t<decltype(source)>;
+
+                if constexpr (std::is_same_v<Source, fastgltf::sources::URI>) {
+                    if (source.mimeType == fastgltf::MimeType::KTX2 || source.mimeType == fastgltf::MimeType::DDS) return;
+                    if (source.fileByteOffset != 0u || !source.uri.isLocalPath()) return;
+                    path = directory / source.uri.fspath();
+                }
+            },
+            image.data);
+        return path;
+    }
+
+    static TextureAsset DecodeImage(const fastgltf::Asset &gltf, const fastgltf::Image &image, const fs::path &directory, const FileAsset *file) {
+        const fs::path name = directory / ToString(image.name);
+
+        std::optional<TextureAsset> texture{};
+        std::visit(
+            [&](const auto &source) {
+                using Source = std::decay_t<decltype(source)>;
+
+                if constexpr (requires { source.mimeType; }) {
+                    if (source.mimeType == fastgltf::MimeType::KTX2 || source.mimeType == fastgltf::MimeType::DDS) {
+                        DVRE_WARN("Skipping unsupported compressed glTF image: '{}'", name.string());
+                        return;
+                    }
+                }
+
+                if constexpr (std::is_same_v<Source, fastgltf::sources::URI>) {
+                    if (source.fileByteOffset != 0u || !source.uri.isLocalPath()) {
+                        DVRE_WARN("Skipping non-local glTF image URI: '{}'", ToString(source.uri.string()));
+                        return;
+                    }
+                    if (file != nullptr) {
+                        const std::string &content = **file;
+                        texture                    = TextureAsset::TryFromData(directory / source.uri.fspath(), content.data(), content.size(), false);
+                    } else {
+                        texture = TextureAsset::TryFromPath(directory / source.uri.fspath(), false);
+                    }
+                } else if constexpr (std::is_same_v<Source, fastgltf::sources::BufferView>) {
+                    const fastgltf::BufferView &view  = gltf.bufferViews[source.bufferViewIndex];
+                    std::span<const std::byte>  bytes = GetBufferBytes(gltf.buffers[view.bufferIndex]);
+                    if (view.byteOffset + view.byteLength > bytes.size()) {
+                        DVRE_WARN("Skipping a glTF image with an out of range buffer view: '{}'", name.string());
+                        return;
+                    }
+                    texture = TextureAsset::TryFromData(name, bytes.data() + view.byteOffset, view.byteLength, false);
+                } else if constexpr (requires { source.bytes.data(); source.bytes.size(); }) {
+                    texture = TextureAsset::TryFromData(name, source.bytes.data(), source.bytes.size(), false);
+                }
+            },
+            image.data);
+
+        // glTF images are RGBA8, an HDR file behind a URI is treated like an unsupported image.
+        if (texture.has_value() && texture->getFormat() != TextureAsset::Format::eRGBA8) {
+            DVRE_WARN("Skipping an HDR glTF image: '{}'", name.string());
+            texture->release();
+            texture.reset();
+        }
+
+        // Images that fail to decode are left empty, like the unsupported ones, so the rest of the scene still imports.
+        return std::move(texture).value_or(TextureAsset{});
+    }
+
+    static glm::mat4 GetLocalTransform(const fastgltf::Node &node) {
+        fastgltf::math::fmat4x4 matrix = fastgltf::getTransformMatrix(node);
+
+        glm::mat4 transform{1.0f};
+        for (std::uint32_t column = 0u; column < 4u; column++)
+            for (std::uint32_t row = 0u; row < 4u; row++)
+                transform[column][row] = matrix[column][row];
+        return transform;
+    }
+
+    static void DecodeStream(
+        const fastgltf::Asset                   &gltf,
+        const SceneImportPrimitive              &range,
+        SceneImportStream                        stream,
+        std::vector<MeshAsset::Vertex>          &vertices,
+        std::vector<std::uint32_t>              &indices) {
+        const fastgltf::Primitive &primitive =
+            gltf.meshes[range.Mesh].primitives[range.Primitive];
+        MeshAsset::Vertex *vertexData = vertices.data() + range.BaseVertex;
+        std::uint32_t     *indexData  = indices.data() + range.FirstIndex;
+
+        auto findAccessor = [&](std::string_view attribute) -> const fastgltf::Accessor * {
+            auto it = primitive.findAttribute(attribute);
+            if (it == primitive.attributes.end()) return nullptr;
+
+            const fastgltf::Accessor &accessor = gltf.accessors[it->accessorIndex];
+            if (accessor.count != range.VertexCount) {
+                DVRE_WARN("Skipping glTF attribute '{}' of mesh '{}' with {} elements for {} vertices",
+                          ToString(attribute), ToString(gltf.meshes[range.Mesh].name), accessor.count, range.VertexCount);
+                return nullptr;
+            }
+            return &accessor;
+        };
+
+        switch (stream) {
+            case SceneImportStream::ePositions: {
+                fastgltf::iterateAccessorWithIndex<glm::vec3>(
+                    gltf, *findAccessor("POSITION"),
+                    [&](glm::vec3 position, std::size_t i) { vertexData[i].Position = position; });
+            } break;
+            case SceneImportStream::eNormals: {
+                const fastgltf::Accessor *accessor = findAccessor("NORMAL");
+                if (accessor == nullptr) return;
+                fastgltf::iterateAccessorWithIndex<glm::vec3>(
+                    gltf, *accessor,
+                    [&](glm::vec3 normal, std::size_t i) { vertexData[i].Normal = normal; });
+            } break;
+            case SceneImportStream::eUVs: {
+                const fastgltf::Accessor *accessor = findAccessor("TEXCOORD_0");
+                if (accessor == nullptr) return;
+                fastgltf::iterateAccessorWithIndex<glm::vec2>(
+                    gltf, *accessor,
+                    [&](glm::vec2 uv, std::size_t i) { vertexData[i].UV = uv; });
+            } break;
+            case SceneImportStream::eColors: {
+                const fastgltf::Accessor *accessor = findAccessor("COLOR_0");
+                if (accessor == nullptr) return;
+                if (accessor->type == fastgltf::AccessorType::Vec3)
+                    fastgltf::iterateAccessorWithIndex<glm::vec3>(
+                        gltf, *accessor,
+                        [&](glm::vec3 color, std::size_t i) { vertexData[i].Color = glm::vec4{color, 1.0f}; });
+                else
+                    fastgltf::iterateAccessorWithIndex<glm::vec4>(
+                        gltf, *accessor,
+                        [&](glm::vec4 color, std::size_t i) { vertexData[i].Color = color; });
+            } break;
+            case SceneImportStream::eIndices: {
+                const std::uint32_t baseVertex = range.BaseVertex;
+                if (!primitive.indicesAccessor.has_value()) {
+                    for (std::uint32_t i = 0u; i < range.IndexCount; i++)
+                        indexData[i] = baseVertex + i;
+                    return;
+                }
+
+                bool isValid = true;
+                fastgltf::iterateAccessorWithIndex<std::uint32_t>(
+                    gltf, gltf.accessors[primitive.indicesAccessor.value()],
+                    [&](std::uint32_t index, std::size_t i) {
+                        isValid      = isValid && index < range.VertexCount;
+                        indexData[i] = baseVertex + index;
+                    });
+
+                // Out of range indices would be fetched out of bounds on the GPU, the primitive is collapsed instead.
+                if (!isValid) {
+                    DVRE_WARN("Dropping glTF primitive {} of mesh '{}' with indices past its {} vertices",
+                              range.Primitive, ToString(gltf.meshes[range.Mesh].name), range.VertexCount);
+                    std::fill(indexData, indexData + range.IndexCount, baseVertex);
+                }
+            } break;
+        }
+    }
+
+    SceneAsset::SceneAsset(
+        const fs::path              &path,
+        std::vector<MeshAsset>     &&meshes,
+        std::vector<TextureAsset>  &&textures,
+        std::vector<Material>      &&materials,
+        std::vector<Node>          &&nodes,
+        std::vector<std::uint32_t> &&rootNodes)
+        : m_Path{path},
+          m_Meshes{std::move(meshes)},
+          m_Textures{std::move(textures)},
+          m_Materials{std::move(materials)},
+          m_Nodes{std::move(nodes)},
+          m_RootNodes{std::move(rootNodes)} {
+        DVRE_INFO("Initializing a vre::SceneAsset from path: '{}'", m_Path.getPath());
+    }
+
+    void SceneAsset::release() {
+        DVRE_INFO("Releasing a vre::SceneAsset from path: '{}'", m_Path.getPath());
+        for (MeshAsset &mesh : m_Meshes)
+            mesh.release();
+        for (TextureAsset &texture : m_Textures)
+            texture.release();
+        m_Meshes.clear();
+        m_Textures.clear();
+        m_Materials.clear();
+        m_Nodes.clear();
+        m_RootNodes.clear();
+    }
+
+    InternedPath SceneAsset::getInternedPath() const { return m_Path; }
+
+    std::string_view SceneAsset::getPath() const { return m_Path.getPath(); }
+
+    std::string_view SceneAsset::getDirectory() const { return m_Path.getDirectory(); }
+
+    std::string_view SceneAsset::getName() const { return m_Path.getName(); }
+
+    std::string_view SceneAsset::getExtension() const { return m_Path.getExtension(); }
+
+    const std::vector<MeshAsset> &SceneAsset::getMeshes() const { return m_Meshes; }
+
+    const std::vector<TextureAsset> &SceneAsset::getTextures() const { return m_Textures; }
+
+    const std::vector<SceneAsset::Material> &SceneAsset::getMaterials() const { return m_Materials; }
+
+    const std::vector<SceneAsset::Node> &SceneAsset::getNodes() const { return m_Nodes; }
+
+    const std::vector<std::uint32_t> &SceneAsset::getRootNodes() const { return m_RootNodes; }
+
+    std::vector<MeshAsset> &SceneAsset::getMeshes() { return m_Meshes; }
+
+    std::vector<TextureAsset> &SceneAsset::getTextures() { return m_Textures; }
+
+    SceneAsset SceneAsset::FromCookedPath(const fs::path &path) {
+        CookedSceneAsset cooked = CookedSceneAsset::FromPath(path);
+
+        std::vector<MeshAsset> meshes{};
+        meshes.reserve(cooked.getMeshes().size());
+        for (const CookedSceneAsset::Mesh &mesh : cooked.getMeshes()) {
+            std::span<const MeshAsset::Vertex>  vertices  = cooked.getVertices(mesh);
+            std::span<const std::uint32_t>      indices   = cooked.getIndices(mesh);
+            std::span<const MeshAsset::Submesh> submeshes = cooked.getSubmeshes(mesh);
+
+            MeshAsset &asset = meshes.emplace_back(
+                std::string{cooked.getString(mesh.Name)},
+                std::vector<MeshAsset::Vertex>{vertices.begin(), vertices.end()},
+                std::vector<std::uint32_t>{indices.begin(), indices.end()},
+                std::vector<MeshAsset::Submesh>{submeshes.begin(), submeshes.end()});
+
+            std::span<const MeshAsset::Meshlet> meshlets         = cooked.getMeshlets(mesh);
+            std::span<const std::uint32_t>      meshletVertices  = cooked.getMeshletVertices(mesh);
+            std::span<const std::uint32_t>      meshletTriangles = cooked.getMeshletTriangles(mesh);
+            asset.setMeshlets(
+                std::vector<MeshAsset::Meshlet>{meshlets.begin(), meshlets.end()},
+                std::vector<std::uint32_t>{meshletVertices.begin(), meshletVertices.end()},
+                std::vector<std::uint32_t>{meshletTriangles.begin(), meshletTriangles.end()});
+        }
+
+        std::vector<TextureAsset> textures(cooked.getTextures().size());
+        for (std::size_t t = 0u; t < textures.size(); t++) {
+            const CookedSceneAsset::Texture &texture = cooked.getTextures()[t];
+            if (texture.DataSize == 0u) continue;
+
+            std::span<const std::byte> data = cooked.getTextureData(texture);
+            textures[t] = TextureAsset::FromPixels(std::string{cooked.getString(texture.Name)}, data.data(), data.size(), texture.Width, texture.Height, texture.MipCount);
+        }
+
+        std::vector<Material> materials{};
+        materials.reserve(cooked.getMaterials().size());
+        for (const CookedSceneAsset::Material &material : cooked.getMaterials())
+            materials.push_back(Material{
+                .Name                     = std::string{cooked.getString(material.Name)},
+                .BaseColorFactor          = material.BaseColorFactor,
+                .MetallicFactor           = material.MetallicFactor,
+                .RoughnessFactor          = material.RoughnessFactor,
+                .BaseColorTexture         = material.BaseColorTexture,
+                .MetallicRoughnessTexture = material.MetallicRoughnessTexture,
+                .NormalTexture            = material.NormalTexture,
+            });
+
+        std::vector<Node> nodes{};
+        nodes.reserve(cooked.getNodes().size());
+        for (const CookedSceneAsset::Node &node : cooked.getNodes()) {
+            std::span<const std::uint32_t> children = cooked.getChildren(node);
+            nodes.push_back(Node{
+                .Name           = std::string{cooked.getString(node.Name)},
+                .Parent         = node.Parent,
+                .Mesh           = node.Mesh,
+                .Children       = std::vector<std::uint32_t>{children.begin(), children.end()},
+                .LocalTransform = node.LocalTransform,
+                .WorldTransform = node.WorldTransform,
+            });
+        }
+
+        std::span<const std::uint32_t> rootNodes = cooked.getRootNodes();
+        std::vector<std::uint32_t>     roots{rootNodes.begin(), rootNodes.end()};
+
+        cooked.release();
+
+        return SceneAsset{
+            path,
+            std::move(meshes),
+            std::move(textures),
+            std::move(materials),
+            std::move(nodes),
+            std::move(roots),
+        };
+    }
+
+    SceneAsset SceneAsset::FromPath(const fs::path &path, bool optimizeMeshes) {
+        VRE_ASSERT(fs::exists(path), "Failed to find a glTF scene from path: '{}'", path.string());
+
+        std::optional<SceneAsset> scene = TryFromPath(path, optimizeMeshes);
+        VRE_ASSERT(scene.has_value(), "Failed to load a glTF scene from path: '{}'", path.string());
+        return std::move(scene.value());
+    }
+
+    std::optional<SceneAsset> SceneAsset::TryFromPath(const fs::path &path, bool optimizeMeshes) {
+        if (!fs::exists(path)) {
+            VRE_WARN("Failed to find a glTF scene from path: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        if (path.extension() == CookedSceneAsset::EXTENSION) return FromCookedPath(path);
+        AssetPrefetcher::RecordAccess(path);
+        DVRE_ASSERT(ThreadPool::IsInitialized(), "vre::ThreadPool must be initialized to import a vre::SceneAsset");
+
+        const fs::path directory = path.parent_path();
+
+        fastgltf::Parser parser{fastgltf::Extensions::KHR_mesh_quantization};
+
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE) && FASTGLTF_HAS_MEMORY_MAPPED_FILE
+        auto data = fastgltf::MappedGltfFile::FromPath(path);
+#else
+        auto data = fastgltf::GltfDataBuffer::FromPath(path);
+#endif
+        if (data.error() != fastgltf::Error::None) {
+            VRE_WARN("Failed to read a glTF scene from path: '{}' with error: '{}'",
+                     path.string(), ToString(fastgltf::getErrorMessage(data.error())));
+            return std::nullopt;
+        }
+
+        auto loaded = parser.loadGltf(data.get(), directory, fastgltf::Options::LoadExternalBuffers);
+        if (loaded.error() != fastgltf::Error::None) {
+            VRE_WARN("Failed to parse a glTF scene from path: '{}' with error: '{}'",
+                     path.string(), ToString(fastgltf::getErrorMessage(loaded.error())));
+            return std::nullopt;
+        }
+
+        const fastgltf::Asset &gltf = loaded.get();
+
+        std::vector<SceneImportPrimitive>           primitives{};
+        std::vector<std::vector<MeshAsset::Vertex>> meshVertices(gltf.meshes.size());
+        std::vector<std::vector<std::uint32_t>>     meshIndices(gltf.meshes.size());
+        std::vector<std::vector<MeshAsset::Submesh>> meshSubmeshes(gltf.meshes.size());
+
+        for (std::size_t m = 0u; m < gltf.meshes.size(); m++) {
+            const fastgltf::Mesh &mesh = gltf.meshes[m];
+
+            std::uint32_t vertexCount = 0u;
+            std::uint32_t indexCount  = 0u;
+            for (std::size_t p = 0u; p < mesh.primitives.size(); p++) {
+                const fastgltf::Primitive &primitive = mesh.primitives[p];
+
+                auto position = primitive.findAttribute("POSITION");
+                if (primitive.type != fastgltf::PrimitiveType::Triangles || position == primitive.attributes.end()) {
+                    DVRE_WARN("Skipping a non-triangle glTF primitive {} of mesh '{}'", p, ToString(mesh.name));
+                    continue;
+                }
+
+                const std::uint32_t primitiveVertexCount = std::uint32_t(gltf.accessors[position->accessorIndex].count);
+                const std::uint32_t primitiveIndexCount =
+                    primitive.indicesAccessor.has_value()
+                        ? std::uint32_t(gltf.accessors[primitive.indicesAccessor.value()].count)
+                        : primitiveVertexCount;
+
+                primitives.push_back(SceneImportPrimitive{
+                    .Mesh        = m,
+                    .Primitive   = p,
+                    .BaseVertex  = vertexCount,
+                    .VertexCount = primitiveVertexCount,
+                    .FirstIndex  = indexCount,
+                    .IndexCount  = primitiveIndexCount,
+                });
+                meshSubmeshes[m].push_back(MeshAsset::Submesh{
+                    .FirstIndex    = indexCount,
+                    .IndexCount    = primitiveIndexCount,
+                    .MaterialIndex = primitive.materialIndex.has_value()
+                                         ? std::int32_t(primitive.materialIndex.value())
+                                         : -1,
+                });
+
+                vertexCount += primitiveVertexCount;
+                indexCount += primitiveIndexCount;
+            }
+
+            meshVertices[m].resize(vertexCount);
+            meshIndices[m].resize(indexCount);
+        }
+
+        std::vector<SceneImportJob> jobs{};
+        jobs.reserve(primitives.size() * 5u);
+        for (std::size_t i = 0u; i < primitives.size(); i++)
+            for (SceneImportStream stream : {
+                     SceneImportStream::ePositions,
+                     SceneImportStream::eNormals,
+                     SceneImportStream::eUVs,
+                     SceneImportStream::eColors,
+                     SceneImportStream::eIndices,
+                 })
+                jobs.push_back(SceneImportJob{.Primitive = i, .Stream = stream});
+
+        // Local image files are read in one vre::AssetIO batch, so with io_uring they are all queued on the device at once and
+        // the workers below only decode them.
+        std::vector<fs::path>    imagePaths{};
+        std::vector<std::size_t> imageFileIndices(gltf.images.size(), std::numeric_limits<std::size_t>::max());
+        if (AssetIO::IsInitialized() && !ThreadPool::IsWorkerThread()) {
+            for (std::size_t i = 0u; i < gltf.images.size(); i++) {
+                fs::path imagePath = GetLocalImagePath(gltf.images[i], directory);
+                if (imagePath.empty() || !fs::exists(imagePath)) continue;
+
+                imageFileIndices[i] = imagePaths.size();
+                imagePaths.push_back(std::move(imagePath));
+            }
+        }
+        std::vector<FileAsset> imageFiles = imagePaths.empty() ? std::vector<FileAsset>{} : FileAsset::FromPathsBinary(imagePaths);
+
+        std::vector<TextureAsset> textures(gltf.images.size());
+
+        ThreadPool::ParallelFor(jobs.size() + gltf.images.size(), [&](std::size_t i) {
+            if (i < jobs.size()) {
+                const SceneImportPrimitive &range = primitives[jobs[i].Primitive];
+                DecodeStream(gltf, range, jobs[i].Stream, meshVertices[range.Mesh], meshIndices[range.Mesh]);
+            } else {
+                const std::size_t image = i - jobs.size();
+                const std::size_t file  = imageFileIndices[image];
+                textures[image]         = DecodeImage(gltf, gltf.images[image], directory, file < imageFiles.size() ? &imageFiles[file] : nullptr);
+            }
+        });
+
+        for (FileAsset &file : imageFiles)
+            file.release();
+
+        std::vector<MeshAsset> meshes{};
+        meshes.reserve(gltf.meshes.size());
+        for (std::size_t m = 0u; m < gltf.meshes.size(); m++)
+            meshes.emplace_back(
+                ToString(gltf.meshes[m].name),
+                std::move(meshVertices[m]),
+                std::move(meshIndices[m]),
+                std::move(meshSubmeshes[m]));
+
+        ThreadPool::ParallelFor(meshes.size(), [&meshes, optimizeMeshes](std::size_t m) {
+            if (optimizeMeshes) MeshOptimizer::Optimize(meshes[m]);
+            MeshletBuilder::Build(meshes[m]);
+        });
+
+        auto getImageIndex = [&gltf](const auto &textureInfo) -> std::int32_t {
+            if (!textureInfo.has_value()) return -1;
+            const fastgltf::Texture &texture = gltf.textures[textureInfo->textureIndex];
+            return texture.imageIndex.has_value() ? std::int32_t(texture.imageIndex.value()) : -1;
+        };
+
+        std::vector<Material> materials{};
+        materials.reserve(gltf.materials.size());
+        for (const fastgltf::Material &material : gltf.materials)
+            materials.push_back(Material{
+                .Name            = ToString(material.name),
+                .BaseColorFactor = glm::vec4{
+                    material.pbrData.baseColorFactor[0],
+                    material.pbrData.baseColorFactor[1],
+                    material.pbrData.baseColorFactor[2],
+                    material.pbrData.baseColorFactor[3],
+                },
+                .MetallicFactor           = material.pbrData.metallicFactor,
+                .RoughnessFactor          = material.pbrData.roughnessFactor,
+                .BaseColorTexture         = getImageIndex(material.pbrData.baseColorTexture),
+                .MetallicRoughnessTexture = getImageIndex(material.pbrData.metallicRoughnessTexture),
+                .NormalTexture            = getImageIndex(material.normalTexture),
+            });
+
+        std::vector<Node> nodes(gltf.nodes.size());
+        std::vector<bool> hasParent(gltf.nodes.size(), false);
+        for (std::size_t n = 0u; n < gltf.nodes.size(); n++) {
+            const fastgltf::Node &node = gltf.nodes[n];
+
+            nodes[n].Name           = ToString(node.name);
+            nodes[n].Mesh           = node.meshIndex.has_value() && node.meshIndex.value() < meshes.size() ? std::int32_t(node.meshIndex.value()) : -1;
+            nodes[n].LocalTransform = GetLocalTransform(node);
+            for (std::size_t child : node.children) {
+                if (child >= gltf.nodes.size() || child == n) {
+                    DVRE_WARN("Skipping invalid child {} of glTF node {}", child, n);
+                    continue;
+                }
+                nodes[n].Children.push_back(std::uint32_t(child));
+                hasParent[child] = true;
+            }
+        }
+
+        std::vector<std::uint32_t> candidates{};
+        if (!gltf.scenes.empty()) {
+            const fastgltf::Scene &scene = gltf.scenes[gltf.defaultScene.value_or(0u)];
+            for (std::size_t node : scene.nodeIndices)
+                if (node < nodes.size()) candidates.push_back(std::uint32_t(node));
+        } else {
+            for (std::size_t n = 0u; n < nodes.size(); n++)
+                if (!hasParent[n]) candidates.push_back(std::uint32_t(n));
+        }
+
+        // Nodes are claimed on their first visit, so a cycle or a node shared by several parents is only walked once and
+        // the edges that would revisit it are dropped from the hierarchy.
+        std::vector<bool>          visited(nodes.size(), false);
+        std::vector<std::uint32_t> rootNodes{};
+        for (std::uint32_t node : candidates) {
+            if (visited[node]) continue;
+            visited[node] = true;
+            rootNodes.push_back(node);
+        }
+
+        std::vector<std::uint32_t> stack{rootNodes.rbegin(), rootNodes.rend()};
+        while (!stack.empty()) {
+            const std::uint32_t index = stack.back();
+            stack.pop_back();
+
+            Node &node          = nodes[index];
+            node.WorldTransform = node.Parent >= 0
+                                      ? nodes[node.Parent].WorldTransform * node.LocalTransform
+                                      : node.LocalTransform;
+
+            std::erase_if(node.Children, [&](std::uint32_t child) {
+                if (visited[child]) {
+                    DVRE_WARN("Dropping a glTF node edge {} -> {} that would revisit a node", index, child);
+                    return true;
+                }
+                visited[child]      = true;
+                nodes[child].Parent = std::int32_t(index);
+                return false;
+            });
+            stack.insert(stack.end(), node.Children.rbegin(), node.Children.rend());
+        }
+
+        for (std::size_t n = 0u; n < nodes.size(); n++)
+            if (!visited[n]) nodes[n].Children.clear();
+
+        DVRE_INFO("Imported glTF scene '{}' with {} meshes, {} primitives, {} images and {} nodes",
+                  path.string(), meshes.size(), primitives.size(), textures.size(), nodes.size());
+
+        return SceneAsset{
+            path,
+            std::move(meshes),
+            std::move(textures),
+            std::move(materials),
+            std::move(nodes),
+            std::move(rootNodes),
+        };
+    }
+}  // namespace vre
\ No newline at end of file
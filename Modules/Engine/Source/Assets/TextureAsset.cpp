@@ -1,4 +1,6 @@
 #include <VREngine/Assets/TextureAsset.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
+#include <VREngine/Assets/PixelConversion.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -8,25 +10,24 @@ namespace vre {
         const fs::path &path, void *data, std::size_t size,
         std::uint32_t width, std::uint32_t height,
         std::uint32_t channelCount, std::uint32_t stride)
-        : m_Path{path.string()}, m_Data{data}, m_Size{size}, m_Width{width}, m_Height{height}, m_ChannelCount{channelCount}, m_Stride{stride} {
-        DVRE_INFO("Initializing a vre::TextureAsset from path: '{}'", m_Path);
-        m_Directory = path.parent_path().string();
-        m_Name      = path.filename().string();
-        m_Extension = path.extension().string();
+        : m_Path{path}, m_Data{data}, m_Size{size}, m_Width{width}, m_Height{height}, m_ChannelCount{channelCount}, m_Stride{stride} {
+        DVRE_INFO("Initializing a vre::TextureAsset from path: '{}'", m_Path.getPath());
     }
 
     void TextureAsset::release() {
-        DVRE_INFO("Releasing a vre::TextureAsset from path: '{}'", m_Path);
+        DVRE_INFO("Releasing a vre::TextureAsset from path: '{}'", m_Path.getPath());
         stbi_image_free(m_Data);
     }
 
-    std::string TextureAsset::getPath() const { return m_Path; }
+    InternedPath TextureAsset::getInternedPath() const { return m_Path; }
 
-    std::string TextureAsset::getDirectory() const { return m_Directory; }
+    std::string_view TextureAsset::getPath() const { return m_Path.getPath(); }
 
-    std::string TextureAsset::getName() const { return m_Name; }
+    std::string_view TextureAsset::getDirectory() const { return m_Path.getDirectory(); }
 
-    std::string TextureAsset::getExtension() const { return m_Extension; }
+    std::string_view TextureAsset::getName() const { return m_Path.getName(); }
+
+    std::string_view TextureAsset::getExtension() const { return m_Path.getExtension(); }
 
     void *TextureAsset::getData() const { return m_Data; }
 
@@ -38,36 +39,310 @@ namespace vre {
 
     std::uint32_t TextureAsset::getChannelCount() const { return m_ChannelCount; }
 
+    TextureAsset::Format TextureAsset::getFormat() const { return m_Format; }
+
+    std::uint32_t TextureAsset::getTexelSize() const { return m_ChannelCount * (m_Format == Format::eRGBA16F ? 2u : 1u); }
+
     std::uint32_t TextureAsset::getStride() const { return m_Stride; }
 
+    std::uint32_t TextureAsset::getMipCount() const { return m_MipCount; }
+
+    std::size_t TextureAsset::getMipOffset(std::uint32_t mip) const {
+        DVRE_ASSERT(mip < m_MipCount, "Mip level {} is out of range for a vre::TextureAsset: '{}'", mip, m_Path.getPath());
+        std::size_t offset = 0u;
+        for (std::uint32_t level = 0u; level < mip; level++)
+            offset += getMipSize(level);
+        return offset;
+    }
+
+    std::size_t TextureAsset::getMipSize(std::uint32_t mip) const {
+        const std::size_t width  = std::max(m_Width >> mip, 1u);
+        const std::size_t height = std::max(m_Height >> mip, 1u);
+        return width * height * getTexelSize();
+    }
+
+    void TextureAsset::generateMips(bool isSRGB) {
+        VRE_ASSERT(m_Data != nullptr, "Cannot generate mips for an empty vre::TextureAsset: '{}'", m_Path.getPath());
+
+        const std::uint32_t mipCount = std::bit_width(std::max(m_Width, m_Height));
+        if (mipCount == m_MipCount) return;
+
+        const std::size_t texelSize = getTexelSize();
+
+        std::size_t size = 0u;
+        for (std::uint32_t mip = 0u; mip < mipCount; mip++)
+            size += std::size_t(std::max(m_Width >> mip, 1u)) * std::max(m_Height >> mip, 1u) * texelSize;
+
+        std::uint8_t *data = (std::uint8_t *)STBI_MALLOC(size);
+        VRE_ASSERT(data != nullptr, "Failed to allocate mips for a vre::TextureAsset: '{}'", m_Path.getPath());
+        std::memcpy(data, m_Data, getMipSize(0u));
+
+        // sRGB colors are averaged in linear space, otherwise every mip gets darker than the level above it. Half floats are
+        // averaged as floats.
+        const bool         isHalfFilter   = m_Format == Format::eRGBA16F;
+        const bool         isLinearFilter = !isHalfFilter && isSRGB && m_ChannelCount == 4u;
+        const bool         isFloatFilter  = isHalfFilter || isLinearFilter;
+        std::vector<float> source{};
+        std::vector<float> destination{};
+        if (isFloatFilter) source.resize(std::size_t(m_Width) * m_Height * m_ChannelCount);
+        if (isLinearFilter) PixelConversion::SRGBToLinear(data, source.data(), std::size_t(m_Width) * m_Height);
+        if (isHalfFilter) PixelConversion::HalfToFloat((const std::uint16_t *)data, source.data(), source.size());
+
+        std::size_t offset = 0u;
+        for (std::uint32_t mip = 1u; mip < mipCount; mip++) {
+            const std::uint32_t sourceWidth  = std::max(m_Width >> (mip - 1u), 1u);
+            const std::uint32_t sourceHeight = std::max(m_Height >> (mip - 1u), 1u);
+            const std::uint32_t width        = std::max(m_Width >> mip, 1u);
+            const std::uint32_t height       = std::max(m_Height >> mip, 1u);
+
+            const std::uint8_t *sourceBytes      = data + offset;
+            std::uint8_t       *destinationBytes = data + offset + std::size_t(sourceWidth) * sourceHeight * texelSize;
+            if (isFloatFilter) destination.resize(std::size_t(width) * height * m_ChannelCount);
+
+            for (std::uint32_t y = 0u; y < height; y++) {
+                const std::uint32_t y0 = std::min(y * 2u, sourceHeight - 1u);
+                const std::uint32_t y1 = std::min(y * 2u + 1u, sourceHeight - 1u);
+                for (std::uint32_t x = 0u; x < width; x++) {
+                    const std::uint32_t x0 = std::min(x * 2u, sourceWidth - 1u);
+                    const std::uint32_t x1 = std::min(x * 2u + 1u, sourceWidth - 1u);
+
+                    const std::size_t i00 = (std::size_t(y0) * sourceWidth + x0) * m_ChannelCount;
+                    const std::size_t i01 = (std::size_t(y0) * sourceWidth + x1) * m_ChannelCount;
+                    const std::size_t i10 = (std::size_t(y1) * sourceWidth + x0) * m_ChannelCount;
+                    const std::size_t i11 = (std::size_t(y1) * sourceWidth + x1) * m_ChannelCount;
+                    const std::size_t out = (std::size_t(y) * width + x) * m_ChannelCount;
+                    for (std::uint32_t c = 0u; c < m_ChannelCount; c++) {
+                        if (isFloatFilter) {
+                            destination[out + c] = (source[i00 + c] + source[i01 + c] + source[i10 + c] + source[i11 + c]) * 0.25f;
+                        } else {
+                            const std::uint32_t sum = sourceBytes[i00 + c] + sourceBytes[i01 + c] + sourceBytes[i10 + c] + sourceBytes[i11 + c];
+                            destinationBytes[out + c] = std::uint8_t((sum + 2u) / 4u);
+                        }
+                    }
+                }
+            }
+
+            if (isLinearFilter) PixelConversion::LinearToSRGB(destination.data(), destinationBytes, std::size_t(width) * height);
+            if (isHalfFilter) PixelConversion::FloatToHalf(destination.data(), (std::uint16_t *)destinationBytes, destination.size());
+            if (isFloatFilter) std::swap(source, destination);
+
+            offset += std::size_t(sourceWidth) * sourceHeight * texelSize;
+        }
+
+        stbi_image_free(m_Data);
+        m_Data     = data;
+        m_Size     = size;
+        m_MipCount = mipCount;
+    }
+
+    void TextureAsset::save(const fs::path &path) const {
+        VRE_ASSERT(m_Data != nullptr, "Cannot save an empty vre::TextureAsset: '{}'", m_Path.getPath());
+        VRE_ASSERT(m_Format == Format::eRGBA8, "Only RGBA8 textures can be cooked: '{}'", m_Path.getPath());
+
+        std::ofstream ofile{path, std::ios::binary | std::ios::trunc};
+        VRE_ASSERT(ofile.is_open(), "Failed to open a cooked texture for writing: '{}'", path.string());
+
+        const CookedHeader header{
+            .Magic        = COOKED_MAGIC,
+            .Version      = COOKED_VERSION,
+            .Width        = m_Width,
+            .Height       = m_Height,
+            .ChannelCount = m_ChannelCount,
+            .MipCount     = m_MipCount,
+            .Size         = m_Size,
+        };
+        ofile.write((const char *)&header, sizeof(CookedHeader));
+        ofile.write((const char *)m_Data, m_Size);
+    }
+
     TextureAsset TextureAsset::FromData(const fs::path &path, void *data, std::size_t size, bool flipVertically) {
-        if (flipVertically) stbi_set_flip_vertically_on_load(1);
+        std::optional<TextureAsset> texture = TryFromData(path, data, size, flipVertically);
+        VRE_ASSERT(texture.has_value(), "Failed to load a vre::TextureAsset file from memory");
+        return std::move(texture.value());
+    }
+
+    std::optional<TextureAsset> TextureAsset::TryFromData(const fs::path &path, const void *data, std::size_t size, bool flipVertically) {
+        if (flipVertically) stbi_set_flip_vertically_on_load_thread(1);
 
-        std::int32_t width   = 0;
-        std::int32_t height  = 0;
-        void        *rawData = stbi_load_from_memory((const stbi_uc *)data, size, &width, &height, nullptr, STBI_rgb_alpha);
+        const stbi_uc *bytes        = (const stbi_uc *)data;
+        const bool     isHDR        = stbi_is_hdr_from_memory(bytes, std::int32_t(size)) != 0;
+        std::int32_t   width        = 0;
+        std::int32_t   height       = 0;
+        std::int32_t   channelCount = 0;
+        void          *rawData      = isHDR
+                                          ? (void *)stbi_loadf_from_memory(bytes, std::int32_t(size), &width, &height, &channelCount, 0)
+                                          : (void *)stbi_load_from_memory(bytes, std::int32_t(size), &width, &height, &channelCount, 0);
 
-        VRE_ASSERT(rawData != nullptr, "Failed to load a vre::TextureAsset file from memory");
+        if (flipVertically) stbi_set_flip_vertically_on_load_thread(0);
 
-        if (flipVertically) stbi_set_flip_vertically_on_load(0);
+        if (rawData == nullptr) {
+            VRE_WARN("Failed to decode a vre::TextureAsset from memory: '{}' with error: '{}'", path.string(), stbi_failure_reason());
+            return std::nullopt;
+        }
 
-        return TextureAsset{path, rawData, std::uint32_t(width * height * 4), std::uint32_t(width), std::uint32_t(height), 4u, std::uint32_t(width) * 4u};
+        return FromDecoded(path, rawData, width, height, channelCount, isHDR);
+    }
+
+    TextureAsset TextureAsset::FromPixels(const fs::path &path, const void *pixels, std::size_t size, std::uint32_t width, std::uint32_t height, std::uint32_t mipCount) {
+        void *data = STBI_MALLOC(size);
+        VRE_ASSERT(data != nullptr, "Failed to allocate a vre::TextureAsset: '{}'", path.string());
+        std::memcpy(data, pixels, size);
+
+        TextureAsset texture{path, data, size, width, height, 4u, width * 4u};
+        texture.m_MipCount = mipCount;
+        return texture;
+    }
+
+    TextureAsset TextureAsset::FromCookedPath(const fs::path &path, bool flipVertically) {
+        std::optional<TextureAsset> texture = TryFromCookedPath(path, flipVertically);
+        VRE_ASSERT(texture.has_value(), "Failed to load a cooked texture from path: '{}'", path.string());
+        return std::move(texture.value());
+    }
+
+    std::optional<TextureAsset> TextureAsset::TryFromCookedPath(const fs::path &path, bool flipVertically) {
+        AssetPrefetcher::RecordAccess(path);
+
+        std::ifstream ifile{path, std::ios::binary};
+        if (!ifile.is_open()) {
+            VRE_WARN("Failed to open a cooked texture from path: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        CookedHeader header{};
+        ifile.read((char *)&header, sizeof(CookedHeader));
+        if (std::size_t(ifile.gcount()) != sizeof(CookedHeader) || header.Magic != COOKED_MAGIC || header.Version != COOKED_VERSION) {
+            VRE_WARN("Cooked texture has an unsupported version: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        std::uint64_t chainSize = 0u;
+        for (std::uint32_t mip = 0u; mip < header.MipCount; mip++)
+            chainSize += std::uint64_t(std::max(header.Width >> mip, 1u)) * std::max(header.Height >> mip, 1u) * header.ChannelCount;
+
+        const bool isValidMipCount = header.MipCount >= 1u && header.MipCount <= std::uint32_t(std::bit_width(std::max(header.Width, header.Height)));
+        if (header.ChannelCount != 4u || header.Width == 0u || header.Height == 0u || !isValidMipCount || header.Size != chainSize) {
+            VRE_WARN("Cooked texture has an invalid layout: '{}'", path.string());
+            return std::nullopt;
+        }
+
+        std::uint8_t *data = (std::uint8_t *)STBI_MALLOC(header.Size);
+        VRE_ASSERT(data != nullptr, "Failed to allocate a cooked texture: '{}'", path.string());
+        ifile.read((char *)data, header.Size);
+        if (std::size_t(ifile.gcount()) != header.Size) {
+            VRE_WARN("Cooked texture is truncated: '{}'", path.string());
+            STBI_FREE(data);
+            return std::nullopt;
+        }
+
+        if (flipVertically) {
+            std::vector<std::uint8_t> row{};
+
+            std::size_t offset = 0u;
+            for (std::uint32_t mip = 0u; mip < header.MipCount; mip++) {
+                const std::size_t width  = std::max(header.Width >> mip, 1u);
+                const std::size_t height = std::max(header.Height >> mip, 1u);
+                const std::size_t pitch  = width * header.ChannelCount;
+
+                row.resize(pitch);
+                for (std::size_t y = 0u; y < height / 2u; y++) {
+                    std::uint8_t *top    = data + offset + y * pitch;
+                    std::uint8_t *bottom = data + offset + (height - 1u - y) * pitch;
+                    std::memcpy(row.data(), top, pitch);
+                    std::memcpy(top, bottom, pitch);
+                    std::memcpy(bottom, row.data(), pitch);
+                }
+                offset += pitch * height;
+            }
+        }
+
+        TextureAsset texture{path, data, header.Size, header.Width, header.Height, header.ChannelCount, header.Width * header.ChannelCount};
+        texture.m_MipCount = header.MipCount;
+        return texture;
     }
 
     TextureAsset TextureAsset::FromPath(const fs::path &path, bool flipVertically) {
         VRE_ASSERT(fs::exists(path), "Failed to find a texture from path: '{}'", path.string());
 
-        if (flipVertically) stbi_set_flip_vertically_on_load(1);
+        std::optional<TextureAsset> texture = TryFromPath(path, flipVertically);
+        VRE_ASSERT(texture.has_value(), "Failed to load a vre::TextureAsset file from path: '{}'", path.string());
+        return std::move(texture.value());
+    }
+
+    std::optional<TextureAsset> TextureAsset::TryFromPath(const fs::path &path, bool flipVertically) {
+        if (!fs::exists(path)) {
+            VRE_WARN("Failed to find a texture from path: '{}'", path.string());
+            return std::nullopt;
+        }
 
-        std::int32_t width   = 0;
-        std::int32_t height  = 0;
-        void        *rawData = stbi_load(path.string().c_str(), &width, &height, nullptr, STBI_rgb_alpha);
+        if (path.extension() == COOKED_EXTENSION) return TryFromCookedPath(path, flipVertically);
+        AssetPrefetcher::RecordAccess(path);
 
-        VRE_ASSERT(rawData != nullptr, "Failed to load a vre::TextureAsset file from path: '{}'", path.string());
+        if (flipVertically) stbi_set_flip_vertically_on_load_thread(1);
 
-        if (flipVertically) stbi_set_flip_vertically_on_load(0);
+        const std::string pathString   = path.string();
+        const bool        isHDR        = stbi_is_hdr(pathString.c_str()) != 0;
+        std::int32_t      width        = 0;
+        std::int32_t      height       = 0;
+        std::int32_t      channelCount = 0;
+        void             *rawData      = isHDR
+                                             ? (void *)stbi_loadf(pathString.c_str(), &width, &height, &channelCount, 0)
+                                             : (void *)stbi_load(pathString.c_str(), &width, &height, &channelCount, 0);
 
-        return TextureAsset{path, rawData, std::uint32_t(width * height * 4), std::uint32_t(width), std::uint32_t(height), 4u, std::uint32_t(width) * 4u};
+        if (flipVertically) stbi_set_flip_vertically_on_load_thread(0);
+
+        if (rawData == nullptr) {
+            VRE_WARN("Failed to decode a vre::TextureAsset from path: '{}' with error: '{}'", pathString, stbi_failure_reason());
+            return std::nullopt;
+        }
+
+        return FromDecoded(path, rawData, width, height, channelCount, isHDR);
     }
 
+    std::optional<TextureAsset> TextureAsset::FromDecoded(const fs::path &path, void *rawData, std::int32_t width, std::int32_t height, std::int32_t channelCount, bool isHDR) {
+        const std::size_t pixelCount = std::size_t(width) * std::size_t(height);
+
+        // Radiance images decode to three float channels and are packed to RGBA16F so they keep their range.
+        if (isHDR) {
+            if (channelCount != 3 && channelCount != 4) {
+                VRE_WARN("HDR texture has {} channels, only RGB and RGBA are supported: '{}'", channelCount, path.string());
+                stbi_image_free(rawData);
+                return std::nullopt;
+            }
+
+            const std::vector<std::uint16_t> halves = PixelConversion::PackRGBA16F((const float *)rawData, std::uint32_t(channelCount), pixelCount);
+            stbi_image_free(rawData);
+
+            void *data = STBI_MALLOC(halves.size() * sizeof(std::uint16_t));
+            VRE_ASSERT(data != nullptr, "Failed to allocate a vre::TextureAsset: '{}'", path.string());
+            std::memcpy(data, halves.data(), halves.size() * sizeof(std::uint16_t));
+
+            TextureAsset texture{path, data, halves.size() * sizeof(std::uint16_t), std::uint32_t(width), std::uint32_t(height), 4u, std::uint32_t(width) * 8u};
+            texture.m_Format = Format::eRGBA16F;
+            return texture;
+        }
+
+        // Images are decoded at the channel count they are stored with and expanded here, RGB with the SIMD kernels instead
+        // of stb's per-pixel conversion.
+        if (channelCount != 4) {
+            std::uint8_t *expanded = (std::uint8_t *)STBI_MALLOC(pixelCount * 4u);
+            VRE_ASSERT(expanded != nullptr, "Failed to allocate a vre::TextureAsset: '{}'", path.string());
+
+            const std::uint8_t *source = (const std::uint8_t *)rawData;
+            if (channelCount == 3) {
+                PixelConversion::ExpandRGBToRGBA(source, expanded, pixelCount);
+            } else {
+                for (std::size_t i = 0u; i < pixelCount; i++) {
+                    const std::uint8_t *pixel = source + i * std::size_t(channelCount);
+                    expanded[i * 4u + 0u]     = pixel[0u];
+                    expanded[i * 4u + 1u]     = pixel[0u];
+                    expanded[i * 4u + 2u]     = pixel[0u];
+                    expanded[i * 4u + 3u]     = channelCount == 2 ? pixel[1u] : 255u;
+                }
+            }
+            stbi_image_free(rawData);
+            rawData = expanded;
+        }
+
+        return TextureAsset{path, rawData, pixelCount * 4u, std::uint32_t(width), std::uint32_t(height), 4u, std::uint32_t(width) * 4u};
+    }
 }  // namespace vre
\ No newline at end of file
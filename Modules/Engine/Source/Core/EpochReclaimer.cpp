@@ -0,0 +1,111 @@
+#include <VREngine/Core/EpochReclaimer.hpp>
+
+namespace vre {
+    namespace {
+        struct ThreadIndices {
+            std::mutex                 Mutex;
+            std::vector<std::uint32_t> Free;
+            std::uint32_t              Next{0u};
+        };
+
+        ThreadIndices &GetThreadIndices() {
+            static ThreadIndices indices{};
+            return indices;
+        }
+
+        // Owned by a thread_local, the index goes back to the free list when its thread exits. A thread only exits
+        // outside of a Guard, so the slot it leaves behind is inactive and can be handed to the next thread as is.
+        class ThreadIndex {
+           public:
+            ThreadIndex() {
+                ThreadIndices              &indices = GetThreadIndices();
+                std::lock_guard<std::mutex> lock{indices.Mutex};
+                if (indices.Free.empty()) {
+                    m_Value = indices.Next++;
+                } else {
+                    m_Value = indices.Free.back();
+                    indices.Free.pop_back();
+                }
+            }
+
+            ~ThreadIndex() {
+                ThreadIndices              &indices = GetThreadIndices();
+                std::lock_guard<std::mutex> lock{indices.Mutex};
+                indices.Free.push_back(m_Value);
+            }
+
+            ThreadIndex(const ThreadIndex &)            = delete;
+            ThreadIndex &operator=(const ThreadIndex &) = delete;
+
+            std::uint32_t get() const { return m_Value; }
+
+           private:
+            std::uint32_t m_Value{0u};
+        };
+    }  // namespace
+
+    EpochReclaimer::Guard::Guard(std::atomic<std::uint64_t> &slot, std::uint64_t epoch)
+        : m_Slot{&slot}, m_IsOutermost{slot.load(std::memory_order_relaxed) == INACTIVE} {
+        if (m_IsOutermost) m_Slot->store(epoch, std::memory_order_seq_cst);
+    }
+
+    EpochReclaimer::Guard::~Guard() {
+        if (m_IsOutermost) m_Slot->store(INACTIVE, std::memory_order_release);
+    }
+
+    EpochReclaimer::~EpochReclaimer() {
+        flush();
+    }
+
+    EpochReclaimer::Guard EpochReclaimer::pin() {
+        return Guard{m_Slots[GetThreadIndex()].Epoch, m_Epoch.load(std::memory_order_seq_cst)};
+    }
+
+    void EpochReclaimer::retire(std::function<void()> &&deleter) {
+        const std::uint64_t epoch = m_Epoch.fetch_add(1u, std::memory_order_seq_cst);
+
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        m_Retired.push_back(Retired{epoch, std::move(deleter)});
+    }
+
+    void EpochReclaimer::collect() {
+        std::uint64_t oldestEpoch = INACTIVE;
+        for (const Slot &slot : m_Slots)
+            oldestEpoch = std::min(oldestEpoch, slot.Epoch.load(std::memory_order_seq_cst));
+
+        std::vector<Retired> reclaimable{};
+        {
+            std::lock_guard<std::mutex> lock{m_Mutex};
+            auto                        it = std::partition(m_Retired.begin(), m_Retired.end(), [oldestEpoch](const Retired &retired) {
+                return retired.Epoch >= oldestEpoch;
+            });
+            std::move(it, m_Retired.end(), std::back_inserter(reclaimable));
+            m_Retired.erase(it, m_Retired.end());
+        }
+
+        for (Retired &retired : reclaimable)
+            retired.Deleter();
+    }
+
+    void EpochReclaimer::flush() {
+        std::vector<Retired> retired{};
+        {
+            std::lock_guard<std::mutex> lock{m_Mutex};
+            retired.swap(m_Retired);
+        }
+
+        for (Retired &entry : retired)
+            entry.Deleter();
+    }
+
+    std::size_t EpochReclaimer::getRetiredCount() {
+        std::lock_guard<std::mutex> lock{m_Mutex};
+        return m_Retired.size();
+    }
+
+    std::uint32_t EpochReclaimer::GetThreadIndex() {
+        thread_local const ThreadIndex index{};
+        VRE_ASSERT(index.get() < MAX_THREADS, "vre::EpochReclaimer supports at most {} threads alive at the same time", MAX_THREADS);
+        return index.get();
+    }
+}  // namespace vre
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <VREngine/Core/Hash.hpp>
+
+namespace vre::Hash {
+    static constexpr std::uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+    static constexpr std::uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr std::uint64_t PRIME_3 = 0x165667B19E3779F9ull;
+
+    static std::uint64_t Mix(std::uint64_t value) {
+        value ^= value >> 33u;
+        value *= PRIME_2;
+        value ^= value >> 29u;
+        value *= PRIME_3;
+        value ^= value >> 32u;
+        return value;
+    }
+
+    static std::uint64_t Round(std::uint64_t hash, std::uint64_t word) {
+        return std::rotl(hash ^ (word * PRIME_2), 31) * PRIME_1;
+    }
+
+    std::uint64_t Bytes(const void *data, std::size_t size, std::uint64_t seed) {
+        const std::byte *bytes = reinterpret_cast<const std::byte *>(data);
+
+        std::array<std::uint64_t, 4> lanes{
+            seed + PRIME_1 + PRIME_2,
+            seed + PRIME_2,
+            seed,
+            seed - PRIME_1,
+        };
+
+        std::size_t offset = 0u;
+        for (; offset + 32u <= size; offset += 32u) {
+            for (std::uint32_t lane = 0u; lane < 4u; lane++) {
+                std::uint64_t word = 0u;
+                std::memcpy(&word, bytes + offset + lane * 8u, 8u);
+                lanes[lane] = Round(lanes[lane], word);
+            }
+        }
+
+        std::uint64_t hash = std::uint64_t(size) * PRIME_3;
+        for (std::uint64_t lane : lanes)
+            hash = Round(hash, lane);
+
+        for (; offset + 8u <= size; offset += 8u) {
+            std::uint64_t word = 0u;
+            std::memcpy(&word, bytes + offset, 8u);
+            hash = Round(hash, word);
+        }
+
+        if (offset < size) {
+            std::uint64_t word = 0u;
+            std::memcpy(&word, bytes + offset, size - offset);
+            hash = Round(hash, word);
+        }
+
+        return Mix(hash);
+    }
+
+    std::uint64_t String(std::string_view string, std::uint64_t seed) {
+        return Bytes(string.data(), string.size(), seed);
+    }
+
+    std::uint64_t File(const fs::path &path, std::uint64_t seed) {
+        std::optional<std::uint64_t> hash = TryFile(path, seed);
+        VRE_ASSERT(hash.has_value(), "Failed to open a file to hash from path: '{}'", path.string());
+        return hash.value();
+    }
+
+    std::optional<std::uint64_t> TryFile(const fs::path &path, std::uint64_t seed) {
+        std::ifstream ifile{path, std::ios::ate | std::ios::binary};
+        if (!ifile.is_open()) return std::nullopt;
+
+        std::string content{};
+        content.resize(std::size_t(ifile.tellg()));
+        ifile.seekg(0);
+        ifile.read(content.data(), content.size());
+        if (std::size_t(ifile.gcount()) != content.size()) return std::nullopt;
+
+        return Bytes(content.data(), content.size(), seed);
+    }
+
+    std::uint64_t Combine(std::uint64_t seed, std::uint64_t value) {
+        return Mix(seed ^ (value + PRIME_1 + (seed << 6u) + (seed >> 2u)));
+    }
+}  // namespace vre::Hash
\ No newline at end of file
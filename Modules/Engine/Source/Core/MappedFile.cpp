@@ -0,0 +1,63 @@
+#include <VREngine/Core/MappedFile.hpp>
+
+#ifdef VRE_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vre {
+#ifdef VRE_PLATFORM_WINDOWS
+    MappedFile::MappedFile(const fs::path &path) {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return;
+        m_File = file;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) return;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) return;
+        m_Mapping = mapping;
+
+        m_Data = (const std::byte *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (m_Data != nullptr) m_Size = std::size_t(size.QuadPart);
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_Data != nullptr) UnmapViewOfFile(m_Data);
+        if (m_Mapping != nullptr) CloseHandle(m_Mapping);
+        if (m_File != nullptr) CloseHandle(m_File);
+    }
+#else
+    MappedFile::MappedFile(const fs::path &path) {
+        m_File = open(path.c_str(), O_RDONLY);
+        if (m_File < 0) return;
+
+        struct stat status{};
+        if (fstat(m_File, &status) != 0 || status.st_size == 0) return;
+
+        void *data = mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, m_File, 0);
+        if (data == MAP_FAILED) return;
+
+        m_Data = (const std::byte *)data;
+        m_Size = std::size_t(status.st_size);
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_Data != nullptr) munmap((void *)m_Data, m_Size);
+        if (m_File >= 0) close(m_File);
+    }
+#endif
+
+    bool MappedFile::isOpen() const { return m_Data != nullptr; }
+
+    const std::byte *MappedFile::getData() const { return m_Data; }
+
+    std::size_t MappedFile::getSize() const { return m_Size; }
+}  // namespace vre
\ No newline at end of file
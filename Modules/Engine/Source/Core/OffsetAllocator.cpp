@@ -0,0 +1,269 @@
+// Based on OffsetAllocator by Sebastian Aaltonen (https://github.com/sebbbi/OffsetAllocator).
+//
+// MIT License
+//
+// Copyright (c) 2023 Sebastian Aaltonen
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <VREngine/Core/OffsetAllocator.hpp>
+
+namespace vre {
+    namespace {
+        constexpr std::uint32_t MANTISSA_BITS  = 3u;
+        constexpr std::uint32_t MANTISSA_VALUE = 1u << MANTISSA_BITS;
+        constexpr std::uint32_t MANTISSA_MASK  = MANTISSA_VALUE - 1u;
+
+        // Sizes are binned by a tiny float with a 3 bit mantissa and a 5 bit exponent, which keeps bins within 12.5% of each other.
+        std::uint32_t ToBinRoundUp(std::uint32_t size) {
+            if (size < MANTISSA_VALUE) return size;
+
+            const std::uint32_t highestSetBit    = 31u - std::uint32_t(std::countl_zero(size));
+            const std::uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+            const std::uint32_t exponent         = mantissaStartBit + 1u;
+            std::uint32_t       mantissa         = (size >> mantissaStartBit) & MANTISSA_MASK;
+            if ((size & ((1u << mantissaStartBit) - 1u)) != 0u) mantissa++;
+
+            // A rounded up mantissa carries into the exponent.
+            return (exponent << MANTISSA_BITS) + mantissa;
+        }
+
+        std::uint32_t ToBinRoundDown(std::uint32_t size) {
+            if (size < MANTISSA_VALUE) return size;
+
+            const std::uint32_t highestSetBit    = 31u - std::uint32_t(std::countl_zero(size));
+            const std::uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+            const std::uint32_t exponent         = mantissaStartBit + 1u;
+            const std::uint32_t mantissa         = (size >> mantissaStartBit) & MANTISSA_MASK;
+            return (exponent << MANTISSA_BITS) | mantissa;
+        }
+
+        std::uint32_t FindLowestSetBitAfter(std::uint32_t mask, std::uint32_t startBit) {
+            if (startBit >= 32u) return OffsetAllocator::NO_SPACE;
+
+            const std::uint32_t bitsAfter = mask & ~((1u << startBit) - 1u);
+            return bitsAfter != 0u ? std::uint32_t(std::countr_zero(bitsAfter)) : OffsetAllocator::NO_SPACE;
+        }
+    }  // namespace
+
+    bool OffsetAllocator::Allocation::isValid() const {
+        return Offset != NO_SPACE;
+    }
+
+    OffsetAllocator::OffsetAllocator(std::uint32_t size, std::uint32_t maxAllocations)
+        : m_Size(size),
+          m_MaxAllocations(maxAllocations) {
+        DVRE_ASSERT(maxAllocations >= 2u, "vre::OffsetAllocator needs room for at least 2 allocations");
+        reset();
+    }
+
+    OffsetAllocator::Allocation OffsetAllocator::allocate(std::uint32_t size) {
+        // Splitting off the remainder may need one more node than the allocation itself.
+        if (size == 0u || m_FreeNodes.empty()) return Allocation{};
+
+        const std::uint32_t minBinIndex     = ToBinRoundUp(size);
+        const std::uint32_t minTopBinIndex  = minBinIndex >> MANTISSA_BITS;
+        const std::uint32_t minLeafBinIndex = minBinIndex & MANTISSA_MASK;
+
+        std::uint32_t topBinIndex  = minTopBinIndex;
+        std::uint32_t leafBinIndex = NO_SPACE;
+        if (topBinIndex < TOP_BIN_COUNT && (m_UsedBinsTop & (1u << topBinIndex)))
+            leafBinIndex = FindLowestSetBitAfter(m_UsedBins[topBinIndex], minLeafBinIndex);
+
+        if (leafBinIndex == NO_SPACE) {
+            topBinIndex = FindLowestSetBitAfter(m_UsedBinsTop, minTopBinIndex + 1u);
+            if (topBinIndex == NO_SPACE) return Allocation{};
+            leafBinIndex = std::uint32_t(std::countr_zero(std::uint32_t(m_UsedBins[topBinIndex])));
+        }
+
+        const std::uint32_t binIndex  = (topBinIndex << MANTISSA_BITS) | leafBinIndex;
+        const std::uint32_t nodeIndex = m_BinIndices[binIndex];
+
+        Node               &node          = m_Nodes[nodeIndex];
+        const std::uint32_t nodeTotalSize = node.DataSize;
+        node.DataSize                     = size;
+        node.IsUsed                       = true;
+
+        m_BinIndices[binIndex] = node.BinListNext;
+        if (node.BinListNext != Node::UNUSED) m_Nodes[node.BinListNext].BinListPrev = Node::UNUSED;
+        node.BinListNext = Node::UNUSED;
+
+        m_FreeStorage -= nodeTotalSize;
+        m_FreeRegionCount--;
+        m_AllocationCount++;
+
+        if (m_BinIndices[binIndex] == Node::UNUSED) {
+            m_UsedBins[topBinIndex] &= std::uint8_t(~(1u << leafBinIndex));
+            if (m_UsedBins[topBinIndex] == 0u) m_UsedBinsTop &= ~(1u << topBinIndex);
+        }
+
+        const std::uint32_t remainder = nodeTotalSize - size;
+        if (remainder > 0u) {
+            const std::uint32_t newNodeIndex = insertNodeIntoBin(remainder, node.DataOffset + size);
+
+            if (node.NeighborNext != Node::UNUSED) m_Nodes[node.NeighborNext].NeighborPrev = newNodeIndex;
+            m_Nodes[newNodeIndex].NeighborPrev = nodeIndex;
+            m_Nodes[newNodeIndex].NeighborNext = node.NeighborNext;
+            node.NeighborNext                  = newNodeIndex;
+        }
+
+        return Allocation{node.DataOffset, nodeIndex};
+    }
+
+    void OffsetAllocator::free(const Allocation &allocation) {
+        if (allocation.NodeIndex == NO_SPACE) return;
+        DVRE_ASSERT(allocation.NodeIndex < m_Nodes.size() && m_Nodes[allocation.NodeIndex].IsUsed, "Invalid vre::OffsetAllocator allocation at offset {}", allocation.Offset);
+
+        const std::uint32_t nodeIndex = allocation.NodeIndex;
+        Node               &node      = m_Nodes[nodeIndex];
+
+        std::uint32_t offset = node.DataOffset;
+        std::uint32_t size   = node.DataSize;
+
+        if (node.NeighborPrev != Node::UNUSED && !m_Nodes[node.NeighborPrev].IsUsed) {
+            const Node &previous = m_Nodes[node.NeighborPrev];
+            offset               = previous.DataOffset;
+            size += previous.DataSize;
+
+            removeNodeFromBin(node.NeighborPrev);
+            node.NeighborPrev = previous.NeighborPrev;
+        }
+
+        if (node.NeighborNext != Node::UNUSED && !m_Nodes[node.NeighborNext].IsUsed) {
+            const Node &next = m_Nodes[node.NeighborNext];
+            size += next.DataSize;
+
+            removeNodeFromBin(node.NeighborNext);
+            node.NeighborNext = next.NeighborNext;
+        }
+
+        const std::uint32_t neighborNext = node.NeighborNext;
+        const std::uint32_t neighborPrev = node.NeighborPrev;
+
+        node = Node{};
+        m_FreeNodes.push_back(nodeIndex);
+        m_AllocationCount--;
+
+        const std::uint32_t combinedNodeIndex = insertNodeIntoBin(size, offset);
+        if (neighborNext != Node::UNUSED) {
+            m_Nodes[combinedNodeIndex].NeighborNext = neighborNext;
+            m_Nodes[neighborNext].NeighborPrev      = combinedNodeIndex;
+        }
+        if (neighborPrev != Node::UNUSED) {
+            m_Nodes[combinedNodeIndex].NeighborPrev = neighborPrev;
+            m_Nodes[neighborPrev].NeighborNext      = combinedNodeIndex;
+        }
+    }
+
+    void OffsetAllocator::reset() {
+        m_FreeStorage     = 0u;
+        m_FreeRegionCount = 0u;
+        m_AllocationCount = 0u;
+        m_UsedBinsTop     = 0u;
+        m_UsedBins.fill(0u);
+        m_BinIndices.fill(Node::UNUSED);
+
+        m_Nodes.assign(m_MaxAllocations, Node{});
+        m_FreeNodes.resize(m_MaxAllocations);
+        for (std::uint32_t i = 0u; i < m_MaxAllocations; i++)
+            m_FreeNodes[i] = m_MaxAllocations - i - 1u;
+
+        if (m_Size != 0u) insertNodeIntoBin(m_Size, 0u);
+    }
+
+    std::uint32_t OffsetAllocator::getAllocationSize(const Allocation &allocation) const {
+        if (allocation.NodeIndex == NO_SPACE) return 0u;
+        return m_Nodes[allocation.NodeIndex].DataSize;
+    }
+
+    std::uint32_t OffsetAllocator::getSize() const {
+        return m_Size;
+    }
+
+    OffsetAllocator::StorageReport OffsetAllocator::getStorageReport() const {
+        std::uint32_t largestFreeRegion = 0u;
+        if (m_UsedBinsTop != 0u) {
+            const std::uint32_t topBinIndex  = 31u - std::uint32_t(std::countl_zero(m_UsedBinsTop));
+            const std::uint32_t leafBinIndex = 31u - std::uint32_t(std::countl_zero(std::uint32_t(m_UsedBins[topBinIndex])));
+
+            // Every region in the largest bin is at least the bin size, so take the exact maximum from its list.
+            for (std::uint32_t nodeIndex = m_BinIndices[(topBinIndex << MANTISSA_BITS) | leafBinIndex]; nodeIndex != Node::UNUSED; nodeIndex = m_Nodes[nodeIndex].BinListNext)
+                largestFreeRegion = std::max(largestFreeRegion, m_Nodes[nodeIndex].DataSize);
+        }
+
+        return StorageReport{
+            .TotalFreeSpace    = m_FreeStorage,
+            .LargestFreeRegion = largestFreeRegion,
+            .FreeRegionCount   = m_FreeRegionCount,
+            .AllocationCount   = m_AllocationCount,
+        };
+    }
+
+    std::uint32_t OffsetAllocator::insertNodeIntoBin(std::uint32_t size, std::uint32_t dataOffset) {
+        const std::uint32_t binIndex     = ToBinRoundDown(size);
+        const std::uint32_t topBinIndex  = binIndex >> MANTISSA_BITS;
+        const std::uint32_t leafBinIndex = binIndex & MANTISSA_MASK;
+
+        if (m_BinIndices[binIndex] == Node::UNUSED) {
+            m_UsedBins[topBinIndex] |= std::uint8_t(1u << leafBinIndex);
+            m_UsedBinsTop |= 1u << topBinIndex;
+        }
+
+        const std::uint32_t topNodeIndex = m_BinIndices[binIndex];
+        const std::uint32_t nodeIndex    = m_FreeNodes.back();
+        m_FreeNodes.pop_back();
+
+        m_Nodes[nodeIndex] = Node{
+            .DataOffset  = dataOffset,
+            .DataSize    = size,
+            .BinListNext = topNodeIndex,
+        };
+        if (topNodeIndex != Node::UNUSED) m_Nodes[topNodeIndex].BinListPrev = nodeIndex;
+        m_BinIndices[binIndex] = nodeIndex;
+
+        m_FreeStorage += size;
+        m_FreeRegionCount++;
+        return nodeIndex;
+    }
+
+    void OffsetAllocator::removeNodeFromBin(std::uint32_t nodeIndex) {
+        const Node &node = m_Nodes[nodeIndex];
+
+        if (node.BinListPrev != Node::UNUSED) {
+            m_Nodes[node.BinListPrev].BinListNext = node.BinListNext;
+            if (node.BinListNext != Node::UNUSED) m_Nodes[node.BinListNext].BinListPrev = node.BinListPrev;
+        } else {
+            const std::uint32_t binIndex     = ToBinRoundDown(node.DataSize);
+            const std::uint32_t topBinIndex  = binIndex >> MANTISSA_BITS;
+            const std::uint32_t leafBinIndex = binIndex & MANTISSA_MASK;
+
+            m_BinIndices[binIndex] = node.BinListNext;
+            if (node.BinListNext != Node::UNUSED) m_Nodes[node.BinListNext].BinListPrev = Node::UNUSED;
+
+            if (m_BinIndices[binIndex] == Node::UNUSED) {
+                m_UsedBins[topBinIndex] &= std::uint8_t(~(1u << leafBinIndex));
+                if (m_UsedBins[topBinIndex] == 0u) m_UsedBinsTop &= ~(1u << topBinIndex);
+            }
+        }
+
+        m_FreeStorage -= node.DataSize;
+        m_FreeRegionCount--;
+        m_FreeNodes.push_back(nodeIndex);
+    }
+}  // namespace vre
\ No newline at end of file
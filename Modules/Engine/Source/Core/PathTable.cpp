@@ -0,0 +1,85 @@
+#include <VREngine/Core/PathTable.hpp>
+
+namespace vre {
+    std::array<std::unique_ptr<PathTable::Entry[]>, PathTable::MAX_CHUNKS> PathTable::g_Chunks{};
+    std::unordered_map<std::string_view, PathTable::Id>                    PathTable::g_Ids{};
+    std::mutex                                                             PathTable::g_Mutex{};
+    std::atomic<std::uint32_t>                                             PathTable::g_Count{0u};
+
+    PathTable::Id PathTable::Intern(const fs::path &path) {
+        std::string string = path.string();
+
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        auto                        it = g_Ids.find(string);
+        if (it != g_Ids.end()) return it->second;
+
+        const std::uint32_t index = g_Count.load(std::memory_order_relaxed);
+        VRE_ASSERT(index < CHUNK_SIZE * MAX_CHUNKS, "vre::PathTable is full");
+        if (index % CHUNK_SIZE == 0u) g_Chunks[index / CHUNK_SIZE] = std::make_unique<Entry[]>(CHUNK_SIZE);
+
+        const std::uint32_t size = std::uint32_t(string.size());
+
+        Entry &entry          = g_Chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+        entry.DirectoryLength = std::uint32_t(path.parent_path().string().size());
+        entry.NameOffset      = size - std::uint32_t(path.filename().string().size());
+        entry.ExtensionOffset = size - std::uint32_t(path.extension().string().size());
+        entry.Hash            = Hash::String(string);
+        entry.Path            = std::move(string);
+
+        // Entries never move, so the map can key on views into them and readers need no lock.
+        const Id id = index + 1u;
+        g_Ids.emplace(entry.Path, id);
+        g_Count.store(index + 1u, std::memory_order_release);
+        return id;
+    }
+
+    PathTable::Id PathTable::Find(std::string_view path) {
+        std::lock_guard<std::mutex> lock{g_Mutex};
+        auto                        it = g_Ids.find(path);
+        return it != g_Ids.end() ? it->second : INVALID_ID;
+    }
+
+    const PathTable::Entry &PathTable::Get(Id id) {
+        DVRE_ASSERT(id != INVALID_ID && id <= g_Count.load(std::memory_order_acquire), "Invalid vre::PathTable id: {}", id);
+        const std::uint32_t index = id - 1u;
+        return g_Chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+    }
+
+    std::size_t PathTable::GetCount() {
+        return g_Count.load(std::memory_order_acquire);
+    }
+
+    InternedPath::InternedPath(const fs::path &path)
+        : m_Id{PathTable::Intern(path)} {}
+
+    bool InternedPath::isValid() const { return m_Id != PathTable::INVALID_ID; }
+
+    PathTable::Id InternedPath::getId() const { return m_Id; }
+
+    std::uint64_t InternedPath::getHash() const {
+        return isValid() ? PathTable::Get(m_Id).Hash : 0u;
+    }
+
+    std::string_view InternedPath::getPath() const {
+        if (!isValid()) return {};
+        return PathTable::Get(m_Id).Path;
+    }
+
+    std::string_view InternedPath::getDirectory() const {
+        if (!isValid()) return {};
+        const PathTable::Entry &entry = PathTable::Get(m_Id);
+        return std::string_view{entry.Path}.substr(0u, entry.DirectoryLength);
+    }
+
+    std::string_view InternedPath::getName() const {
+        if (!isValid()) return {};
+        const PathTable::Entry &entry = PathTable::Get(m_Id);
+        return std::string_view{entry.Path}.substr(entry.NameOffset);
+    }
+
+    std::string_view InternedPath::getExtension() const {
+        if (!isValid()) return {};
+        const PathTable::Entry &entry = PathTable::Get(m_Id);
+        return std::string_view{entry.Path}.substr(entry.ExtensionOffset);
+    }
+}  // namespace vre
\ No newline at end of file
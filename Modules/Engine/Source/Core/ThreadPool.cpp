@@ -0,0 +1,162 @@
+#include <VREngine/Core/ThreadPool.hpp>
+
+namespace vre {
+    std::vector<std::thread>          ThreadPool::g_Workers{};
+    std::deque<std::function<void()>> ThreadPool::g_Tasks{};
+    std::mutex                        ThreadPool::g_Mutex{};
+    std::condition_variable           ThreadPool::g_Condition{};
+    bool                              ThreadPool::g_IsStopping{false};
+    bool                              ThreadPool::g_IsInitialized{false};
+    thread_local bool                 ThreadPool::g_IsWorkerThread{false};
+    ThreadPool                        ThreadPool::g_State{};
+
+    void ThreadPool::Initialize(const Settings &settings) {
+        DVRE_ASSERT(!g_IsInitialized, "vre::ThreadPool must be shut down before initializing");
+
+        std::uint32_t threadCount = settings.ThreadCount;
+        if (threadCount == 0u) {
+            const std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            threadCount                         = hardwareThreads > 1u ? hardwareThreads - 1u : 1u;
+        }
+
+        DLOG_INFO("Initializing vre::ThreadPool with {} worker threads", threadCount);
+
+        g_IsStopping = false;
+        g_Workers.reserve(threadCount);
+        for (std::uint32_t i = 0u; i < threadCount; i++)
+            g_Workers.emplace_back(WorkerLoop);
+
+        g_IsInitialized = true;
+    }
+
+    void ThreadPool::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void ThreadPool::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::ThreadPool must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::ThreadPool down");
+
+        {
+            std::lock_guard<std::mutex> lock{g_Mutex};
+            g_IsStopping = true;
+        }
+        g_Condition.notify_all();
+
+        for (std::thread &worker : g_Workers)
+            worker.join();
+
+        g_Workers.clear();
+        g_Tasks.clear();
+        g_IsInitialized = false;
+    }
+
+    bool ThreadPool::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    std::uint32_t ThreadPool::GetThreadCount() {
+        DVRE_ASSERT(g_IsInitialized, "vre::ThreadPool must be initialized");
+        return std::uint32_t(g_Workers.size());
+    }
+
+    bool ThreadPool::IsWorkerThread() {
+        return g_IsWorkerThread;
+    }
+
+    void ThreadPool::ParallelFor(
+        std::size_t                                                   count,
+        std::size_t                                                   grainSize,
+        const std::function<void(std::size_t begin, std::size_t end)> &function) {
+        DVRE_ASSERT(g_IsInitialized, "vre::ThreadPool must be initialized");
+        if (count == 0u) return;
+
+        grainSize                    = std::max<std::size_t>(grainSize, 1u);
+        const std::size_t chunkCount = (count + grainSize - 1u) / grainSize;
+
+        if (chunkCount == 1u || g_Workers.empty()) {
+            function(0u, count);
+            return;
+        }
+
+        struct Job {
+            std::atomic<std::size_t> NextChunk{0u};
+            std::atomic<std::size_t> DoneChunks{0u};
+            std::size_t              Count;
+            std::size_t              GrainSize;
+            std::size_t              ChunkCount;
+            std::mutex               Mutex;
+            std::condition_variable  Condition;
+
+            const std::function<void(std::size_t, std::size_t)> *Function;
+        };
+
+        std::shared_ptr<Job> job = std::make_shared<Job>();
+        job->Count               = count;
+        job->GrainSize           = grainSize;
+        job->ChunkCount          = chunkCount;
+        job->Function            = &function;
+
+        // The caller drains chunks too, so nested calls from worker threads cannot deadlock.
+        auto run = [job] {
+            std::size_t chunk = job->NextChunk.fetch_add(1u);
+            while (chunk < job->ChunkCount) {
+                const std::size_t begin = chunk * job->GrainSize;
+                const std::size_t end   = std::min(begin + job->GrainSize, job->Count);
+                (*job->Function)(begin, end);
+
+                if (job->DoneChunks.fetch_add(1u) + 1u == job->ChunkCount) {
+                    std::lock_guard<std::mutex> lock{job->Mutex};
+                    job->Condition.notify_all();
+                }
+                chunk = job->NextChunk.fetch_add(1u);
+            }
+        };
+
+        const std::size_t helperCount = std::min(chunkCount - 1u, g_Workers.size());
+        for (std::size_t i = 0u; i < helperCount; i++)
+            Enqueue(run);
+
+        run();
+
+        std::unique_lock<std::mutex> lock{job->Mutex};
+        job->Condition.wait(lock, [&job] { return job->DoneChunks.load() == job->ChunkCount; });
+    }
+
+    void ThreadPool::ParallelFor(
+        std::size_t                                    count,
+        const std::function<void(std::size_t index)> &function) {
+        ParallelFor(count, 1u, [&function](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                function(i);
+        });
+    }
+
+    void ThreadPool::Enqueue(std::function<void()> &&task) {
+        {
+            std::lock_guard<std::mutex> lock{g_Mutex};
+            g_Tasks.emplace_back(std::move(task));
+        }
+        g_Condition.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop() {
+        g_IsWorkerThread = true;
+        while (true) {
+            std::function<void()> task{};
+            {
+                std::unique_lock<std::mutex> lock{g_Mutex};
+                g_Condition.wait(lock, [] { return g_IsStopping || !g_Tasks.empty(); });
+                if (g_IsStopping && g_Tasks.empty()) return;
+
+                task = std::move(g_Tasks.front());
+                g_Tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        VRE_ASSERT(!g_IsInitialized, "vre::ThreadPool must be shut down before closing!");
+    }
+}  // namespace vre
\ No newline at end of file
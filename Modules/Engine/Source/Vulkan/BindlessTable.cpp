@@ -0,0 +1,242 @@
+#include <VREngine/Vulkan/BindlessTable.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+
+namespace vre::Vulkan {
+    BindlessTable::Settings BindlessTable::g_Settings{};
+    vk::DescriptorSetLayout BindlessTable::g_Layout{};
+    vk::DescriptorPool      BindlessTable::g_Pool{};
+    vk::DescriptorSet       BindlessTable::g_Set{};
+    BindlessTable::Table    BindlessTable::g_SampledImages{};
+    BindlessTable::Table    BindlessTable::g_Samplers{};
+    BindlessTable::Table    BindlessTable::g_StorageBuffers{};
+    std::uint64_t           BindlessTable::g_Frame{0u};
+    bool                    BindlessTable::g_IsInitialized{false};
+    BindlessTable           BindlessTable::g_State{};
+
+    void BindlessTable::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::BindlessTable must be shut down before initializing");
+
+        const vk::PhysicalDeviceVulkan12Properties limits =
+            Context::GetPhysicalDevice()
+                .getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceVulkan12Properties>()
+                .get<vk::PhysicalDeviceVulkan12Properties>();
+
+        g_Settings                   = settings;
+        g_Settings.MaxSampledImages  = std::min({settings.MaxSampledImages, limits.maxDescriptorSetUpdateAfterBindSampledImages, limits.maxPerStageDescriptorUpdateAfterBindSampledImages});
+        g_Settings.MaxSamplers       = std::min({settings.MaxSamplers, limits.maxDescriptorSetUpdateAfterBindSamplers, limits.maxPerStageDescriptorUpdateAfterBindSamplers});
+        g_Settings.MaxStorageBuffers = std::min({settings.MaxStorageBuffers, limits.maxDescriptorSetUpdateAfterBindStorageBuffers, limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers});
+        DVRE_ASSERT(g_Settings.MaxSampledImages != 0u && g_Settings.MaxSamplers != 0u && g_Settings.MaxStorageBuffers != 0u, "vre::Vulkan::BindlessTable needs room in every table");
+        DLOG_INFO(
+            "Initializing vre::Vulkan::BindlessTable with {} sampled images, {} samplers and {} storage buffers",
+            g_Settings.MaxSampledImages,
+            g_Settings.MaxSamplers,
+            g_Settings.MaxStorageBuffers);
+
+        const vk::Device &device = Context::GetDevice();
+
+        const std::array<vk::DescriptorSetLayoutBinding, 3> bindings{
+            vk::DescriptorSetLayoutBinding{SAMPLED_IMAGE_BINDING, vk::DescriptorType::eSampledImage, g_Settings.MaxSampledImages, g_Settings.StageFlags},
+            vk::DescriptorSetLayoutBinding{SAMPLER_BINDING, vk::DescriptorType::eSampler, g_Settings.MaxSamplers, g_Settings.StageFlags},
+            vk::DescriptorSetLayoutBinding{STORAGE_BUFFER_BINDING, vk::DescriptorType::eStorageBuffer, g_Settings.MaxStorageBuffers, g_Settings.StageFlags},
+        };
+        const vk::DescriptorBindingFlags bindingFlags =
+            vk::DescriptorBindingFlagBits::ePartiallyBound |
+            vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+            vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+        const std::array<vk::DescriptorBindingFlags, 3> allBindingFlags{bindingFlags, bindingFlags, bindingFlags};
+
+        const vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{allBindingFlags};
+
+        auto [layoutResult, layout] = device.createDescriptorSetLayout(vk::DescriptorSetLayoutCreateInfo{
+            vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool,
+            bindings,
+            &bindingFlagsInfo,
+        });
+        DVRE_VK_CHECK(layoutResult);
+        g_Layout = layout;
+
+        g_Pool = DescriptorPool::Create(
+            vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind,
+            1u,
+            {
+                vk::DescriptorPoolSize{vk::DescriptorType::eSampledImage, g_Settings.MaxSampledImages},
+                vk::DescriptorPoolSize{vk::DescriptorType::eSampler, g_Settings.MaxSamplers},
+                vk::DescriptorPoolSize{vk::DescriptorType::eStorageBuffer, g_Settings.MaxStorageBuffers},
+            },
+            device);
+        g_Set = DescriptorSet::Allocate(g_Pool, g_Layout, device);
+
+        g_SampledImages  = Table{.Capacity = g_Settings.MaxSampledImages, .Live = std::vector<bool>(g_Settings.MaxSampledImages, false)};
+        g_Samplers       = Table{.Capacity = g_Settings.MaxSamplers, .Live = std::vector<bool>(g_Settings.MaxSamplers, false)};
+        g_StorageBuffers = Table{.Capacity = g_Settings.MaxStorageBuffers, .Live = std::vector<bool>(g_Settings.MaxStorageBuffers, false)};
+        g_Frame          = 0u;
+        g_IsInitialized  = true;
+    }
+
+    void BindlessTable::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void BindlessTable::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::BindlessTable down");
+
+        const vk::Device &device = Context::GetDevice();
+        device.destroy(g_Pool);
+        device.destroy(g_Layout);
+
+        g_Pool           = vk::DescriptorPool{};
+        g_Layout         = vk::DescriptorSetLayout{};
+        g_Set            = vk::DescriptorSet{};
+        g_SampledImages  = Table{};
+        g_Samplers       = Table{};
+        g_StorageBuffers = Table{};
+        g_IsInitialized  = false;
+    }
+
+    bool BindlessTable::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    BindlessTable::Slot BindlessTable::AddSampledImage(const vk::ImageView &view, vk::ImageLayout layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+
+        const Slot slot = Acquire(g_SampledImages, "sampled image");
+        if (slot != INVALID_SLOT) SetSampledImage(slot, view, layout);
+        return slot;
+    }
+
+    BindlessTable::Slot BindlessTable::AddSampler(const vk::Sampler &sampler) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+
+        const Slot slot = Acquire(g_Samplers, "sampler");
+        if (slot == INVALID_SLOT) return slot;
+
+        const vk::DescriptorImageInfo imageInfo{sampler, {}, {}};
+        Context::GetDevice().updateDescriptorSets(
+            {vk::WriteDescriptorSet{g_Set, SAMPLER_BINDING, slot, vk::DescriptorType::eSampler, {imageInfo}, {}, {}}},
+            {});
+        return slot;
+    }
+
+    BindlessTable::Slot BindlessTable::AddStorageBuffer(const Buffer::Allocation &buffer) {
+        return AddStorageBuffer(buffer.Buffer, 0u, buffer.Size);
+    }
+
+    BindlessTable::Slot BindlessTable::AddStorageBuffer(const vk::Buffer &buffer, std::uint64_t offset, std::uint64_t size) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+
+        const Slot slot = Acquire(g_StorageBuffers, "storage buffer");
+        if (slot == INVALID_SLOT) return slot;
+
+        const vk::DescriptorBufferInfo bufferInfo{buffer, offset, size};
+        Context::GetDevice().updateDescriptorSets(
+            {vk::WriteDescriptorSet{g_Set, STORAGE_BUFFER_BINDING, slot, vk::DescriptorType::eStorageBuffer, {}, {bufferInfo}, {}}},
+            {});
+        return slot;
+    }
+
+    void BindlessTable::SetSampledImage(Slot slot, const vk::ImageView &view, vk::ImageLayout layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        DVRE_ASSERT(slot < g_SampledImages.Next && g_SampledImages.Live[slot], "vre::Vulkan::BindlessTable has no sampled image in slot {}", slot);
+
+        const vk::DescriptorImageInfo imageInfo{{}, view, layout};
+        Context::GetDevice().updateDescriptorSets(
+            {vk::WriteDescriptorSet{g_Set, SAMPLED_IMAGE_BINDING, slot, vk::DescriptorType::eSampledImage, {imageInfo}, {}, {}}},
+            {});
+    }
+
+    void BindlessTable::RemoveSampledImage(Slot slot) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        Retire(g_SampledImages, slot);
+    }
+
+    void BindlessTable::RemoveSampler(Slot slot) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        Retire(g_Samplers, slot);
+    }
+
+    void BindlessTable::RemoveStorageBuffer(Slot slot) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        Retire(g_StorageBuffers, slot);
+    }
+
+    void BindlessTable::Update() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+
+        g_Frame++;
+        Recycle(g_SampledImages);
+        Recycle(g_Samplers);
+        Recycle(g_StorageBuffers);
+    }
+
+    void BindlessTable::Bind(const vk::CommandBuffer &commandBuffer, vk::PipelineBindPoint bindPoint, const vk::PipelineLayout &layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        commandBuffer.bindDescriptorSets(bindPoint, layout, SET_INDEX, {g_Set}, {});
+    }
+
+    vk::DescriptorSetLayout BindlessTable::GetLayout() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        return g_Layout;
+    }
+
+    vk::DescriptorSet BindlessTable::GetSet() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        return g_Set;
+    }
+
+    std::uint32_t BindlessTable::GetSampledImageCount() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        return g_SampledImages.Count;
+    }
+
+    std::uint32_t BindlessTable::GetSamplerCount() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        return g_Samplers.Count;
+    }
+
+    std::uint32_t BindlessTable::GetStorageBufferCount() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::BindlessTable must be initialized");
+        return g_StorageBuffers.Count;
+    }
+
+    BindlessTable::Slot BindlessTable::Acquire(Table &table, const char *name) {
+        Slot slot = INVALID_SLOT;
+        if (!table.Free.empty()) {
+            slot = table.Free.back();
+            table.Free.pop_back();
+        } else if (table.Next < table.Capacity) {
+            slot = table.Next++;
+        } else {
+            DVRE_WARN("vre::Vulkan::BindlessTable ran out of its {} {} slots", table.Capacity, name);
+            return INVALID_SLOT;
+        }
+
+        table.Live[slot] = true;
+        table.Count++;
+        return slot;
+    }
+
+    void BindlessTable::Retire(Table &table, Slot slot) {
+        if (slot == INVALID_SLOT) return;
+        DVRE_ASSERT(slot < table.Next, "vre::Vulkan::BindlessTable has no slot {}", slot);
+        DVRE_ASSERT(table.Live[slot], "vre::Vulkan::BindlessTable slot {} was already removed", slot);
+
+        table.Live[slot] = false;
+        table.Count--;
+        table.Pending.push_back(Retired{slot, g_Frame + g_Settings.FramesInFlight});
+    }
+
+    void BindlessTable::Recycle(Table &table) {
+        while (!table.Pending.empty() && table.Pending.front().Frame <= g_Frame) {
+            table.Free.push_back(table.Pending.front().Index);
+            table.Pending.pop_front();
+        }
+    }
+
+    BindlessTable::~BindlessTable() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::BindlessTable must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
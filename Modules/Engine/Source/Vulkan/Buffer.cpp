@@ -1,6 +1,17 @@
 #include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
 
 namespace vre::Vulkan::Buffer {
+    namespace {
+        vk::DeviceAddress QueryAddress(VkBuffer buffer, vk::BufferUsageFlags usageFlags, const VmaAllocator &allocator) {
+            if (!(usageFlags & vk::BufferUsageFlagBits::eShaderDeviceAddress)) return 0u;
+
+            VmaAllocatorInfo allocatorInfo{};
+            vmaGetAllocatorInfo(allocator, &allocatorInfo);
+            return vk::Device(allocatorInfo.device).getBufferAddress(vk::BufferDeviceAddressInfo{buffer});
+        }
+    }  // namespace
+
     vk::BufferCreateInfo GetCreateInfo(std::uint64_t size, vk::BufferUsageFlags usageFlags) {
         return vk::BufferCreateInfo{
             {},
@@ -42,6 +53,7 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
         };
     }
 
@@ -76,6 +88,7 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
         };
     }
 
@@ -111,6 +124,7 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
         };
     }
 
@@ -141,6 +155,7 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
         };
     }
 
@@ -176,6 +191,7 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
         };
     }
 
@@ -210,10 +226,48 @@ namespace vre::Vulkan::Buffer {
             .Size       = size,
             .Allocation = allocation,
             .Allocator  = allocator,
+            .Address    = QueryAddress(cBuffer, usageFlags, allocator),
+        };
+    }
+
+    vk::BufferMemoryBarrier2 GetOwnershipBarrier(
+        const Allocation &buffer,
+        std::uint64_t     offset,
+        std::uint64_t     size,
+        std::uint32_t     sourceQueueFamilyIndex,
+        std::uint32_t     destinationQueueFamilyIndex) {
+        return vk::BufferMemoryBarrier2{
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite,
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite | vk::AccessFlagBits2::eMemoryRead,
+            sourceQueueFamilyIndex,
+            destinationQueueFamilyIndex,
+            buffer.Buffer,
+            offset,
+            size,
         };
     }
 
+    void TransferOwnership(
+        const vk::CommandBuffer &commandBuffer,
+        const Allocation        &buffer,
+        std::uint64_t            offset,
+        std::uint64_t            size,
+        std::uint32_t            sourceQueueFamilyIndex,
+        std::uint32_t            destinationQueueFamilyIndex) {
+        vk::BufferMemoryBarrier2 bufferBarrier = GetOwnershipBarrier(buffer, offset, size, sourceQueueFamilyIndex, destinationQueueFamilyIndex);
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, {bufferBarrier}, {}}});
+    }
+
+    vk::DeviceAddress GetAddress(const Allocation &buffer, std::uint64_t offset) {
+        DVRE_ASSERT(buffer.Address != 0u, "Buffer was not created with vk::BufferUsageFlagBits::eShaderDeviceAddress");
+        DVRE_ASSERT(offset < buffer.Size, "Offset {} is outside of the {} byte buffer", offset, buffer.Size);
+        return buffer.Address + offset;
+    }
+
     void Release(const Allocation &buffer) {
+        DescriptorSet::Cache::InvalidateAll(buffer.Buffer);
         vmaDestroyBuffer(buffer.Allocator, buffer.Buffer, buffer.Allocation);
     }
 }  // namespace vre::Vulkan::Buffer
\ No newline at end of file
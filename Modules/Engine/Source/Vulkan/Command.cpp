@@ -1,4 +1,5 @@
 #include <VREngine/Vulkan/Command.hpp>
+#include <VREngine/Vulkan/Context.hpp>
 
 namespace vre::Vulkan {
     namespace CommandPool {
@@ -494,6 +495,56 @@ namespace vre::Vulkan {
                 }});
         }
 
+        void CopyBufferToImage(
+            const vk::CommandBuffer  &buffer,
+            const Buffer::Allocation &source,
+            const Image::Allocation  &destination,
+            std::uint64_t             sourceOffset,
+            std::uint32_t             mipLevel) {
+            CopyBufferToImage(buffer, source, destination, sourceOffset, mipLevel, 1u);
+        }
+
+        void CopyBufferToImage(
+            const vk::CommandBuffer  &buffer,
+            const Buffer::Allocation &source,
+            const Image::Allocation  &destination,
+            std::uint64_t             sourceOffset,
+            std::uint32_t             firstMipLevel,
+            std::uint32_t             mipLevelCount) {
+            DVRE_ASSERT(firstMipLevel + mipLevelCount <= destination.MipLevels, "Mip levels {}..{} are out of range of a vk::Image with {} mip levels", firstMipLevel, firstMipLevel + mipLevelCount, destination.MipLevels);
+
+            std::vector<vk::BufferImageCopy> regions{};
+            regions.reserve(mipLevelCount);
+
+            for (std::uint32_t mip = firstMipLevel; mip < firstMipLevel + mipLevelCount; mip++) {
+                const vk::Extent3D extent{
+                    std::max(destination.Extent.width >> mip, 1u),
+                    std::max(destination.Extent.height >> mip, 1u),
+                    std::max(destination.Extent.depth >> mip, 1u),
+                };
+                regions.push_back(vk::BufferImageCopy{
+                    sourceOffset,
+                    0u,
+                    0u,
+                    vk::ImageSubresourceLayers{
+                        vk::ImageAspectFlagBits::eColor,
+                        mip,
+                        0u,
+                        1u,
+                    },
+                    vk::Offset3D{0, 0, 0},
+                    extent,
+                });
+                sourceOffset += std::uint64_t(extent.width) * extent.height * extent.depth * vk::blockSize(destination.Format);
+            }
+
+            buffer.copyBufferToImage(
+                source.Buffer,
+                destination.Image,
+                vk::ImageLayout::eTransferDstOptimal,
+                regions);
+        }
+
         void CopyBufferToImage(
             const vk::CommandBuffer  &buffer,
             const Buffer::Allocation &source,
@@ -658,5 +709,19 @@ namespace vre::Vulkan {
                     size,
                 }});
         }
+
+        void DrawMeshTasks(
+            const vk::CommandBuffer &buffer,
+            std::uint32_t            groupCountX,
+            std::uint32_t            groupCountY,
+            std::uint32_t            groupCountZ) {
+            PFN_vkCmdDrawMeshTasksEXT drawMeshTasks = Context::GetCmdDrawMeshTasksFunction();
+            DVRE_ASSERT(drawMeshTasks != nullptr, "VK_EXT_mesh_shader is not supported by the selected GPU");
+            drawMeshTasks(buffer, groupCountX, groupCountY, groupCountZ);
+        }
+
+        void DrawMeshTasks(const vk::CommandBuffer &buffer, std::uint32_t groupCount) {
+            DrawMeshTasks(buffer, groupCount, 1u, 1u);
+        }
     }  // namespace CommandBuffer
 }  // namespace vre::Vulkan
\ No newline at end of file
@@ -23,8 +23,12 @@ namespace vre::Vulkan {
     vk::Device                 Context::g_Device{VK_NULL_HANDLE};
     std::uint32_t              Context::g_QueueFamilyIndex{0u};
     std::uint32_t              Context::g_QueueFamilyQueueCount{0u};
+    std::uint32_t              Context::g_ComputeQueueFamilyIndex{0u};
+    std::uint32_t              Context::g_TransferQueueFamilyIndex{0u};
+    std::uint32_t              Context::g_TransferQueueIndex{0u};
     vk::Queue                  Context::g_GraphicsQueue{VK_NULL_HANDLE};
     vk::Queue                  Context::g_ComputeQueue{VK_NULL_HANDLE};
+    vk::Queue                  Context::g_TransferQueue{VK_NULL_HANDLE};
     vk::Queue                  Context::g_PresentQueue{VK_NULL_HANDLE};
     vk::SwapchainKHR           Context::g_Swapchain{VK_NULL_HANDLE};
     vk::SurfaceFormatKHR       Context::g_SwapchainFormat{};
@@ -35,9 +39,17 @@ namespace vre::Vulkan {
     std::vector<vk::Image>     Context::g_SwapchainImages{};
     std::vector<vk::ImageView> Context::g_SwapchainImageViews{};
     VmaAllocator               Context::g_VmaAllocator{VK_NULL_HANDLE};
+    bool                       Context::g_IsMeshShaderSupported{false};
+    PFN_vkCmdDrawMeshTasksEXT  Context::g_CmdDrawMeshTasks{nullptr};
+    bool                       Context::g_IsMemoryBudgetSupported{false};
+    bool                       Context::g_IsPushDescriptorSupported{false};
+    bool                       Context::g_IsDescriptorBufferSupported{false};
     bool                       Context::g_IsInitialized{false};
     Context                    Context::g_State{};
 
+    PFN_vkCmdPushDescriptorSetKHR             Context::g_CmdPushDescriptorSet{nullptr};
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR Context::g_CmdPushDescriptorSetWithTemplate{nullptr};
+
     void Context::Initialize(const Settings &settings) {
         DVRE_ASSERT(Window::IsInitialized(), "vre::Window must be initialized");
         DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::Context must be shut down before initializing");
@@ -99,6 +111,20 @@ namespace vre::Vulkan {
 
         SelectPhysicalDevice(deviceExtensions, settings);
         SelectQueueFamilyIndex();
+        SelectDedicatedQueueFamilyIndices();
+
+        g_IsMeshShaderSupported =
+            CheckPhysicalDeviceExtensionSupport(g_PhysicalDevice, {VK_EXT_MESH_SHADER_EXTENSION_NAME}) &&
+            CheckPhysicalDeviceMeshShaderSupport(g_PhysicalDevice);
+        if (g_IsMeshShaderSupported) deviceExtensions.push_back(VK_EXT_MESH_SHADER_EXTENSION_NAME);
+        g_IsMemoryBudgetSupported = CheckPhysicalDeviceExtensionSupport(g_PhysicalDevice, {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME});
+        if (g_IsMemoryBudgetSupported) deviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        g_IsPushDescriptorSupported = CheckPhysicalDeviceExtensionSupport(g_PhysicalDevice, {VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME});
+        if (g_IsPushDescriptorSupported) deviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        g_IsDescriptorBufferSupported =
+            CheckPhysicalDeviceExtensionSupport(g_PhysicalDevice, {VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME}) &&
+            CheckPhysicalDeviceDescriptorBufferSupport(g_PhysicalDevice);
+        if (g_IsDescriptorBufferSupported) deviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
         SelectSwapchainImageCount(settings);
         SelectSwapchainFormat(settings);
         SelectSwapchainPresentMode(settings);
@@ -108,6 +134,8 @@ namespace vre::Vulkan {
             vk::ImageUsageFlagBits::eTransferSrc |
             settings.SurfaceUsageFlags;
 
+        vk::PhysicalDeviceDescriptorBufferFeaturesEXT      descriptorBufferFeatures{};
+        vk::PhysicalDeviceMeshShaderFeaturesEXT            meshShaderFeatures{};
         vk::PhysicalDeviceExtendedDynamicState2FeaturesEXT dynamicFeatures2{};
         vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT  dynamicFeatures{};
 
@@ -115,7 +143,15 @@ namespace vre::Vulkan {
         vk::PhysicalDeviceVulkan12Features features12{};
         vk::PhysicalDeviceFeatures2        features{};
 
-        dynamicFeatures2.setExtendedDynamicState2(vk::True);
+        descriptorBufferFeatures
+            .setDescriptorBuffer(vk::True);
+        meshShaderFeatures
+            .setTaskShader(vk::True)
+            .setMeshShader(vk::True)
+            .setPNext(g_IsDescriptorBufferSupported ? &descriptorBufferFeatures : nullptr);
+        dynamicFeatures2
+            .setExtendedDynamicState2(vk::True)
+            .setPNext(g_IsMeshShaderSupported ? &meshShaderFeatures : meshShaderFeatures.pNext);
         dynamicFeatures
             .setExtendedDynamicState(vk::True)
             .setPNext(&dynamicFeatures2);
@@ -126,24 +162,54 @@ namespace vre::Vulkan {
         features12
             .setBufferDeviceAddress(vk::True)
             .setDescriptorIndexing(vk::True)
+            .setRuntimeDescriptorArray(vk::True)
+            .setDescriptorBindingPartiallyBound(vk::True)
+            .setDescriptorBindingSampledImageUpdateAfterBind(vk::True)
+            .setDescriptorBindingStorageBufferUpdateAfterBind(vk::True)
+            .setDescriptorBindingUpdateUnusedWhilePending(vk::True)
+            .setShaderSampledImageArrayNonUniformIndexing(vk::True)
+            .setShaderStorageBufferArrayNonUniformIndexing(vk::True)
+            .setTimelineSemaphore(vk::True)
             .setPNext(&features13);
+        features.features
+            .setMultiDrawIndirect(vk::True);
         features.setPNext(&features12);
 
         std::vector<float> queuePriorities{};
         queuePriorities.reserve(5U);
 
-        for (std::uint32_t i = 0; i < g_QueueFamilyQueueCount; i++) {
+        for (std::uint32_t i = 0; i < std::max(g_QueueFamilyQueueCount, g_TransferQueueIndex + 1u); i++) {
             queuePriorities.emplace_back(1.0f - float(i) / 10.0f);
         }
 
-        vk::DeviceQueueCreateInfo queueInfo{
-            {},
-            g_QueueFamilyIndex,
-            queuePriorities,
+        std::vector<vk::DeviceQueueCreateInfo> queueInfos{
+            vk::DeviceQueueCreateInfo{
+                {},
+                g_QueueFamilyIndex,
+                g_QueueFamilyQueueCount,
+                queuePriorities.data(),
+            },
         };
+        if (IsComputeQueueDedicated()) {
+            queueInfos.push_back(vk::DeviceQueueCreateInfo{
+                {},
+                g_ComputeQueueFamilyIndex,
+                g_TransferQueueFamilyIndex == g_ComputeQueueFamilyIndex ? g_TransferQueueIndex + 1u : 1u,
+                queuePriorities.data(),
+            });
+        }
+        if (IsTransferQueueDedicated() && g_TransferQueueFamilyIndex != g_ComputeQueueFamilyIndex) {
+            queueInfos.push_back(vk::DeviceQueueCreateInfo{
+                {},
+                g_TransferQueueFamilyIndex,
+                g_TransferQueueIndex + 1u,
+                queuePriorities.data(),
+            });
+        }
+
         vk::DeviceCreateInfo deviceInfo{
             {},
-            {queueInfo},
+            queueInfos,
 #if defined(VRE_BUILD_TYPE_DEBUG)
             instanceLayers,
 #else
@@ -168,10 +234,23 @@ namespace vre::Vulkan {
         if (queueIndex + 1 < g_QueueFamilyQueueCount) queueIndex++;
         g_ComputeQueue = g_Device.getQueue(g_QueueFamilyIndex, queueIndex);
 
+        if (IsComputeQueueDedicated()) g_ComputeQueue = g_Device.getQueue(g_ComputeQueueFamilyIndex, 0u);
+        g_TransferQueue = IsTransferQueueDedicated() ? g_Device.getQueue(g_TransferQueueFamilyIndex, g_TransferQueueIndex) : g_GraphicsQueue;
+
+        if (g_IsMeshShaderSupported)
+            g_CmdDrawMeshTasks = (PFN_vkCmdDrawMeshTasksEXT)vkGetDeviceProcAddr(g_Device, "vkCmdDrawMeshTasksEXT");
+        if (g_IsPushDescriptorSupported) {
+            g_CmdPushDescriptorSet             = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(g_Device, "vkCmdPushDescriptorSetKHR");
+            g_CmdPushDescriptorSetWithTemplate = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)vkGetDeviceProcAddr(g_Device, "vkCmdPushDescriptorSetWithTemplateKHR");
+        }
+
         CreateSwapchain();
 
+        VmaAllocatorCreateFlags vmaFlags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+        if (g_IsMemoryBudgetSupported) vmaFlags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+
         VmaAllocatorCreateInfo vmaInfo{
-            .flags            = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT,
+            .flags            = vmaFlags,
             .physicalDevice   = g_PhysicalDevice,
             .device           = g_Device,
             .instance         = g_Instance,
@@ -191,6 +270,14 @@ namespace vre::Vulkan {
         ReleaseSwapchain();
         g_Device.destroy();
         g_Instance.destroy(g_Surface);
+        g_IsMeshShaderSupported   = false;
+        g_CmdDrawMeshTasks        = nullptr;
+        g_IsMemoryBudgetSupported = false;
+
+        g_IsPushDescriptorSupported        = false;
+        g_CmdPushDescriptorSet             = nullptr;
+        g_CmdPushDescriptorSetWithTemplate = nullptr;
+        g_IsDescriptorBufferSupported      = false;
 #if defined(VRE_BUILD_TYPE_DEBUG)
         DVRE_VK_CHECK(DestroyDebugUtilsMessengerEXT(g_Instance, g_DebugMessenger));
 #endif
@@ -241,6 +328,16 @@ namespace vre::Vulkan {
         return g_QueueFamilyIndex;
     }
 
+    std::uint32_t Context::GetComputeQueueFamilyIndex() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_ComputeQueueFamilyIndex;
+    }
+
+    std::uint32_t Context::GetTransferQueueFamilyIndex() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_TransferQueueFamilyIndex;
+    }
+
     vk::Queue Context::GetGraphicsQueue() {
         DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
         return g_GraphicsQueue;
@@ -251,6 +348,11 @@ namespace vre::Vulkan {
         return g_ComputeQueue;
     }
 
+    vk::Queue Context::GetTransferQueue() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_TransferQueue;
+    }
+
     vk::Queue Context::GetPresentQueue() {
         DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
         return g_PresentQueue;
@@ -296,6 +398,49 @@ namespace vre::Vulkan {
         return g_VmaAllocator;
     }
 
+    bool Context::IsMeshShaderSupported() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_IsMeshShaderSupported;
+    }
+
+    PFN_vkCmdDrawMeshTasksEXT Context::GetCmdDrawMeshTasksFunction() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_CmdDrawMeshTasks;
+    }
+
+    bool Context::IsMemoryBudgetSupported() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_IsMemoryBudgetSupported;
+    }
+
+    bool Context::IsPushDescriptorSupported() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_IsPushDescriptorSupported;
+    }
+
+    PFN_vkCmdPushDescriptorSetKHR Context::GetCmdPushDescriptorSetFunction() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_CmdPushDescriptorSet;
+    }
+
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR Context::GetCmdPushDescriptorSetWithTemplateFunction() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_CmdPushDescriptorSetWithTemplate;
+    }
+
+    bool Context::IsDescriptorBufferSupported() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Context must be initialized");
+        return g_IsDescriptorBufferSupported;
+    }
+
+    bool Context::IsComputeQueueDedicated() {
+        return g_ComputeQueueFamilyIndex != g_QueueFamilyIndex;
+    }
+
+    bool Context::IsTransferQueueDedicated() {
+        return g_TransferQueueFamilyIndex != g_QueueFamilyIndex;
+    }
+
     void Context::SelectPhysicalDevice(const std::vector<const char *> &requiredExtensions, const Settings &settings) {
         auto [result, physicalDevices] = g_Instance.enumeratePhysicalDevices();
         DVRE_VK_CHECK(result);
@@ -354,6 +499,32 @@ namespace vre::Vulkan {
         g_QueueFamilyQueueCount = queueFamilies[0].queueCount;
     }
 
+    void Context::SelectDedicatedQueueFamilyIndices() {
+        std::vector<vk::QueueFamilyProperties> queueFamilies = g_PhysicalDevice.getQueueFamilyProperties();
+
+        g_ComputeQueueFamilyIndex  = g_QueueFamilyIndex;
+        g_TransferQueueFamilyIndex = g_QueueFamilyIndex;
+        g_TransferQueueIndex       = 0u;
+
+        for (std::uint32_t index = 0u; index < std::uint32_t(queueFamilies.size()); index++) {
+            const vk::QueueFlags flags = queueFamilies[index].queueFlags;
+            if (index == g_QueueFamilyIndex || queueFamilies[index].queueCount == 0u || (flags & vk::QueueFlagBits::eGraphics)) continue;
+
+            if ((flags & vk::QueueFlagBits::eCompute) && !IsComputeQueueDedicated())
+                g_ComputeQueueFamilyIndex = index;
+            else if ((flags & vk::QueueFlagBits::eTransfer) && !(flags & vk::QueueFlagBits::eCompute) && !IsTransferQueueDedicated())
+                g_TransferQueueFamilyIndex = index;
+        }
+
+        // Without a transfer-only family uploads share the async compute family, on a second queue when it has one.
+        if (!IsTransferQueueDedicated() && IsComputeQueueDedicated()) {
+            g_TransferQueueFamilyIndex = g_ComputeQueueFamilyIndex;
+            g_TransferQueueIndex       = std::min(1u, queueFamilies[g_ComputeQueueFamilyIndex].queueCount - 1u);
+        }
+
+        DLOG_INFO("Selected Vulkan Queue Families, graphics: {}, compute: {}, transfer: {}", g_QueueFamilyIndex, g_ComputeQueueFamilyIndex, g_TransferQueueFamilyIndex);
+    }
+
     void Context::SelectSwapchainImageCount(const Settings &settings) {
         auto [result, surfaceCapabilities] = g_PhysicalDevice.getSurfaceCapabilitiesKHR(g_Surface);
         DVRE_VK_CHECK(result);
@@ -514,12 +685,21 @@ namespace vre::Vulkan {
 
         physicalDevice.getFeatures2(&features2);
 
-        return dynamicFeatures2.extendedDynamicState2 == vk::True &&
+        return features2.features.multiDrawIndirect == vk::True &&
+               dynamicFeatures2.extendedDynamicState2 == vk::True &&
                dynamicFeatures.extendedDynamicState == vk::True &&
                features13.dynamicRendering == vk::True &&
                features13.synchronization2 == vk::True &&
                features12.bufferDeviceAddress == vk::True &&
-               features12.descriptorIndexing == vk::True;
+               features12.descriptorIndexing == vk::True &&
+               features12.runtimeDescriptorArray == vk::True &&
+               features12.descriptorBindingPartiallyBound == vk::True &&
+               features12.descriptorBindingSampledImageUpdateAfterBind == vk::True &&
+               features12.descriptorBindingStorageBufferUpdateAfterBind == vk::True &&
+               features12.descriptorBindingUpdateUnusedWhilePending == vk::True &&
+               features12.shaderSampledImageArrayNonUniformIndexing == vk::True &&
+               features12.shaderStorageBufferArrayNonUniformIndexing == vk::True &&
+               features12.timelineSemaphore == vk::True;
     }
 
     bool Context::CheckPhysicalDeviceSwapchainSupport(const vk::PhysicalDevice &physicalDevice, const vk::SurfaceKHR &surface, const Settings &settings) {
@@ -537,6 +717,29 @@ namespace vre::Vulkan {
         return true;
     }
 
+    bool Context::CheckPhysicalDeviceMeshShaderSupport(const vk::PhysicalDevice &physicalDevice) {
+        vk::PhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures{};
+        vk::PhysicalDeviceFeatures2             features2{};
+
+        features2.setPNext(&meshShaderFeatures);
+
+        physicalDevice.getFeatures2(&features2);
+
+        return meshShaderFeatures.taskShader == vk::True &&
+               meshShaderFeatures.meshShader == vk::True;
+    }
+
+    bool Context::CheckPhysicalDeviceDescriptorBufferSupport(const vk::PhysicalDevice &physicalDevice) {
+        vk::PhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures{};
+        vk::PhysicalDeviceFeatures2                   features2{};
+
+        features2.setPNext(&descriptorBufferFeatures);
+
+        physicalDevice.getFeatures2(&features2);
+
+        return descriptorBufferFeatures.descriptorBuffer == vk::True;
+    }
+
     bool Context::CheckPhysicalDeviceExtensionSupport(const vk::PhysicalDevice &physicalDevice, const std::vector<const char *> &requiredExtensions) {
         auto [result, availableExtensions] = physicalDevice.enumerateDeviceExtensionProperties();
         DVRE_VK_CHECK(result);
@@ -0,0 +1,463 @@
+#include <VREngine/Vulkan/Defragmenter.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Vulkan/Image.hpp>
+#include <VREngine/Vulkan/ObjectCache.hpp>
+#include <VREngine/Vulkan/Descriptor.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        vk::ImageAspectFlags GetAspectFlags(vk::Format format) {
+            switch (format) {
+                case vk::Format::eD16Unorm:
+                case vk::Format::eX8D24UnormPack32:
+                case vk::Format::eD32Sfloat:
+                    return vk::ImageAspectFlagBits::eDepth;
+                case vk::Format::eD16UnormS8Uint:
+                case vk::Format::eD24UnormS8Uint:
+                case vk::Format::eD32SfloatS8Uint:
+                    return vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil;
+                case vk::Format::eS8Uint:
+                    return vk::ImageAspectFlagBits::eStencil;
+                default:
+                    return vk::ImageAspectFlagBits::eColor;
+            }
+        }
+    }  // namespace
+
+    Defragmenter::Settings                                    Defragmenter::g_Settings{};
+    vk::Device                                                Defragmenter::g_Device{VK_NULL_HANDLE};
+    VmaAllocator                                              Defragmenter::g_Allocator{VK_NULL_HANDLE};
+    std::unordered_map<VmaAllocation, Defragmenter::Resource> Defragmenter::g_Resources{};
+    std::unordered_map<VkImageView, VmaAllocation>            Defragmenter::g_Views{};
+    VmaDefragmentationContext                                 Defragmenter::g_Context{VK_NULL_HANDLE};
+    VmaDefragmentationPassMoveInfo                            Defragmenter::g_Pass{};
+    std::vector<Defragmenter::Retired>                        Defragmenter::g_Retired{};
+    bool                                                      Defragmenter::g_IsPassActive{false};
+    std::uint64_t                                             Defragmenter::g_PassFrame{0u};
+    std::uint64_t                                             Defragmenter::g_Frame{0u};
+    Defragmenter::Statistics                                  Defragmenter::g_Statistics{};
+    std::mutex                                                Defragmenter::g_Mutex{};
+    bool                                                      Defragmenter::g_IsInitialized{false};
+    Defragmenter                                              Defragmenter::g_State{};
+
+    void Defragmenter::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::Defragmenter must be shut down before initializing");
+        DLOG_INFO("Initializing vre::Vulkan::Defragmenter");
+
+        g_Settings      = settings;
+        g_Device        = Context::GetDevice();
+        g_Allocator     = Context::GetVmaAllocator();
+        g_Context       = VK_NULL_HANDLE;
+        g_IsPassActive  = false;
+        g_Frame         = 0u;
+        g_Statistics    = Statistics{};
+        g_IsInitialized = true;
+    }
+
+    void Defragmenter::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void Defragmenter::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::Defragmenter down");
+
+        // The device is idle by now, so a running pass can be finished without waiting for its frames.
+        if (g_IsPassActive) EndPass();
+        if (g_Context != VK_NULL_HANDLE) EndDefragmentation();
+
+        if (!g_Resources.empty()) DVRE_WARN("vre::Vulkan::Defragmenter shuts down with {} registered resources", g_Resources.size());
+        g_Resources.clear();
+        g_Views.clear();
+
+        g_IsInitialized = false;
+    }
+
+    bool Defragmenter::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    void Defragmenter::Register(const Buffer::Allocation &buffer) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+        DVRE_ASSERT(
+            (buffer.UsageFlags & vk::BufferUsageFlagBits::eTransferSrc) && (buffer.UsageFlags & vk::BufferUsageFlagBits::eTransferDst),
+            "vre::Vulkan::Defragmenter needs buffers with transfer source and destination usage");
+
+        std::scoped_lock lock{g_Mutex};
+        g_Resources[buffer.Allocation] = Resource{
+            .IsImage          = false,
+            .BufferAllocation = buffer,
+        };
+    }
+
+    void Defragmenter::Register(const Image::Allocation &image, const vk::ImageCreateInfo &info, vk::ImageLayout layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+        DVRE_ASSERT(
+            (info.usage & vk::ImageUsageFlagBits::eTransferSrc) && (info.usage & vk::ImageUsageFlagBits::eTransferDst),
+            "vre::Vulkan::Defragmenter needs images with transfer source and destination usage");
+        DVRE_ASSERT(info.pNext == nullptr && info.sharingMode == vk::SharingMode::eExclusive, "vre::Vulkan::Defragmenter cannot recreate this image");
+        DVRE_ASSERT(layout != vk::ImageLayout::eUndefined, "vre::Vulkan::Defragmenter needs the layout the image is kept in between frames");
+
+        std::scoped_lock lock{g_Mutex};
+        g_Resources[image.Allocation] = Resource{
+            .IsImage         = true,
+            .ImageAllocation = image,
+            .ImageInfo       = info,
+            .Layout          = layout,
+        };
+    }
+
+    vk::ImageView Defragmenter::CreateView(const Image::Allocation &image, const vk::ImageViewCreateInfo &info) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+        DVRE_ASSERT(info.pNext == nullptr, "vre::Vulkan::Defragmenter cannot recreate views with a pNext chain");
+
+        std::scoped_lock lock{g_Mutex};
+        const auto it = g_Resources.find(image.Allocation);
+        DVRE_ASSERT(it != g_Resources.end() && it->second.IsImage, "Image was not registered with vre::Vulkan::Defragmenter");
+
+        vk::ImageViewCreateInfo viewInfo = info;
+        viewInfo.setImage(it->second.ImageAllocation.Image);
+
+        auto [result, view] = g_Device.createImageView(viewInfo);
+        VRE_VK_CHECK(result);
+
+        it->second.Views.push_back(View{view, viewInfo});
+        g_Views[view] = image.Allocation;
+        return view;
+    }
+
+    void Defragmenter::DestroyView(const vk::ImageView &view) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        const auto it = g_Views.find(view);
+        DVRE_ASSERT(it != g_Views.end(), "View was not created by vre::Vulkan::Defragmenter");
+
+        std::vector<View> &views = g_Resources[it->second].Views;
+        std::erase_if(views, [&view](const View &entry) { return entry.Handle == view; });
+        g_Views.erase(it);
+        DescriptorSet::Cache::InvalidateAll(view);
+        g_Device.destroyImageView(view);
+    }
+
+    void Defragmenter::Release(const Buffer::Allocation &buffer) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        const auto it = g_Resources.find(buffer.Allocation);
+        if (it == g_Resources.end()) {
+            Buffer::Release(buffer);
+            return;
+        }
+
+        if (g_IsPassActive) {
+            it->second.IsReleased = true;
+            return;
+        }
+        Destroy(it->second, it->first);
+        g_Resources.erase(it);
+    }
+
+    void Defragmenter::Release(const Image::Allocation &image) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        const auto it = g_Resources.find(image.Allocation);
+        if (it == g_Resources.end()) {
+            Image::Release(image);
+            return;
+        }
+
+        if (g_IsPassActive) {
+            it->second.IsReleased = true;
+            return;
+        }
+        Destroy(it->second, it->first);
+        g_Resources.erase(it);
+    }
+
+    void Defragmenter::SetUploadTicket(const Buffer::Allocation &buffer, UploadContext::Ticket ticket) {
+        SetUploadTicket(buffer.Allocation, ticket);
+    }
+
+    void Defragmenter::SetUploadTicket(const Image::Allocation &image, UploadContext::Ticket ticket) {
+        SetUploadTicket(image.Allocation, ticket);
+    }
+
+    void Defragmenter::Start() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        if (g_Context == VK_NULL_HANDLE) BeginDefragmentation();
+    }
+
+    void Defragmenter::Update(const vk::CommandBuffer &commandBuffer) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::vector<BufferMovedEvent> bufferEvents;
+        std::vector<ImageMovedEvent>  imageEvents;
+        {
+            std::scoped_lock lock{g_Mutex};
+            g_Frame++;
+
+            if (g_IsPassActive && g_Frame >= g_PassFrame + g_Settings.FramesInFlight) EndPass();
+
+            if (g_Context == VK_NULL_HANDLE && !g_Resources.empty() &&
+                g_Settings.CheckIntervalFrames != 0u && g_Frame % g_Settings.CheckIntervalFrames == 0u) {
+                g_Statistics.Fragmentation = GetFragmentation();
+                if (g_Statistics.Fragmentation > g_Settings.FragmentationThreshold) BeginDefragmentation();
+            }
+
+            if (g_Context != VK_NULL_HANDLE && !g_IsPassActive) BeginPass(commandBuffer, bufferEvents, imageEvents);
+        }
+
+        // Owners may release or register resources from their callbacks, so the events are sent without holding the lock.
+        for (const BufferMovedEvent &event : bufferEvents) EventObserver::Process(event);
+        for (const ImageMovedEvent &event : imageEvents) EventObserver::Process(event);
+    }
+
+    Defragmenter::Statistics Defragmenter::GetStatistics() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        Statistics statistics = g_Statistics;
+        statistics.IsRunning  = g_Context != VK_NULL_HANDLE;
+        return statistics;
+    }
+
+    float Defragmenter::GetFragmentation() {
+        VmaTotalStatistics statistics{};
+        vmaCalculateStatistics(g_Allocator, &statistics);
+
+        const VmaDetailedStatistics &total  = statistics.total;
+        const std::uint64_t          unused = total.statistics.blockBytes - total.statistics.allocationBytes;
+        if (unused == 0u) return 0.0f;
+        return 1.0f - float(total.unusedRangeSizeMax) / float(unused);
+    }
+
+    void Defragmenter::BeginDefragmentation() {
+        VmaDefragmentationInfo info{
+            .flags                 = g_Settings.Algorithm,
+            .maxBytesPerPass       = g_Settings.MaxBytesPerPass,
+            .maxAllocationsPerPass = g_Settings.MaxMovesPerPass,
+        };
+        VRE_VK_CHECK(vmaBeginDefragmentation(g_Allocator, &info, &g_Context));
+    }
+
+    void Defragmenter::EndDefragmentation() {
+        VmaDefragmentationStats stats{};
+        vmaEndDefragmentation(g_Allocator, g_Context, &stats);
+        g_Context = VK_NULL_HANDLE;
+
+        g_Statistics.BytesFreed              += stats.bytesFreed;
+        g_Statistics.DeviceMemoryBlocksFreed += stats.deviceMemoryBlocksFreed;
+    }
+
+    void Defragmenter::BeginPass(
+        const vk::CommandBuffer       &commandBuffer,
+        std::vector<BufferMovedEvent> &bufferEvents,
+        std::vector<ImageMovedEvent>  &imageEvents) {
+        const VkResult result = vmaBeginDefragmentationPass(g_Allocator, g_Context, &g_Pass);
+        if (result == VK_SUCCESS) {
+            EndDefragmentation();
+            return;
+        }
+        VRE_ASSERT(result == VK_INCOMPLETE, "Failed to begin a defragmentation pass");
+
+        vk::MemoryBarrier2 readBarrier{
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite,
+            vk::PipelineStageFlagBits2::eTransfer,
+            vk::AccessFlagBits2::eTransferRead,
+        };
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {readBarrier}, {}, {}}});
+
+        for (std::uint32_t i = 0u; i < g_Pass.moveCount; i++) {
+            VmaDefragmentationMove &move = g_Pass.pMoves[i];
+
+            // Mapped allocations are skipped, their pointers would change under the owner. Host visible memory that is
+            // not mapped still moves, which on ReBAR and UMA devices is most of it. Resources with an upload in flight wait
+            // for a later pass, the upload still writes through the old handle.
+            VmaAllocationInfo allocationInfo{};
+            vmaGetAllocationInfo(g_Allocator, move.srcAllocation, &allocationInfo);
+
+            const auto it = g_Resources.find(move.srcAllocation);
+            if (it == g_Resources.end() || it->second.IsReleased || allocationInfo.pMappedData != nullptr ||
+                (it->second.UploadTicket != UploadContext::INVALID_TICKET && !UploadContext::IsComplete(it->second.UploadTicket))) {
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                continue;
+            }
+
+            g_Statistics.Moves++;
+            g_Statistics.BytesMoved += allocationInfo.size;
+
+            if (it->second.IsImage)
+                MoveImage(commandBuffer, move, it->second, imageEvents);
+            else
+                MoveBuffer(commandBuffer, move, it->second, bufferEvents);
+        }
+
+        vk::MemoryBarrier2 writeBarrier{
+            vk::PipelineStageFlagBits2::eTransfer,
+            vk::AccessFlagBits2::eTransferWrite,
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite | vk::AccessFlagBits2::eMemoryRead,
+        };
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {writeBarrier}, {}, {}}});
+
+        g_IsPassActive = true;
+        g_PassFrame    = g_Frame;
+    }
+
+    void Defragmenter::EndPass() {
+        // The old handles are still bound to the memory that vmaEndDefragmentationPass() frees.
+        for (const Retired &retired : g_Retired) {
+            for (const vk::ImageView &view : retired.Views) {
+                DescriptorSet::Cache::InvalidateAll(view);
+                g_Device.destroyImageView(view);
+            }
+            if (retired.Image && ObjectCache::IsInitialized()) ObjectCache::Invalidate(retired.Image);
+            if (retired.Image) g_Device.destroyImage(retired.Image);
+            if (retired.Buffer) {
+                DescriptorSet::Cache::InvalidateAll(retired.Buffer);
+                g_Device.destroyBuffer(retired.Buffer);
+            }
+        }
+        g_Retired.clear();
+
+        const VkResult result = vmaEndDefragmentationPass(g_Allocator, g_Context, &g_Pass);
+        g_IsPassActive        = false;
+        g_Statistics.Passes++;
+
+        for (auto it = g_Resources.begin(); it != g_Resources.end();) {
+            if (it->second.IsReleased) {
+                Destroy(it->second, it->first);
+                it = g_Resources.erase(it);
+            } else
+                it++;
+        }
+
+        if (result == VK_SUCCESS) EndDefragmentation();
+    }
+
+    void Defragmenter::MoveBuffer(
+        const vk::CommandBuffer       &commandBuffer,
+        const VmaDefragmentationMove  &move,
+        Resource                      &resource,
+        std::vector<BufferMovedEvent> &events) {
+        const Buffer::Allocation oldBuffer = resource.BufferAllocation;
+
+        auto [result, buffer] = g_Device.createBuffer(Buffer::GetCreateInfo(oldBuffer.Size, oldBuffer.UsageFlags));
+        VRE_VK_CHECK(result);
+        VRE_VK_CHECK(vmaBindBufferMemory(g_Allocator, move.dstTmpAllocation, buffer));
+
+        commandBuffer.copyBuffer(oldBuffer.Buffer, buffer, {vk::BufferCopy{0u, 0u, oldBuffer.Size}});
+
+        Buffer::Allocation newBuffer = oldBuffer;
+        newBuffer.Buffer             = buffer;
+        newBuffer.Address            = oldBuffer.UsageFlags & vk::BufferUsageFlagBits::eShaderDeviceAddress
+                                           ? g_Device.getBufferAddress(vk::BufferDeviceAddressInfo{buffer})
+                                           : 0u;
+
+        resource.BufferAllocation = newBuffer;
+        g_Retired.push_back(Retired{.Buffer = oldBuffer.Buffer});
+        events.emplace_back(oldBuffer, newBuffer);
+    }
+
+    void Defragmenter::MoveImage(
+        const vk::CommandBuffer      &commandBuffer,
+        const VmaDefragmentationMove &move,
+        Resource                     &resource,
+        std::vector<ImageMovedEvent> &events) {
+        const Image::Allocation    oldImage = resource.ImageAllocation;
+        const vk::ImageCreateInfo &info     = resource.ImageInfo;
+
+        auto [result, image] = g_Device.createImage(info);
+        VRE_VK_CHECK(result);
+        VRE_VK_CHECK(vmaBindImageMemory(g_Allocator, move.dstTmpAllocation, image));
+
+        Image::Allocation newImage = oldImage;
+        newImage.Image             = image;
+
+        const vk::ImageAspectFlags      aspectFlags = GetAspectFlags(info.format);
+        const vk::ImageSubresourceRange range       = Image::GetSubresourceRange(aspectFlags);
+        Image::TransitionLayout(commandBuffer, oldImage, range, resource.Layout, vk::ImageLayout::eTransferSrcOptimal);
+        Image::TransitionLayout(commandBuffer, newImage, range, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
+
+        std::vector<vk::ImageCopy> regions;
+        regions.reserve(info.mipLevels);
+        for (std::uint32_t mip = 0u; mip < info.mipLevels; mip++) {
+            const vk::ImageSubresourceLayers subresource{aspectFlags, mip, 0u, info.arrayLayers};
+            regions.push_back(vk::ImageCopy{
+                subresource,
+                vk::Offset3D{},
+                subresource,
+                vk::Offset3D{},
+                vk::Extent3D{
+                    std::max(info.extent.width >> mip, 1u),
+                    std::max(info.extent.height >> mip, 1u),
+                    std::max(info.extent.depth >> mip, 1u),
+                },
+            });
+        }
+        commandBuffer.copyImage(
+            oldImage.Image,
+            vk::ImageLayout::eTransferSrcOptimal,
+            image,
+            vk::ImageLayout::eTransferDstOptimal,
+            regions);
+
+        Image::TransitionLayout(commandBuffer, newImage, range, vk::ImageLayout::eTransferDstOptimal, resource.Layout);
+
+        Retired                                              retired{.Image = oldImage.Image};
+        std::vector<std::pair<vk::ImageView, vk::ImageView>> views;
+        views.reserve(resource.Views.size());
+        for (View &view : resource.Views) {
+            view.Info.setImage(image);
+
+            auto [viewResult, newView] = g_Device.createImageView(view.Info);
+            VRE_VK_CHECK(viewResult);
+
+            views.emplace_back(view.Handle, newView);
+            retired.Views.push_back(view.Handle);
+            g_Views.erase(view.Handle);
+            g_Views[newView] = move.srcAllocation;
+            view.Handle      = newView;
+        }
+
+        resource.ImageAllocation = newImage;
+        g_Retired.push_back(std::move(retired));
+        events.emplace_back(oldImage, newImage, views);
+    }
+
+    void Defragmenter::Destroy(const Resource &resource, VmaAllocation allocation) {
+        for (const View &view : resource.Views) {
+            DescriptorSet::Cache::InvalidateAll(view.Handle);
+            g_Device.destroyImageView(view.Handle);
+            g_Views.erase(view.Handle);
+        }
+
+        if (resource.IsImage && ObjectCache::IsInitialized()) ObjectCache::Invalidate(resource.ImageAllocation.Image);
+        if (resource.IsImage) {
+            vmaDestroyImage(g_Allocator, resource.ImageAllocation.Image, allocation);
+        } else {
+            DescriptorSet::Cache::InvalidateAll(resource.BufferAllocation.Buffer);
+            vmaDestroyBuffer(g_Allocator, resource.BufferAllocation.Buffer, allocation);
+        }
+    }
+
+    void Defragmenter::SetUploadTicket(VmaAllocation allocation, UploadContext::Ticket ticket) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::Defragmenter must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        const auto it = g_Resources.find(allocation);
+        DVRE_ASSERT(it != g_Resources.end(), "Resource was not registered with vre::Vulkan::Defragmenter");
+        it->second.UploadTicket = std::max(it->second.UploadTicket, ticket);
+    }
+
+    Defragmenter::~Defragmenter() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::Defragmenter must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <VREngine/Vulkan/Descriptor.hpp>
+#include <VREngine/Vulkan/Context.hpp>
 
 namespace vre::Vulkan {
     namespace DescriptorLayout {
@@ -61,6 +62,14 @@ namespace vre::Vulkan {
             return layout;
         }
 
+        vk::DescriptorSetLayoutCreateFlags Builder::getFlags() const {
+            return m_Flags;
+        }
+
+        const std::vector<vk::DescriptorSetLayoutBinding> &Builder::getBindings() const {
+            return m_Bindings;
+        }
+
         vk::DescriptorSetLayout Create(
             vk::DescriptorSetLayoutCreateFlags flags,
             const vk::ArrayProxy<Binding>     &bindings,
@@ -296,13 +305,18 @@ namespace vre::Vulkan {
             m_ImageInfos.clear();
         }
 
-        void Binder::bind(const vk::DescriptorSet &set, const vk::Device &device) {
+        void Binder::bind(const vk::DescriptorSet &set, const vk::Device &device) const {
+            device.updateDescriptorSets(getWrites(set), {});
+        }
+
+        void Binder::bind(const vk::Device &device) const {
             std::vector<vk::WriteDescriptorSet> writes{};
             writes.reserve(m_BufferBindings.size() + m_ImageBindings.size());
 
-            for (const Binding &binding : m_ImageBindings)
+            for (const Binding &binding : m_ImageBindings) {
+                DVRE_ASSERT(!!binding.Set, "vk::DescriptorSet should be provided!");
                 writes.push_back(vk::WriteDescriptorSet{
-                    set,
+                    binding.Set,
                     binding.Binding,
                     0u,
                     binding.Type,
@@ -310,10 +324,12 @@ namespace vre::Vulkan {
                     {},
                     {},
                 });
+            }
 
-            for (const Binding &binding : m_BufferBindings)
+            for (const Binding &binding : m_BufferBindings) {
+                DVRE_ASSERT(!!binding.Set, "vk::DescriptorSet should be provided!");
                 writes.push_back(vk::WriteDescriptorSet{
-                    set,
+                    binding.Set,
                     binding.Binding,
                     0u,
                     binding.Type,
@@ -321,18 +337,133 @@ namespace vre::Vulkan {
                     {m_BufferInfos[binding.InfoIndex]},
                     {},
                 });
+            }
 
             device.updateDescriptorSets(writes, {});
         }
 
-        void Binder::bind(const vk::Device &device) {
+        std::uint64_t Binder::getHash() const {
+            std::uint64_t hash = 0u;
+
+            for (const Binding &binding : m_ImageBindings) {
+                const vk::DescriptorImageInfo &info = m_ImageInfos[binding.InfoIndex];
+
+                hash = Hash::Combine(hash, Hash::Value(binding.Binding));
+                hash = Hash::Combine(hash, Hash::Value(binding.Type));
+                hash = Hash::Combine(hash, Hash::Value(info.sampler));
+                hash = Hash::Combine(hash, Hash::Value(info.imageView));
+                hash = Hash::Combine(hash, Hash::Value(info.imageLayout));
+            }
+
+            for (const Binding &binding : m_BufferBindings) {
+                const vk::DescriptorBufferInfo &info = m_BufferInfos[binding.InfoIndex];
+
+                hash = Hash::Combine(hash, Hash::Value(binding.Binding));
+                hash = Hash::Combine(hash, Hash::Value(binding.Type));
+                hash = Hash::Combine(hash, Hash::Value(info.buffer));
+                hash = Hash::Combine(hash, Hash::Value(info.offset));
+                hash = Hash::Combine(hash, Hash::Value(info.range));
+            }
+
+            return hash;
+        }
+
+        bool Binder::references(const vk::Buffer &buffer) const {
+            return std::ranges::any_of(m_BufferInfos, [&](const vk::DescriptorBufferInfo &info) { return info.buffer == buffer; });
+        }
+
+        bool Binder::references(const vk::ImageView &view) const {
+            return std::ranges::any_of(m_ImageInfos, [&](const vk::DescriptorImageInfo &info) { return info.imageView == view; });
+        }
+
+        bool Binder::references(const vk::Sampler &sampler) const {
+            return std::ranges::any_of(m_ImageInfos, [&](const vk::DescriptorImageInfo &info) { return info.sampler == sampler; });
+        }
+
+        bool Binder::operator==(const Binder &other) const {
+            const auto equalBindings = [](const std::vector<Binding> &a, const std::vector<Binding> &b) {
+                return std::ranges::equal(a, b, [](const Binding &x, const Binding &y) {
+                    return x.Set == y.Set && x.Binding == y.Binding && x.Type == y.Type && x.InfoIndex == y.InfoIndex;
+                });
+            };
+
+            return m_BufferInfos == other.m_BufferInfos && m_ImageInfos == other.m_ImageInfos &&
+                   equalBindings(m_BufferBindings, other.m_BufferBindings) &&
+                   equalBindings(m_ImageBindings, other.m_ImageBindings);
+        }
+
+        void Binder::push(
+            const vk::CommandBuffer  &commandBuffer,
+            vk::PipelineBindPoint     bindPoint,
+            const vk::PipelineLayout &layout,
+            std::uint32_t             set) const {
+            PFN_vkCmdPushDescriptorSetKHR pushDescriptorSet = Context::GetCmdPushDescriptorSetFunction();
+            DVRE_ASSERT(pushDescriptorSet != nullptr, "VK_KHR_push_descriptor is not supported by the selected GPU");
+
+            std::vector<vk::WriteDescriptorSet> writes = getWrites({});
+            pushDescriptorSet(
+                commandBuffer,
+                VkPipelineBindPoint(bindPoint),
+                layout,
+                set,
+                std::uint32_t(writes.size()),
+                reinterpret_cast<const VkWriteDescriptorSet *>(writes.data()));
+        }
+
+        vk::DescriptorUpdateTemplate Binder::createUpdateTemplate(const vk::DescriptorSetLayout &layout, const vk::Device &device) const {
+            std::vector<vk::DescriptorUpdateTemplateEntry> entries = getTemplateEntries();
+
+            auto [result, updateTemplate] = device.createDescriptorUpdateTemplate(vk::DescriptorUpdateTemplateCreateInfo{
+                {},
+                entries,
+                vk::DescriptorUpdateTemplateType::eDescriptorSet,
+                layout,
+            });
+            DVRE_VK_CHECK(result);
+            return updateTemplate;
+        }
+
+        vk::DescriptorUpdateTemplate Binder::createPushTemplate(
+            vk::PipelineBindPoint     bindPoint,
+            const vk::PipelineLayout &layout,
+            std::uint32_t             set,
+            const vk::Device         &device) const {
+            DVRE_ASSERT(Context::IsPushDescriptorSupported(), "VK_KHR_push_descriptor is not supported by the selected GPU");
+            std::vector<vk::DescriptorUpdateTemplateEntry> entries = getTemplateEntries();
+
+            auto [result, updateTemplate] = device.createDescriptorUpdateTemplate(vk::DescriptorUpdateTemplateCreateInfo{
+                {},
+                entries,
+                vk::DescriptorUpdateTemplateType::ePushDescriptorsKHR,
+                {},
+                bindPoint,
+                layout,
+                set,
+            });
+            DVRE_VK_CHECK(result);
+            return updateTemplate;
+        }
+
+        std::uint32_t Binder::getDataSize() const {
+            return std::uint32_t((m_BufferBindings.size() + m_ImageBindings.size()) * sizeof(vk::DescriptorBufferInfo));
+        }
+
+        void Binder::pack(void *data) const {
+            std::byte *bytes = static_cast<std::byte *>(data);
+
+            for (const Binding &binding : m_BufferBindings)
+                std::memcpy(bytes + binding.Order * sizeof(vk::DescriptorBufferInfo), &m_BufferInfos[binding.InfoIndex], sizeof(vk::DescriptorBufferInfo));
+            for (const Binding &binding : m_ImageBindings)
+                std::memcpy(bytes + binding.Order * sizeof(vk::DescriptorImageInfo), &m_ImageInfos[binding.InfoIndex], sizeof(vk::DescriptorImageInfo));
+        }
+
+        std::vector<vk::WriteDescriptorSet> Binder::getWrites(const vk::DescriptorSet &set) const {
             std::vector<vk::WriteDescriptorSet> writes{};
             writes.reserve(m_BufferBindings.size() + m_ImageBindings.size());
 
-            for (const Binding &binding : m_ImageBindings) {
-                DVRE_ASSERT(!!binding.Set, "vk::DescriptorSet should be provided!");
+            for (const Binding &binding : m_ImageBindings)
                 writes.push_back(vk::WriteDescriptorSet{
-                    binding.Set,
+                    set,
                     binding.Binding,
                     0u,
                     binding.Type,
@@ -340,12 +471,10 @@ namespace vre::Vulkan {
                     {},
                     {},
                 });
-            }
 
-            for (const Binding &binding : m_BufferBindings) {
-                DVRE_ASSERT(!!binding.Set, "vk::DescriptorSet should be provided!");
+            for (const Binding &binding : m_BufferBindings)
                 writes.push_back(vk::WriteDescriptorSet{
-                    binding.Set,
+                    set,
                     binding.Binding,
                     0u,
                     binding.Type,
@@ -353,9 +482,28 @@ namespace vre::Vulkan {
                     {m_BufferInfos[binding.InfoIndex]},
                     {},
                 });
-            }
 
-            device.updateDescriptorSets(writes, {});
+            return writes;
+        }
+
+        std::vector<vk::DescriptorUpdateTemplateEntry> Binder::getTemplateEntries() const {
+            static_assert(sizeof(vk::DescriptorBufferInfo) == sizeof(vk::DescriptorImageInfo));
+
+            std::vector<vk::DescriptorUpdateTemplateEntry> entries{};
+            entries.reserve(m_BufferBindings.size() + m_ImageBindings.size());
+
+            for (const std::vector<Binding> *bindings : {&m_ImageBindings, &m_BufferBindings})
+                for (const Binding &binding : *bindings)
+                    entries.push_back(vk::DescriptorUpdateTemplateEntry{
+                        binding.Binding,
+                        0u,
+                        1u,
+                        binding.Type,
+                        binding.Order * sizeof(vk::DescriptorBufferInfo),
+                        sizeof(vk::DescriptorBufferInfo),
+                    });
+
+            return entries;
         }
 
         Binder &Binder::addUniformBuffer(
@@ -367,6 +515,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eUniformBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer.Buffer,
@@ -385,6 +534,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer.Buffer,
@@ -404,6 +554,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eUniformBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer,
@@ -423,6 +574,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer,
@@ -442,6 +594,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eSampledImage,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -461,6 +614,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageImage,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -480,6 +634,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eInputAttachment,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -498,6 +653,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eSampler,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{sampler});
             return *this;
@@ -514,6 +670,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eCombinedImageSampler,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 sampler,
@@ -530,6 +687,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eUniformBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer.Buffer,
@@ -546,6 +704,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer.Buffer,
@@ -563,6 +722,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eUniformBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer,
@@ -580,6 +740,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageBuffer,
                 .InfoIndex = std::uint32_t(m_BufferInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_BufferInfos.push_back(vk::DescriptorBufferInfo{
                 buffer,
@@ -597,6 +758,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eSampledImage,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -614,6 +776,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eStorageImage,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -631,6 +794,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eInputAttachment,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 VK_NULL_HANDLE,
@@ -647,6 +811,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eSampler,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{sampler});
             return *this;
@@ -661,6 +826,7 @@ namespace vre::Vulkan {
                 .Binding   = binding,
                 .Type      = vk::DescriptorType::eCombinedImageSampler,
                 .InfoIndex = std::uint32_t(m_ImageInfos.size()),
+                .Order     = std::uint32_t(m_BufferBindings.size() + m_ImageBindings.size()),
             });
             m_ImageInfos.push_back(vk::DescriptorImageInfo{
                 sampler,
@@ -670,6 +836,266 @@ namespace vre::Vulkan {
             return *this;
         }
 
+        void Allocator::init(
+            std::uint32_t                                        initialSets,
+            const vk::ArrayProxy<DescriptorPool::PoolSizeRatio> &poolSizeRatios,
+            const vk::Device                                    &device) {
+            DVRE_ASSERT(initialSets != 0u, "vre::Vulkan::DescriptorSet::Allocator needs at least one set per pool");
+
+            m_PoolSizeRatios.assign(poolSizeRatios.begin(), poolSizeRatios.end());
+            m_Device      = device;
+            m_SetsPerPool = std::min(initialSets, MAX_SETS_PER_POOL);
+
+            m_ReadyPools.push_back(createPool(m_SetsPerPool));
+            m_GrowCount = 0u;
+        }
+
+        void Allocator::clear() {
+            for (const vk::DescriptorPool &pool : m_ReadyPools)
+                DescriptorPool::Clear(pool, m_Device);
+            for (const vk::DescriptorPool &pool : m_FullPools) {
+                DescriptorPool::Clear(pool, m_Device);
+                m_ReadyPools.push_back(pool);
+            }
+
+            m_FullPools.clear();
+            m_AllocatedSets = 0u;
+        }
+
+        void Allocator::release() {
+            for (const vk::DescriptorPool &pool : m_ReadyPools) m_Device.destroy(pool);
+            for (const vk::DescriptorPool &pool : m_FullPools) m_Device.destroy(pool);
+
+            m_ReadyPools.clear();
+            m_FullPools.clear();
+            m_SetCapacity   = 0u;
+            m_AllocatedSets = 0u;
+        }
+
+        vk::DescriptorSet Allocator::allocate(const vk::DescriptorSetLayout &layout, const void *next) {
+            vk::DescriptorPool            pool = acquirePool();
+            vk::DescriptorSetAllocateInfo allocateInfo{pool, 1u, &layout, next};
+            vk::DescriptorSet             set{};
+
+            vk::Result result = m_Device.allocateDescriptorSets(&allocateInfo, &set);
+            if (result == vk::Result::eErrorOutOfPoolMemory || result == vk::Result::eErrorFragmentedPool) {
+                m_FullPools.push_back(pool);
+
+                pool = acquirePool();
+                allocateInfo.setDescriptorPool(pool);
+                result = m_Device.allocateDescriptorSets(&allocateInfo, &set);
+            }
+
+            // A fresh pool that can not hold one set means the layout needs more descriptors than a pool is created with,
+            // this is checked in release builds too so a null set is never handed out.
+            VRE_VK_CHECK(result);
+            m_ReadyPools.push_back(pool);
+
+            m_AllocatedSets++;
+            m_PeakAllocatedSets = std::max(m_PeakAllocatedSets, m_AllocatedSets);
+            return set;
+        }
+
+        Allocator::Statistics Allocator::getStatistics() const {
+            return Statistics{
+                .PoolCount         = std::uint32_t(m_ReadyPools.size() + m_FullPools.size()),
+                .FullPoolCount     = std::uint32_t(m_FullPools.size()),
+                .SetCapacity       = m_SetCapacity,
+                .AllocatedSets     = m_AllocatedSets,
+                .PeakAllocatedSets = m_PeakAllocatedSets,
+                .GrowCount         = m_GrowCount,
+            };
+        }
+
+        vk::DescriptorPool Allocator::acquirePool() {
+            if (!m_ReadyPools.empty()) {
+                vk::DescriptorPool pool = m_ReadyPools.back();
+                m_ReadyPools.pop_back();
+                return pool;
+            }
+
+            // Every new pool is larger than the last, so a frame that outgrows its pools needs few of them.
+            m_SetsPerPool = std::min(m_SetsPerPool + m_SetsPerPool / 2u, MAX_SETS_PER_POOL);
+            m_GrowCount++;
+            DLOG_INFO("Growing vre::Vulkan::DescriptorSet::Allocator with a pool of {} sets", m_SetsPerPool);
+            return createPool(m_SetsPerPool);
+        }
+
+        vk::DescriptorPool Allocator::createPool(std::uint32_t setCount) {
+            m_SetCapacity += setCount;
+            return DescriptorPool::Create(setCount, m_PoolSizeRatios, m_Device);
+        }
+
+        std::vector<Cache *> Cache::g_Caches{};
+        std::mutex           Cache::g_CachesMutex{};
+
+        void Cache::InvalidateAll(const vk::Buffer &buffer) {
+            InvalidateRegistered(buffer);
+        }
+
+        void Cache::InvalidateAll(const vk::ImageView &view) {
+            InvalidateRegistered(view);
+        }
+
+        void Cache::InvalidateAll(const vk::Sampler &sampler) {
+            InvalidateRegistered(sampler);
+        }
+
+        template <typename Handle>
+        void Cache::InvalidateRegistered(const Handle &handle) {
+            std::scoped_lock lock{g_CachesMutex};
+            for (Cache *cache : g_Caches)
+                cache->invalidate(handle);
+        }
+
+        void Cache::init(
+            std::uint32_t                                        framesInFlight,
+            std::uint32_t                                        initialSets,
+            const vk::ArrayProxy<DescriptorPool::PoolSizeRatio> &poolSizeRatios,
+            const vk::Device                                    &device) {
+            m_Allocator.init(initialSets, poolSizeRatios, device);
+            m_FramesInFlight = framesInFlight;
+            m_Device         = device;
+
+            std::scoped_lock lock{g_CachesMutex};
+            g_Caches.push_back(this);
+        }
+
+        void Cache::update() {
+            std::scoped_lock lock{m_Mutex};
+            m_Frame++;
+
+            while (!m_Retired.empty() && m_Retired.front().Frame + m_FramesInFlight <= m_Frame) {
+                const Retired &retired = m_Retired.front();
+                m_FreeSets[retired.Layout].push_back(retired.Set);
+                m_Retired.pop_front();
+            }
+
+            // Ages are checked every MAX_UNUSED_FRAMES frames, so an unused entry lives between one and two intervals.
+            if (m_Frame % MAX_UNUSED_FRAMES != 0u) return;
+            for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+                if (it->second.LastUsedFrame + MAX_UNUSED_FRAMES > m_Frame) {
+                    ++it;
+                    continue;
+                }
+
+                retire(it->second);
+                it = m_Entries.erase(it);
+                m_Evictions++;
+            }
+        }
+
+        void Cache::release() {
+            {
+                std::scoped_lock lock{g_CachesMutex};
+                std::erase(g_Caches, this);
+            }
+
+            std::scoped_lock lock{m_Mutex};
+            m_Allocator.release();
+            m_Entries.clear();
+            m_FreeSets.clear();
+            m_Retired.clear();
+        }
+
+        vk::DescriptorSet Cache::get(const vk::DescriptorSetLayout &layout, const Binder &binder) {
+            const std::uint64_t hash = Hash::Combine(Hash::Value(layout), binder.getHash());
+
+            std::scoped_lock lock{m_Mutex};
+            auto             it = m_Entries.find(hash);
+            if (it != m_Entries.end()) {
+                if (it->second.Layout == layout && it->second.Contents == binder) {
+                    it->second.LastUsedFrame = m_Frame;
+                    m_Hits++;
+                    return it->second.Set;
+                }
+
+                // Two different contents landed on the same hash, the newer one takes the slot.
+                retire(it->second);
+                m_Entries.erase(it);
+            }
+
+            m_Misses++;
+
+            vk::DescriptorSet               set{};
+            std::vector<vk::DescriptorSet> &freeSets = m_FreeSets[layout];
+            if (!freeSets.empty()) {
+                set = freeSets.back();
+                freeSets.pop_back();
+            } else {
+                set = m_Allocator.allocate(layout);
+            }
+
+            binder.bind(set, m_Device);
+            m_Entries.emplace(hash, Entry{layout, binder, set, m_Frame});
+            return set;
+        }
+
+        void Cache::invalidate(const vk::Buffer &buffer) {
+            invalidateIf([&](const Binder &binder) { return binder.references(buffer); });
+        }
+
+        void Cache::invalidate(const vk::ImageView &view) {
+            invalidateIf([&](const Binder &binder) { return binder.references(view); });
+        }
+
+        void Cache::invalidate(const vk::Sampler &sampler) {
+            invalidateIf([&](const Binder &binder) { return binder.references(sampler); });
+        }
+
+        Cache::Statistics Cache::getStatistics() const {
+            std::scoped_lock lock{m_Mutex};
+            return Statistics{
+                .Hits          = m_Hits,
+                .Misses        = m_Misses,
+                .Invalidations = m_Invalidations,
+                .Evictions     = m_Evictions,
+                .EntryCount    = std::uint32_t(m_Entries.size()),
+            };
+        }
+
+        template <typename Predicate>
+        void Cache::invalidateIf(const Predicate &predicate) {
+            std::scoped_lock lock{m_Mutex};
+            for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+                if (!predicate(it->second.Contents)) {
+                    ++it;
+                    continue;
+                }
+
+                retire(it->second);
+                it = m_Entries.erase(it);
+                m_Invalidations++;
+            }
+        }
+
+        void Cache::retire(const Entry &entry) {
+            m_Retired.push_back(Retired{
+                .Layout = entry.Layout,
+                .Set    = entry.Set,
+                .Frame  = m_Frame,
+            });
+        }
+
+        void UpdateWithTemplate(
+            const vk::DescriptorSet            &set,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const void                         *data,
+            const vk::Device                   &device) {
+            device.updateDescriptorSetWithTemplate(set, updateTemplate, data);
+        }
+
+        void PushWithTemplate(
+            const vk::CommandBuffer            &commandBuffer,
+            const vk::DescriptorUpdateTemplate &updateTemplate,
+            const vk::PipelineLayout           &layout,
+            std::uint32_t                       set,
+            const void                         *data) {
+            PFN_vkCmdPushDescriptorSetWithTemplateKHR pushDescriptorSetWithTemplate = Context::GetCmdPushDescriptorSetWithTemplateFunction();
+            DVRE_ASSERT(pushDescriptorSetWithTemplate != nullptr, "VK_KHR_push_descriptor is not supported by the selected GPU");
+            pushDescriptorSetWithTemplate(commandBuffer, updateTemplate, layout, set, data);
+        }
+
         vk::DescriptorSet Allocate(
             const vk::DescriptorPool      &pool,
             const vk::DescriptorSetLayout &layout,
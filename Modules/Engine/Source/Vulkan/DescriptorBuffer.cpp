@@ -0,0 +1,368 @@
+#include <VREngine/Vulkan/DescriptorBuffer.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) {
+            return (value + alignment - 1u) / alignment * alignment;
+        }
+
+        template <typename T>
+        T LoadFunction(const vk::Device &device, const char *name) {
+            T function = (T)vkGetDeviceProcAddr(device, name);
+            VRE_ASSERT(function != nullptr, "Failed to load {}", name);
+            return function;
+        }
+    }  // namespace
+
+    DescriptorBuffer::Settings                                              DescriptorBuffer::g_Settings{};
+    vk::Device                                                              DescriptorBuffer::g_Device{VK_NULL_HANDLE};
+    vk::PhysicalDeviceDescriptorBufferPropertiesEXT                         DescriptorBuffer::g_Properties{};
+    std::array<DescriptorBuffer::Heap, 2>                                   DescriptorBuffer::g_Heaps{};
+    std::unordered_map<VkDescriptorSetLayout, DescriptorBuffer::LayoutInfo> DescriptorBuffer::g_Layouts{};
+    std::mutex                                                              DescriptorBuffer::g_Mutex{};
+    std::uint64_t                                                           DescriptorBuffer::g_Frame{0u};
+    PFN_vkGetDescriptorSetLayoutSizeEXT                                     DescriptorBuffer::g_GetDescriptorSetLayoutSize{nullptr};
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT                            DescriptorBuffer::g_GetDescriptorSetLayoutBindingOffset{nullptr};
+    PFN_vkGetDescriptorEXT                                                  DescriptorBuffer::g_GetDescriptor{nullptr};
+    PFN_vkCmdBindDescriptorBuffersEXT                                       DescriptorBuffer::g_CmdBindDescriptorBuffers{nullptr};
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT                                  DescriptorBuffer::g_CmdSetDescriptorBufferOffsets{nullptr};
+    bool                                                                    DescriptorBuffer::g_IsInitialized{false};
+    DescriptorBuffer                                                        DescriptorBuffer::g_State{};
+
+    void DescriptorBuffer::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be shut down before initializing");
+        DVRE_ASSERT(Context::IsDescriptorBufferSupported(), "VK_EXT_descriptor_buffer is not supported by the selected GPU");
+        DVRE_ASSERT(settings.FramesInFlight != 0u, "vre::Vulkan::DescriptorBuffer needs at least one frame in flight");
+        DLOG_INFO("Initializing vre::Vulkan::DescriptorBuffer");
+
+        g_Settings = settings;
+        g_Device   = Context::GetDevice();
+
+        vk::PhysicalDeviceProperties2 properties{};
+        properties.setPNext(&g_Properties);
+        Context::GetPhysicalDevice().getProperties2(&properties);
+
+        g_GetDescriptorSetLayoutSize          = LoadFunction<PFN_vkGetDescriptorSetLayoutSizeEXT>(g_Device, "vkGetDescriptorSetLayoutSizeEXT");
+        g_GetDescriptorSetLayoutBindingOffset = LoadFunction<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT>(g_Device, "vkGetDescriptorSetLayoutBindingOffsetEXT");
+        g_GetDescriptor                       = LoadFunction<PFN_vkGetDescriptorEXT>(g_Device, "vkGetDescriptorEXT");
+        g_CmdBindDescriptorBuffers            = LoadFunction<PFN_vkCmdBindDescriptorBuffersEXT>(g_Device, "vkCmdBindDescriptorBuffersEXT");
+        g_CmdSetDescriptorBufferOffsets       = LoadFunction<PFN_vkCmdSetDescriptorBufferOffsetsEXT>(g_Device, "vkCmdSetDescriptorBufferOffsetsEXT");
+
+        const std::uint64_t alignment = std::max<std::uint64_t>(g_Properties.descriptorBufferOffsetAlignment, 1u);
+
+        const auto initializeHeap = [&](Heap &heap, std::uint64_t persistentSize, std::uint64_t frameSize, std::uint64_t maxRange, vk::BufferUsageFlags usageFlags) {
+            heap.PersistentSize = AlignUp(persistentSize, alignment);
+            heap.FrameSize      = AlignUp(frameSize, alignment);
+
+            const std::uint64_t size = heap.PersistentSize + heap.FrameSize * g_Settings.FramesInFlight;
+            VRE_ASSERT(size <= maxRange, "vre::Vulkan::DescriptorBuffer needs {} bytes, the device only addresses {}", size, maxRange);
+            VRE_ASSERT(heap.PersistentSize <= OffsetAllocator::NO_SPACE, "vre::Vulkan::DescriptorBuffer persistent range is too large");
+
+            heap.Storage = Buffer::AllocateMapped(
+                VMA_MEMORY_USAGE_CPU_TO_GPU,
+                size,
+                usageFlags | vk::BufferUsageFlagBits::eShaderDeviceAddress,
+                Context::GetVmaAllocator());
+
+            VmaAllocationInfo allocationInfo{};
+            vmaGetAllocationInfo(heap.Storage.Allocator, heap.Storage.Allocation, &allocationInfo);
+            heap.Data = (std::byte *)allocationInfo.pMappedData;
+
+            heap.Persistent = OffsetAllocator(std::uint32_t(heap.PersistentSize));
+            heap.FrameBase  = heap.PersistentSize;
+            heap.FrameOffset.store(0u, std::memory_order_relaxed);
+        };
+
+        initializeHeap(
+            g_Heaps[RESOURCE_BUFFER_INDEX],
+            g_Settings.ResourceSize,
+            g_Settings.ResourceFrameSize,
+            g_Properties.maxResourceDescriptorBufferRange,
+            vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT);
+        // Combined image samplers live in the sampler buffer, which then needs both usages.
+        initializeHeap(
+            g_Heaps[SAMPLER_BUFFER_INDEX],
+            g_Settings.SamplerSize,
+            g_Settings.SamplerFrameSize,
+            g_Properties.maxSamplerDescriptorBufferRange,
+            vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT | vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT);
+
+        g_Frame         = 0u;
+        g_IsInitialized = true;
+    }
+
+    void DescriptorBuffer::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void DescriptorBuffer::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::DescriptorBuffer down");
+
+        for (const auto &[layout, info] : g_Layouts) g_Device.destroy(vk::DescriptorSetLayout(layout));
+        g_Layouts.clear();
+
+        for (Heap &heap : g_Heaps) {
+            Buffer::Release(heap.Storage);
+            heap.Storage    = Buffer::Allocation{};
+            heap.Data       = nullptr;
+            heap.Persistent = OffsetAllocator{};
+            heap.Pending.clear();
+        }
+
+        g_IsInitialized = false;
+    }
+
+    bool DescriptorBuffer::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    vk::DescriptorSetLayout DescriptorBuffer::CreateLayout(DescriptorLayout::Builder &builder, vk::ShaderStageFlags stageFlags) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        builder.setFlags(vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT);
+        return RegisterLayout(builder, builder.build(stageFlags, g_Device));
+    }
+
+    vk::DescriptorSetLayout DescriptorBuffer::CreateLayout(DescriptorLayout::Builder &builder) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        builder.setFlags(vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT);
+        return RegisterLayout(builder, builder.build(g_Device));
+    }
+
+    void DescriptorBuffer::DestroyLayout(const vk::DescriptorSetLayout &layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        g_Layouts.erase(layout);
+        g_Device.destroy(layout);
+    }
+
+    void DescriptorBuffer::BeginFrame(std::uint32_t frameIndex) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+        DVRE_ASSERT(frameIndex < g_Settings.FramesInFlight, "vre::Vulkan::DescriptorBuffer has {} frames, frame {} is out of range", g_Settings.FramesInFlight, frameIndex);
+
+        std::scoped_lock lock{g_Mutex};
+        g_Frame++;
+
+        for (Heap &heap : g_Heaps) {
+            heap.FrameBase = heap.PersistentSize + heap.FrameSize * frameIndex;
+            heap.FrameOffset.store(0u, std::memory_order_relaxed);
+
+            while (!heap.Pending.empty() && heap.Pending.front().Frame + g_Settings.FramesInFlight <= g_Frame) {
+                heap.Persistent.free(heap.Pending.front().Allocation);
+                heap.Pending.pop_front();
+            }
+        }
+    }
+
+    void DescriptorBuffer::EndFrame() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        for (const Heap &heap : g_Heaps) DVRE_VK_CHECK(vmaFlushAllocation(heap.Storage.Allocator, heap.Storage.Allocation, 0u, VK_WHOLE_SIZE));
+    }
+
+    DescriptorBuffer::Set DescriptorBuffer::Allocate(const vk::DescriptorSetLayout &layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        const LayoutInfo info = GetLayoutInfo(layout);
+        Heap            &heap = g_Heaps[info.BufferIndex];
+
+        std::scoped_lock            lock{g_Mutex};
+        OffsetAllocator::Allocation allocation = heap.Persistent.allocate(std::uint32_t(info.Size));
+        VRE_ASSERT(allocation.isValid(), "vre::Vulkan::DescriptorBuffer ran out of its {} persistent bytes", heap.PersistentSize);
+
+        return Set{
+            .Layout      = layout,
+            .BufferIndex = info.BufferIndex,
+            .Offset      = allocation.Offset,
+            .Data        = heap.Data + allocation.Offset,
+            .Allocation  = allocation,
+        };
+    }
+
+    DescriptorBuffer::Set DescriptorBuffer::AllocateFrame(const vk::DescriptorSetLayout &layout) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        const LayoutInfo info = GetLayoutInfo(layout);
+        Heap            &heap = g_Heaps[info.BufferIndex];
+
+        const std::uint64_t offset = heap.FrameOffset.fetch_add(info.Size, std::memory_order_relaxed);
+        VRE_ASSERT(offset + info.Size <= heap.FrameSize, "vre::Vulkan::DescriptorBuffer ran out of its {} bytes for this frame", heap.FrameSize);
+
+        return Set{
+            .Layout      = layout,
+            .BufferIndex = info.BufferIndex,
+            .Offset      = heap.FrameBase + offset,
+            .Data        = heap.Data + heap.FrameBase + offset,
+        };
+    }
+
+    void DescriptorBuffer::Free(const Set &set) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+        DVRE_ASSERT(set.Allocation.isValid(), "Only sets from vre::Vulkan::DescriptorBuffer::Allocate can be freed");
+
+        std::scoped_lock lock{g_Mutex};
+        g_Heaps[set.BufferIndex].Pending.push_back(Retired{
+            .Allocation = set.Allocation,
+            .Frame      = g_Frame,
+        });
+    }
+
+    void DescriptorBuffer::WriteUniformBuffer(const Set &set, std::uint32_t binding, const Buffer::Allocation &buffer) {
+        WriteUniformBuffer(set, binding, Buffer::GetAddress(buffer), buffer.Size);
+    }
+
+    void DescriptorBuffer::WriteStorageBuffer(const Set &set, std::uint32_t binding, const Buffer::Allocation &buffer) {
+        WriteStorageBuffer(set, binding, Buffer::GetAddress(buffer), buffer.Size);
+    }
+
+    void DescriptorBuffer::WriteUniformBuffer(
+        const Set        &set,
+        std::uint32_t     binding,
+        vk::DeviceAddress address,
+        std::uint64_t     size) {
+        vk::DescriptorAddressInfoEXT addressInfo{address, size};
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eUniformBuffer, vk::DescriptorDataEXT{}.setPUniformBuffer(&addressInfo)},
+            g_Properties.uniformBufferDescriptorSize);
+    }
+
+    void DescriptorBuffer::WriteStorageBuffer(
+        const Set        &set,
+        std::uint32_t     binding,
+        vk::DeviceAddress address,
+        std::uint64_t     size) {
+        vk::DescriptorAddressInfoEXT addressInfo{address, size};
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eStorageBuffer, vk::DescriptorDataEXT{}.setPStorageBuffer(&addressInfo)},
+            g_Properties.storageBufferDescriptorSize);
+    }
+
+    void DescriptorBuffer::WriteSampledImage(
+        const Set           &set,
+        std::uint32_t        binding,
+        const vk::ImageView &view,
+        vk::ImageLayout      layout) {
+        vk::DescriptorImageInfo imageInfo{{}, view, layout};
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eSampledImage, vk::DescriptorDataEXT{}.setPSampledImage(&imageInfo)},
+            g_Properties.sampledImageDescriptorSize);
+    }
+
+    void DescriptorBuffer::WriteStorageImage(
+        const Set           &set,
+        std::uint32_t        binding,
+        const vk::ImageView &view,
+        vk::ImageLayout      layout) {
+        vk::DescriptorImageInfo imageInfo{{}, view, layout};
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eStorageImage, vk::DescriptorDataEXT{}.setPStorageImage(&imageInfo)},
+            g_Properties.storageImageDescriptorSize);
+    }
+
+    void DescriptorBuffer::WriteSampler(
+        const Set         &set,
+        std::uint32_t      binding,
+        const vk::Sampler &sampler) {
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eSampler, vk::DescriptorDataEXT{}.setPSampler(&sampler)},
+            g_Properties.samplerDescriptorSize);
+    }
+
+    void DescriptorBuffer::WriteCombinedImageSampler(
+        const Set           &set,
+        std::uint32_t        binding,
+        const vk::ImageView &view,
+        vk::ImageLayout      layout,
+        const vk::Sampler   &sampler) {
+        vk::DescriptorImageInfo imageInfo{sampler, view, layout};
+        Write(
+            set,
+            binding,
+            vk::DescriptorGetInfoEXT{vk::DescriptorType::eCombinedImageSampler, vk::DescriptorDataEXT{}.setPCombinedImageSampler(&imageInfo)},
+            g_Properties.combinedImageSamplerDescriptorSize);
+    }
+
+    void DescriptorBuffer::Bind(const vk::CommandBuffer &commandBuffer) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        std::array<vk::DescriptorBufferBindingInfoEXT, 2> bindingInfos{};
+        for (std::uint32_t i = 0u; i < g_Heaps.size(); i++)
+            bindingInfos[i] = vk::DescriptorBufferBindingInfoEXT{g_Heaps[i].Storage.Address, g_Heaps[i].Storage.UsageFlags};
+
+        g_CmdBindDescriptorBuffers(
+            commandBuffer,
+            std::uint32_t(bindingInfos.size()),
+            reinterpret_cast<const VkDescriptorBufferBindingInfoEXT *>(bindingInfos.data()));
+    }
+
+    void DescriptorBuffer::BindSet(
+        const vk::CommandBuffer  &commandBuffer,
+        vk::PipelineBindPoint     bindPoint,
+        const vk::PipelineLayout &layout,
+        std::uint32_t             setIndex,
+        const Set                &set) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be initialized");
+
+        g_CmdSetDescriptorBufferOffsets(
+            commandBuffer,
+            VkPipelineBindPoint(bindPoint),
+            layout,
+            setIndex,
+            1u,
+            &set.BufferIndex,
+            &set.Offset);
+    }
+
+    vk::DescriptorSetLayout DescriptorBuffer::RegisterLayout(const DescriptorLayout::Builder &builder, const vk::DescriptorSetLayout &layout) {
+        const bool usesSamplers = std::ranges::any_of(builder.getBindings(), [](const vk::DescriptorSetLayoutBinding &binding) {
+            return binding.descriptorType == vk::DescriptorType::eSampler ||
+                   binding.descriptorType == vk::DescriptorType::eCombinedImageSampler;
+        });
+
+        VkDeviceSize size = 0u;
+        g_GetDescriptorSetLayoutSize(g_Device, layout, &size);
+
+        std::scoped_lock lock{g_Mutex};
+        g_Layouts[layout] = LayoutInfo{
+            .Size        = AlignUp(std::max<std::uint64_t>(size, 1u), std::max<std::uint64_t>(g_Properties.descriptorBufferOffsetAlignment, 1u)),
+            .BufferIndex = usesSamplers ? SAMPLER_BUFFER_INDEX : RESOURCE_BUFFER_INDEX,
+        };
+        return layout;
+    }
+
+    DescriptorBuffer::LayoutInfo DescriptorBuffer::GetLayoutInfo(const vk::DescriptorSetLayout &layout) {
+        std::scoped_lock lock{g_Mutex};
+
+        auto it = g_Layouts.find(layout);
+        DVRE_ASSERT(it != g_Layouts.end(), "Layout was not created by vre::Vulkan::DescriptorBuffer::CreateLayout");
+        return it->second;
+    }
+
+    void DescriptorBuffer::Write(const Set &set, std::uint32_t binding, const vk::DescriptorGetInfoEXT &info, std::size_t size) {
+        DVRE_ASSERT(set.Data != nullptr, "vre::Vulkan::DescriptorBuffer::Set was not allocated");
+
+        VkDeviceSize offset = 0u;
+        g_GetDescriptorSetLayoutBindingOffset(g_Device, set.Layout, binding, &offset);
+        g_GetDescriptor(g_Device, reinterpret_cast<const VkDescriptorGetInfoEXT *>(&info), size, set.Data + offset);
+    }
+
+    DescriptorBuffer::~DescriptorBuffer() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::DescriptorBuffer must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
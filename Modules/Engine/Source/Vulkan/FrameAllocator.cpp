@@ -0,0 +1,134 @@
+#include <VREngine/Vulkan/FrameAllocator.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        constexpr std::uint64_t VERTEX_ALIGNMENT = 16u;
+
+        std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) {
+            return (value + alignment - 1u) / alignment * alignment;
+        }
+    }  // namespace
+
+    FrameAllocator::Settings   FrameAllocator::g_Settings{};
+    Buffer::Allocation         FrameAllocator::g_Buffer{};
+    std::byte                 *FrameAllocator::g_Data{nullptr};
+    std::uint64_t              FrameAllocator::g_FrameStride{0u};
+    std::uint64_t              FrameAllocator::g_FrameBase{0u};
+    std::uint64_t              FrameAllocator::g_UniformAlignment{0u};
+    std::uint64_t              FrameAllocator::g_StorageAlignment{0u};
+    std::atomic<std::uint64_t> FrameAllocator::g_Offset{0u};
+    bool                       FrameAllocator::g_IsInitialized{false};
+    FrameAllocator             FrameAllocator::g_State{};
+
+    void FrameAllocator::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::FrameAllocator must be shut down before initializing");
+        DVRE_ASSERT(settings.FrameSize != 0u && settings.FramesInFlight != 0u, "vre::Vulkan::FrameAllocator needs at least one non-empty frame");
+        DLOG_INFO("Initializing vre::Vulkan::FrameAllocator with {} frames of {} bytes", settings.FramesInFlight, settings.FrameSize);
+
+        const vk::PhysicalDeviceLimits limits = Context::GetPhysicalDevice().getProperties().limits;
+
+        g_Settings         = settings;
+        g_UniformAlignment = std::max<std::uint64_t>(limits.minUniformBufferOffsetAlignment, 1u);
+        g_StorageAlignment = std::max<std::uint64_t>(limits.minStorageBufferOffsetAlignment, 1u);
+        g_FrameStride      = AlignUp(
+            g_Settings.FrameSize,
+            std::max({g_UniformAlignment, g_StorageAlignment, VERTEX_ALIGNMENT, std::uint64_t(limits.nonCoherentAtomSize)}));
+
+        g_Buffer = Buffer::AllocateMapped(
+            VMA_MEMORY_USAGE_CPU_TO_GPU,
+            g_FrameStride * g_Settings.FramesInFlight,
+            g_Settings.UsageFlags,
+            Context::GetVmaAllocator());
+
+        VmaAllocationInfo allocationInfo{};
+        vmaGetAllocationInfo(g_Buffer.Allocator, g_Buffer.Allocation, &allocationInfo);
+        g_Data = (std::byte *)allocationInfo.pMappedData;
+
+        g_FrameBase     = 0u;
+        g_Offset        = 0u;
+        g_IsInitialized = true;
+    }
+
+    void FrameAllocator::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void FrameAllocator::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::FrameAllocator down");
+
+        Buffer::Release(g_Buffer);
+
+        g_Buffer        = Buffer::Allocation{};
+        g_Data          = nullptr;
+        g_IsInitialized = false;
+    }
+
+    bool FrameAllocator::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    void FrameAllocator::BeginFrame(std::uint32_t frameIndex) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized");
+        DVRE_ASSERT(frameIndex < g_Settings.FramesInFlight, "vre::Vulkan::FrameAllocator has {} frames, frame {} is out of range", g_Settings.FramesInFlight, frameIndex);
+
+        g_FrameBase = g_FrameStride * frameIndex;
+        g_Offset.store(0u, std::memory_order_relaxed);
+    }
+
+    void FrameAllocator::EndFrame() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized");
+
+        const std::uint64_t usage = GetFrameUsage();
+        if (usage != 0u) DVRE_VK_CHECK(vmaFlushAllocation(g_Buffer.Allocator, g_Buffer.Allocation, g_FrameBase, usage));
+    }
+
+    FrameAllocator::Allocation FrameAllocator::Allocate(std::uint64_t size, std::uint64_t alignment) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized");
+        DVRE_ASSERT(alignment != 0u, "vre::Vulkan::FrameAllocator cannot align to 0 bytes");
+
+        std::uint64_t offset = g_Offset.load(std::memory_order_relaxed);
+        std::uint64_t aligned{};
+        do {
+            aligned = AlignUp(g_FrameBase + offset, alignment) - g_FrameBase;
+            VRE_ASSERT(aligned + size <= g_Settings.FrameSize, "vre::Vulkan::FrameAllocator ran out of its {} bytes for this frame", g_Settings.FrameSize);
+        } while (!g_Offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed));
+
+        return Allocation{
+            .Buffer  = g_Buffer.Buffer,
+            .Offset  = g_FrameBase + aligned,
+            .Size    = size,
+            .Data    = g_Data + g_FrameBase + aligned,
+            .Address = g_Buffer.Address != 0u ? g_Buffer.Address + g_FrameBase + aligned : 0u,
+        };
+    }
+
+    FrameAllocator::Allocation FrameAllocator::AllocateUniform(std::uint64_t size) {
+        return Allocate(size, g_UniformAlignment);
+    }
+
+    FrameAllocator::Allocation FrameAllocator::AllocateStorage(std::uint64_t size) {
+        return Allocate(size, g_StorageAlignment);
+    }
+
+    FrameAllocator::Allocation FrameAllocator::AllocateVertex(std::uint64_t size) {
+        return Allocate(size, VERTEX_ALIGNMENT);
+    }
+
+    vk::Buffer FrameAllocator::GetBuffer() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized");
+        return g_Buffer.Buffer;
+    }
+
+    std::uint64_t FrameAllocator::GetFrameUsage() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::FrameAllocator must be initialized");
+        return g_Offset.load(std::memory_order_relaxed);
+    }
+
+    FrameAllocator::~FrameAllocator() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::FrameAllocator must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
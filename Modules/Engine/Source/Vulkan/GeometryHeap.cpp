@@ -0,0 +1,301 @@
+#include <VREngine/Vulkan/GeometryHeap.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Vulkan/VertexFormat.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        constexpr vk::BufferUsageFlags GEOMETRY_USAGE_FLAGS =
+            vk::BufferUsageFlagBits::eTransferDst |
+            vk::BufferUsageFlagBits::eTransferSrc |
+            vk::BufferUsageFlagBits::eStorageBuffer |
+            vk::BufferUsageFlagBits::eShaderDeviceAddress;
+    }  // namespace
+
+    GeometryHeap GeometryHeap::Create(const Settings &settings) {
+        DVRE_ASSERT(UploadContext::IsInitialized(), "vre::Vulkan::UploadContext must be initialized");
+        DVRE_ASSERT(settings.VertexStride != 0u, "vre::Vulkan::GeometryHeap needs a vertex stride");
+        DVRE_ASSERT(settings.VertexCapacity != 0u && settings.IndexCapacity != 0u, "vre::Vulkan::GeometryHeap needs non-empty buffers");
+
+        GeometryHeap heap{};
+        heap.m_Settings  = settings;
+        heap.m_IndexSize      = IndexFormat::GetSize(settings.IndexType);
+        heap.m_IsDefragmented = Defragmenter::IsInitialized();
+
+        heap.m_VertexBuffer = heap.allocateBuffer(
+            std::uint64_t(settings.VertexCapacity) * settings.VertexStride,
+            GEOMETRY_USAGE_FLAGS | vk::BufferUsageFlagBits::eVertexBuffer);
+        heap.m_IndexBuffer = heap.allocateBuffer(
+            std::uint64_t(settings.IndexCapacity) * heap.m_IndexSize,
+            GEOMETRY_USAGE_FLAGS | vk::BufferUsageFlagBits::eIndexBuffer);
+
+        // Every mesh holds one region and splits off at most one free region.
+        heap.m_VertexAllocator = OffsetAllocator(settings.VertexCapacity, settings.MaxMeshes * 2u + 1u);
+        heap.m_IndexAllocator  = OffsetAllocator(settings.IndexCapacity, settings.MaxMeshes * 2u + 1u);
+
+        heap.m_Entries.reserve(settings.MaxMeshes);
+        return heap;
+    }
+
+    GeometryHeap::MeshId GeometryHeap::allocate(std::uint32_t vertexCount, std::uint32_t indexCount) {
+        DVRE_ASSERT(vertexCount != 0u && indexCount != 0u, "vre::Vulkan::GeometryHeap cannot allocate an empty mesh");
+
+        if (m_MeshCount + m_PendingFrees.size() >= m_Settings.MaxMeshes) {
+            DVRE_WARN("vre::Vulkan::GeometryHeap is full with {} meshes", m_MeshCount);
+            return INVALID_MESH;
+        }
+
+        OffsetAllocator::Allocation vertexAllocation = m_VertexAllocator.allocate(vertexCount);
+        if (!vertexAllocation.isValid()) {
+            DVRE_WARN("vre::Vulkan::GeometryHeap has no room for {} vertices", vertexCount);
+            return INVALID_MESH;
+        }
+
+        OffsetAllocator::Allocation indexAllocation = m_IndexAllocator.allocate(indexCount);
+        if (!indexAllocation.isValid()) {
+            DVRE_WARN("vre::Vulkan::GeometryHeap has no room for {} indices", indexCount);
+            m_VertexAllocator.free(vertexAllocation);
+            return INVALID_MESH;
+        }
+
+        MeshId id = std::uint32_t(m_Entries.size());
+        if (!m_FreeIds.empty()) {
+            id = m_FreeIds.back();
+            m_FreeIds.pop_back();
+        } else {
+            m_Entries.emplace_back();
+        }
+
+        m_Entries[id] = Entry{
+            .Range = Mesh{
+                .VertexOffset = std::int32_t(vertexAllocation.Offset),
+                .VertexCount  = vertexCount,
+                .FirstIndex   = indexAllocation.Offset,
+                .IndexCount   = indexCount,
+            },
+            .VertexAllocation = vertexAllocation,
+            .IndexAllocation  = indexAllocation,
+            .IsAlive          = true,
+        };
+        m_MeshCount++;
+        return id;
+    }
+
+    UploadContext::Ticket GeometryHeap::upload(MeshId mesh, const void *vertices, const void *indices) {
+        const Mesh &range = getMesh(mesh);
+
+        UploadContext::Ticket ticket = UploadContext::INVALID_TICKET;
+        if (vertices != nullptr) {
+            ticket = UploadContext::UploadBuffer(
+                m_VertexBuffer,
+                std::uint64_t(range.VertexOffset) * m_Settings.VertexStride,
+                vertices,
+                std::uint64_t(range.VertexCount) * m_Settings.VertexStride);
+            if (m_IsDefragmented) Defragmenter::SetUploadTicket(m_VertexBuffer, ticket);
+        }
+        if (indices != nullptr) {
+            ticket = UploadContext::UploadBuffer(
+                m_IndexBuffer,
+                std::uint64_t(range.FirstIndex) * m_IndexSize,
+                indices,
+                std::uint64_t(range.IndexCount) * m_IndexSize);
+            if (m_IsDefragmented) Defragmenter::SetUploadTicket(m_IndexBuffer, ticket);
+        }
+
+        m_LastUploadTicket = std::max(m_LastUploadTicket, ticket);
+        return ticket;
+    }
+
+    void GeometryHeap::free(MeshId mesh) {
+        DVRE_ASSERT(mesh < m_Entries.size() && m_Entries[mesh].IsAlive, "vre::Vulkan::GeometryHeap has no mesh {}", mesh);
+
+        Entry &entry  = m_Entries[mesh];
+        entry.IsAlive = false;
+        m_MeshCount--;
+
+        m_PendingFrees.push_back(PendingFree{
+            .VertexAllocation = entry.VertexAllocation,
+            .IndexAllocation  = entry.IndexAllocation,
+            .Id               = mesh,
+            .Frame            = m_Frame + m_Settings.FramesInFlight,
+        });
+    }
+
+    void GeometryHeap::update() {
+        m_Frame++;
+
+        while (!m_PendingFrees.empty() && m_PendingFrees.front().Frame <= m_Frame) {
+            const PendingFree &pending = m_PendingFrees.front();
+            m_VertexAllocator.free(pending.VertexAllocation);
+            m_IndexAllocator.free(pending.IndexAllocation);
+            m_FreeIds.push_back(pending.Id);
+            m_PendingFrees.pop_front();
+        }
+
+        while (!m_PendingReleases.empty() && m_PendingReleases.front().Frame <= m_Frame) {
+            releaseBuffer(m_PendingReleases.front().Target);
+            m_PendingReleases.pop_front();
+        }
+    }
+
+    const GeometryHeap::Mesh &GeometryHeap::getMesh(MeshId mesh) const {
+        DVRE_ASSERT(mesh < m_Entries.size() && m_Entries[mesh].IsAlive, "vre::Vulkan::GeometryHeap has no mesh {}", mesh);
+        return m_Entries[mesh].Range;
+    }
+
+    GeometryHeap::Statistics GeometryHeap::getStatistics() const {
+        const OffsetAllocator::StorageReport vertexReport = m_VertexAllocator.getStorageReport();
+        const OffsetAllocator::StorageReport indexReport  = m_IndexAllocator.getStorageReport();
+
+        // The share of free space that sits outside the largest free region, for whichever buffer is worse off.
+        auto fragmentation = [](const OffsetAllocator::StorageReport &report) {
+            if (report.TotalFreeSpace == 0u) return 0.0f;
+            return 1.0f - float(report.LargestFreeRegion) / float(report.TotalFreeSpace);
+        };
+
+        return Statistics{
+            .VertexCapacity          = m_Settings.VertexCapacity,
+            .VertexUsed              = m_Settings.VertexCapacity - vertexReport.TotalFreeSpace,
+            .VertexLargestFreeRegion = vertexReport.LargestFreeRegion,
+            .IndexCapacity           = m_Settings.IndexCapacity,
+            .IndexUsed               = m_Settings.IndexCapacity - indexReport.TotalFreeSpace,
+            .IndexLargestFreeRegion  = indexReport.LargestFreeRegion,
+            .MeshCount               = m_MeshCount,
+            .Fragmentation           = std::max(fragmentation(vertexReport), fragmentation(indexReport)),
+        };
+    }
+
+    void GeometryHeap::bind(const vk::CommandBuffer &commandBuffer) const {
+        commandBuffer.bindVertexBuffers(0u, {m_VertexBuffer.Buffer}, {0u});
+        commandBuffer.bindIndexBuffer(m_IndexBuffer.Buffer, 0u, m_Settings.IndexType);
+    }
+
+    void GeometryHeap::draw(const vk::CommandBuffer &commandBuffer, MeshId mesh, std::uint32_t instanceCount, std::uint32_t firstInstance) const {
+        const Mesh &range = getMesh(mesh);
+        commandBuffer.drawIndexed(range.IndexCount, instanceCount, range.FirstIndex, range.VertexOffset, firstInstance);
+    }
+
+    bool GeometryHeap::compact(const vk::CommandBuffer &commandBuffer) {
+        // Pending uploads still target the current buffers.
+        if (!UploadContext::IsComplete(m_LastUploadTicket)) return false;
+
+        std::vector<MeshId> live{};
+        live.reserve(m_MeshCount);
+        for (MeshId id = 0u; id < m_Entries.size(); id++)
+            if (m_Entries[id].IsAlive) live.push_back(id);
+        std::sort(live.begin(), live.end(), [this](MeshId a, MeshId b) {
+            return m_Entries[a].VertexAllocation.Offset < m_Entries[b].VertexAllocation.Offset;
+        });
+
+        Buffer::Allocation vertexBuffer = allocateBuffer(m_VertexBuffer.Size, m_VertexBuffer.UsageFlags);
+        Buffer::Allocation indexBuffer  = allocateBuffer(m_IndexBuffer.Size, m_IndexBuffer.UsageFlags);
+
+        m_VertexAllocator.reset();
+        m_IndexAllocator.reset();
+
+        std::vector<vk::BufferCopy> vertexCopies{};
+        std::vector<vk::BufferCopy> indexCopies{};
+        vertexCopies.reserve(live.size());
+        indexCopies.reserve(live.size());
+
+        for (MeshId id : live) {
+            Entry &entry = m_Entries[id];
+
+            const OffsetAllocator::Allocation vertexAllocation = m_VertexAllocator.allocate(entry.Range.VertexCount);
+            const OffsetAllocator::Allocation indexAllocation  = m_IndexAllocator.allocate(entry.Range.IndexCount);
+
+            vertexCopies.push_back(vk::BufferCopy{
+                std::uint64_t(entry.Range.VertexOffset) * m_Settings.VertexStride,
+                std::uint64_t(vertexAllocation.Offset) * m_Settings.VertexStride,
+                std::uint64_t(entry.Range.VertexCount) * m_Settings.VertexStride,
+            });
+            indexCopies.push_back(vk::BufferCopy{
+                std::uint64_t(entry.Range.FirstIndex) * m_IndexSize,
+                std::uint64_t(indexAllocation.Offset) * m_IndexSize,
+                std::uint64_t(entry.Range.IndexCount) * m_IndexSize,
+            });
+
+            entry.VertexAllocation   = vertexAllocation;
+            entry.IndexAllocation    = indexAllocation;
+            entry.Range.VertexOffset = std::int32_t(vertexAllocation.Offset);
+            entry.Range.FirstIndex   = indexAllocation.Offset;
+        }
+
+        if (!vertexCopies.empty()) {
+            commandBuffer.copyBuffer(m_VertexBuffer.Buffer, vertexBuffer.Buffer, vertexCopies);
+            commandBuffer.copyBuffer(m_IndexBuffer.Buffer, indexBuffer.Buffer, indexCopies);
+
+            const vk::MemoryBarrier2 barrier{
+                vk::PipelineStageFlagBits2::eTransfer,
+                vk::AccessFlagBits2::eTransferWrite,
+                vk::PipelineStageFlagBits2::eAllCommands,
+                vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite,
+            };
+            commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {barrier}, {}, {}}});
+        }
+
+        // Freed meshes were not carried over, only their ids still have to wait for the frames that draw them.
+        for (PendingFree &pending : m_PendingFrees) {
+            pending.VertexAllocation = OffsetAllocator::Allocation{};
+            pending.IndexAllocation  = OffsetAllocator::Allocation{};
+        }
+
+        m_PendingReleases.push_back(PendingRelease{m_VertexBuffer, m_Frame + m_Settings.FramesInFlight});
+        m_PendingReleases.push_back(PendingRelease{m_IndexBuffer, m_Frame + m_Settings.FramesInFlight});
+        m_VertexBuffer = vertexBuffer;
+        m_IndexBuffer  = indexBuffer;
+
+        if (m_RelocationCallback)
+            for (MeshId id : live) m_RelocationCallback(id, m_Entries[id].Range);
+
+        DLOG_INFO("Compacted vre::Vulkan::GeometryHeap with {} meshes", live.size());
+        return true;
+    }
+
+    void GeometryHeap::setRelocationCallback(const RelocationCallback &callback) {
+        m_RelocationCallback = callback;
+    }
+
+    void GeometryHeap::onBufferMoved(const BufferMovedEvent &event) {
+        // Only the handle and address change, the offsets of every mesh stay the same.
+        if (m_VertexBuffer.Allocation == event.Old.Allocation) m_VertexBuffer = event.New;
+        if (m_IndexBuffer.Allocation == event.Old.Allocation) m_IndexBuffer = event.New;
+        for (PendingRelease &pending : m_PendingReleases)
+            if (pending.Target.Allocation == event.Old.Allocation) pending.Target = event.New;
+    }
+
+    const Buffer::Allocation &GeometryHeap::getVertexBuffer() const {
+        return m_VertexBuffer;
+    }
+
+    const Buffer::Allocation &GeometryHeap::getIndexBuffer() const {
+        return m_IndexBuffer;
+    }
+
+    void GeometryHeap::release() {
+        for (const PendingRelease &pending : m_PendingReleases) releaseBuffer(pending.Target);
+        releaseBuffer(m_VertexBuffer);
+        releaseBuffer(m_IndexBuffer);
+
+        m_VertexBuffer = Buffer::Allocation{};
+        m_IndexBuffer  = Buffer::Allocation{};
+        m_Entries.clear();
+        m_FreeIds.clear();
+        m_PendingFrees.clear();
+        m_PendingReleases.clear();
+        m_MeshCount = 0u;
+    }
+
+    Buffer::Allocation GeometryHeap::allocateBuffer(std::uint64_t size, vk::BufferUsageFlags usageFlags) const {
+        Buffer::Allocation buffer = Buffer::Allocate(VMA_MEMORY_USAGE_GPU_ONLY, size, usageFlags, Context::GetVmaAllocator());
+        if (m_IsDefragmented) Defragmenter::Register(buffer);
+        return buffer;
+    }
+
+    void GeometryHeap::releaseBuffer(const Buffer::Allocation &buffer) const {
+        if (m_IsDefragmented)
+            Defragmenter::Release(buffer);
+        else
+            Buffer::Release(buffer);
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
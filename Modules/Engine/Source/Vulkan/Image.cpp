@@ -1,4 +1,5 @@
 #include <VREngine/Vulkan/Image.hpp>
+#include <VREngine/Vulkan/ObjectCache.hpp>
 
 namespace vre::Vulkan::Image {
     void TransitionLayout(
@@ -49,6 +50,25 @@ namespace vre::Vulkan::Image {
         commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, {}, {imageBarrier}}});
     }
 
+    void TransitionLayout(
+        const vk::CommandBuffer         &commandBuffer,
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout) {
+        vk::ImageMemoryBarrier2 imageBarrier{
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite,
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite | vk::AccessFlagBits2::eMemoryRead,
+            oldLayout,
+            newLayout,
+        };
+        imageBarrier.setImage(image.Image);
+        imageBarrier.setSubresourceRange(range);
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, {}, {imageBarrier}}});
+    }
+
     void TransitionLayout(const vk::CommandBuffer &commandBuffer, const vk::Image &image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout) {
         vk::ImageMemoryBarrier2 imageBarrier{
             vk::PipelineStageFlagBits2::eAllCommands,
@@ -93,7 +113,41 @@ namespace vre::Vulkan::Image {
         commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, {}, {imageBarrier}}});
     }
 
+    vk::ImageMemoryBarrier2 GetOwnershipBarrier(
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout,
+        std::uint32_t                    sourceQueueFamilyIndex,
+        std::uint32_t                    destinationQueueFamilyIndex) {
+        return vk::ImageMemoryBarrier2{
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite,
+            vk::PipelineStageFlagBits2::eAllCommands,
+            vk::AccessFlagBits2::eMemoryWrite | vk::AccessFlagBits2::eMemoryRead,
+            oldLayout,
+            newLayout,
+            sourceQueueFamilyIndex,
+            destinationQueueFamilyIndex,
+            image.Image,
+            range,
+        };
+    }
+
+    void TransferOwnership(
+        const vk::CommandBuffer         &commandBuffer,
+        const Allocation                &image,
+        const vk::ImageSubresourceRange &range,
+        vk::ImageLayout                  oldLayout,
+        vk::ImageLayout                  newLayout,
+        std::uint32_t                    sourceQueueFamilyIndex,
+        std::uint32_t                    destinationQueueFamilyIndex) {
+        vk::ImageMemoryBarrier2 imageBarrier = GetOwnershipBarrier(image, range, oldLayout, newLayout, sourceQueueFamilyIndex, destinationQueueFamilyIndex);
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, {}, {imageBarrier}}});
+    }
+
     void Release(const Allocation &image) {
+        if (ObjectCache::IsInitialized()) ObjectCache::Invalidate(image.Image);
         vmaDestroyImage(image.Allocator, image.Image, image.Allocation);
     }
 
@@ -127,6 +181,16 @@ namespace vre::Vulkan::Image {
         };
     }
 
+    vk::ImageSubresourceRange GetColorMipRange(std::uint32_t baseMipLevel, std::uint32_t mipLevelCount) {
+        return vk::ImageSubresourceRange{
+            vk::ImageAspectFlagBits::eColor,
+            baseMipLevel,
+            mipLevelCount,
+            0u,
+            vk::RemainingArrayLayers,
+        };
+    }
+
     vk::ImageCreateInfo GetCreateInfo(
         vk::Format          format,
         vk::ImageUsageFlags usageFlags,
@@ -407,6 +471,19 @@ namespace vre::Vulkan::Image {
         };
     }
 
+    Allocation Allocate(
+        VmaAllocationCreateFlags vmaFlags,
+        vk::MemoryPropertyFlags  memoryFlags,
+        vk::Format               format,
+        vk::ImageUsageFlags      usageFlags,
+        const vk::Extent2D      &extent,
+        std::uint32_t            mipLevels,
+        const VmaAllocator      &allocator) {
+        std::optional<Allocation> image = TryAllocate(vmaFlags, memoryFlags, format, usageFlags, extent, mipLevels, allocator);
+        VRE_ASSERT(image.has_value(), "Failed to allocate a {}x{} vk::Image with {} mip levels", extent.width, extent.height, mipLevels);
+        return *image;
+    }
+
     Allocation Allocate(
         vk::MemoryPropertyFlags memoryFlags,
         vk::Format              format,
@@ -486,6 +563,53 @@ namespace vre::Vulkan::Image {
         };
     }
 
+    std::optional<Allocation> TryAllocate(
+        VmaAllocationCreateFlags vmaFlags,
+        vk::MemoryPropertyFlags  memoryFlags,
+        vk::Format               format,
+        vk::ImageUsageFlags      usageFlags,
+        const vk::Extent2D      &extent,
+        std::uint32_t            mipLevels,
+        const VmaAllocator      &allocator) {
+        vk::ImageCreateInfo imageInfo{
+            {},
+            vk::ImageType::e2D,
+            format,
+            vk::Extent3D{extent, 1u},
+            mipLevels,
+            1u,
+            vk::SampleCountFlagBits::e1,
+            vk::ImageTiling::eOptimal,
+            usageFlags,
+        };
+        VmaAllocationCreateInfo allocationInfo{
+            .flags         = vmaFlags,
+            .usage         = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
+            .requiredFlags = VkMemoryPropertyFlags(memoryFlags),
+        };
+
+        VkImage       cImage{VK_NULL_HANDLE};
+        VmaAllocation allocation{VK_NULL_HANDLE};
+
+        VkResult result = vmaCreateImage(
+            allocator,
+            &(const VkImageCreateInfo &)imageInfo,
+            &allocationInfo,
+            &cImage,
+            &allocation,
+            nullptr);
+        if (result != VK_SUCCESS) return std::nullopt;
+
+        return Allocation{
+            .Image      = cImage,
+            .Extent     = vk::Extent3D{extent, 1u},
+            .Format     = format,
+            .MipLevels  = mipLevels,
+            .Allocation = allocation,
+            .Allocator  = allocator,
+        };
+    }
+
     vk::ImageView CreateView(const Allocation &image, vk::ImageAspectFlags aspectFlags, const vk::Device &device) {
         vk::ImageViewCreateInfo viewInfo{
             {},
@@ -534,6 +658,30 @@ namespace vre::Vulkan::Image {
         return view;
     }
 
+    vk::ImageView CreateColorView(const Allocation &image, std::uint32_t baseMipLevel, const vk::Device &device) {
+        vk::ImageViewCreateInfo viewInfo{
+            {},
+            image.Image,
+            image.Extent.depth == 1
+                ? vk::ImageViewType::e2D
+                : vk::ImageViewType::e3D,
+            image.Format,
+            vk::ComponentMapping{},
+            vk::ImageSubresourceRange{
+                vk::ImageAspectFlagBits::eColor,
+                baseMipLevel,
+                vk::RemainingMipLevels,
+                0u,
+                vk::RemainingArrayLayers,
+            },
+        };
+
+        auto [result, view] = device.createImageView(viewInfo);
+        DVRE_VK_CHECK(result);
+
+        return view;
+    }
+
     vk::ImageView CreateDepthView(const Allocation &image, const vk::Device &device) {
         vk::ImageViewCreateInfo viewInfo{
             {},
@@ -0,0 +1,250 @@
+#include <VREngine/Vulkan/MeshletRenderer.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Command.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Vulkan/Pipeline.hpp>
+#include <VREngine/Vulkan/Shader.hpp>
+#include <VREngine/Assets/FileAsset.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        // Meshlet.slang launches one task group per 32 meshlets, MeshletCull.slang one compute group per 64.
+        constexpr std::uint32_t TASK_GROUP_SIZE = 32u;
+        constexpr std::uint32_t CULL_GROUP_SIZE = 64u;
+
+        // The shaders read MeshletVertex, which pads every vec3 to 16 bytes like the aligned glm types do.
+        static_assert(sizeof(MeshAsset::Vertex) == 64u, "vre::MeshAsset::Vertex no longer matches MeshletVertex");
+        static_assert(sizeof(MeshAsset::Meshlet) == 64u, "vre::MeshAsset::Meshlet no longer matches Meshlet");
+    }  // namespace
+
+    MeshletRenderer MeshletRenderer::Create(const Settings &settings, const MeshAsset &mesh) {
+        DVRE_ASSERT(UploadContext::IsInitialized(), "vre::Vulkan::UploadContext must be initialized");
+        DVRE_ASSERT(settings.ColorFormat != vk::Format::eUndefined, "vre::Vulkan::MeshletRenderer needs a color format");
+        DVRE_ASSERT(settings.FramesInFlight != 0u, "vre::Vulkan::MeshletRenderer needs at least one frame in flight");
+        VRE_ASSERT(!mesh.getMeshlets().empty(), "vre::Vulkan::MeshletRenderer needs a mesh built into meshlets: '{}'", mesh.getName());
+        static_assert(sizeof(Scene) == 176u, "vre::Vulkan::MeshletRenderer::Scene no longer matches MeshletScene");
+
+        const vk::Device device = Context::GetDevice();
+
+        MeshletRenderer renderer{};
+        renderer.m_Settings             = settings;
+        renderer.m_Path                 = IsPathSupported(Path::eMeshShader) ? Path::eMeshShader : Path::eComputeCull;
+        renderer.m_MeshletCount         = std::uint32_t(mesh.getMeshlets().size());
+        renderer.m_MaxDrawIndirectCount = std::max(Context::GetPhysicalDevice().getProperties().limits.maxDrawIndirectCount, 1u);
+
+        const std::vector<MeshAsset::Vertex>  &vertices         = mesh.getVertices();
+        const std::vector<std::uint32_t>      &indices          = mesh.getIndices();
+        const std::vector<MeshAsset::Meshlet> &meshlets         = mesh.getMeshlets();
+        const std::vector<std::uint32_t>      &meshletVertices  = mesh.getMeshletVertices();
+        const std::vector<std::uint32_t>      &meshletTriangles = mesh.getMeshletTriangles();
+
+        renderer.m_Vertices         = renderer.upload(vertices.data(), vertices.size() * sizeof(MeshAsset::Vertex), vk::BufferUsageFlagBits::eStorageBuffer);
+        renderer.m_Indices          = renderer.upload(indices.data(), indices.size() * sizeof(std::uint32_t), vk::BufferUsageFlagBits::eIndexBuffer);
+        renderer.m_Meshlets         = renderer.upload(meshlets.data(), meshlets.size() * sizeof(MeshAsset::Meshlet), vk::BufferUsageFlagBits::eStorageBuffer);
+        renderer.m_MeshletVertices  = renderer.upload(meshletVertices.data(), meshletVertices.size() * sizeof(std::uint32_t), vk::BufferUsageFlagBits::eStorageBuffer);
+        renderer.m_MeshletTriangles = renderer.upload(meshletTriangles.data(), meshletTriangles.size() * sizeof(std::uint32_t), vk::BufferUsageFlagBits::eStorageBuffer);
+        renderer.m_UploadTicket     = UploadContext::Flush();
+
+        // Bindings follow Meshlet.slangh, binding 5 holds the indirect commands only MeshletCull.slang writes.
+        vk::ShaderStageFlags stageFlags = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment | vk::ShaderStageFlagBits::eCompute;
+        if (Context::IsMeshShaderSupported()) stageFlags |= vk::ShaderStageFlagBits::eTaskEXT | vk::ShaderStageFlagBits::eMeshEXT;
+
+        renderer.m_SetLayout =
+            DescriptorLayout::Builder{}
+                .addBinding(0u, vk::DescriptorType::eUniformBuffer)
+                .addBinding(1u, vk::DescriptorType::eStorageBuffer)
+                .addBinding(2u, vk::DescriptorType::eStorageBuffer)
+                .addBinding(3u, vk::DescriptorType::eStorageBuffer)
+                .addBinding(4u, vk::DescriptorType::eStorageBuffer)
+                .addBinding(5u, vk::DescriptorType::eStorageBuffer)
+                .build(stageFlags, device);
+        renderer.m_PipelineLayout = PipelineLayout::Create({renderer.m_SetLayout}, device);
+
+        auto configure = [&settings](GraphicsPipeline::Builder &builder) -> GraphicsPipeline::Builder & {
+            builder
+                .setPolygonMode(vk::PolygonMode::eFill)
+                .setCullMode(vk::CullModeFlagBits::eBack, vk::FrontFace::eCounterClockwise)
+                .setNoMultisampling()
+                .setNoBlending()
+                .setColorAttachmentFormat(settings.ColorFormat);
+            if (settings.DepthFormat != vk::Format::eUndefined)
+                builder.setDepthFormat(settings.DepthFormat).setDepthTest(true, vk::CompareOp::eLessOrEqual);
+            else
+                builder.setNoDepthTest();
+            return builder;
+        };
+
+        FileAsset        cullSource = FileAsset::FromPathBinary(settings.ShaderDirectory / fs::path("MeshletCull.spv"));
+        vk::ShaderModule cullModule = Shader::CreateSPV(cullSource, device);
+
+        GraphicsPipeline::Builder indirectBuilder{};
+        indirectBuilder
+            .setVertexShader("vsmain", cullModule)
+            .setFragmentShader("fsmain", cullModule)
+            .setInputTopology(vk::PrimitiveTopology::eTriangleList);
+        renderer.m_IndirectPipeline = configure(indirectBuilder).build(renderer.m_PipelineLayout, device);
+        renderer.m_CullPipeline     = ComputePipeline::Create("csmain", cullModule, renderer.m_PipelineLayout, device);
+
+        device.destroy(cullModule);
+        cullSource.release();
+
+        if (Context::IsMeshShaderSupported()) {
+            FileAsset        meshSource = FileAsset::FromPathBinary(settings.ShaderDirectory / fs::path("Meshlet.spv"));
+            vk::ShaderModule meshModule = Shader::CreateSPV(meshSource, device);
+
+            GraphicsPipeline::Builder meshBuilder{};
+            meshBuilder
+                .setTaskShader("tsmain", meshModule)
+                .setMeshShader("msmain", meshModule)
+                .setFragmentShader("fsmain", meshModule);
+            renderer.m_MeshPipeline = configure(meshBuilder).build(renderer.m_PipelineLayout, device);
+
+            device.destroy(meshModule);
+            meshSource.release();
+        }
+
+        renderer.m_Descriptors.init(
+            settings.FramesInFlight,
+            {
+                DescriptorPool::PoolSizeRatio{vk::DescriptorType::eUniformBuffer, 1.0f},
+                DescriptorPool::PoolSizeRatio{vk::DescriptorType::eStorageBuffer, 5.0f},
+            },
+            device);
+
+        // Every frame in flight gets its own scene constants and indirect commands, so a frame never overwrites what an
+        // earlier one still reads. The sets are written once, cull() only updates the mapped constants.
+        renderer.m_Frames.resize(settings.FramesInFlight);
+        for (Frame &frame : renderer.m_Frames) {
+            frame.SceneBuffer = Buffer::AllocateMapped(
+                VMA_MEMORY_USAGE_CPU_TO_GPU,
+                sizeof(Scene),
+                vk::BufferUsageFlagBits::eUniformBuffer,
+                Context::GetVmaAllocator());
+            frame.DrawCommands = Buffer::Allocate(
+                VMA_MEMORY_USAGE_GPU_ONLY,
+                std::uint64_t(renderer.m_MeshletCount) * sizeof(vk::DrawIndexedIndirectCommand),
+                vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eIndirectBuffer,
+                Context::GetVmaAllocator());
+
+            VmaAllocationInfo allocationInfo{};
+            vmaGetAllocationInfo(frame.SceneBuffer.Allocator, frame.SceneBuffer.Allocation, &allocationInfo);
+            frame.SceneData = (std::byte *)allocationInfo.pMappedData;
+
+            frame.Set = renderer.m_Descriptors.allocate(renderer.m_SetLayout);
+            DescriptorSet::Binder{}
+                .addUniformBuffer(0u, frame.SceneBuffer)
+                .addStorageBuffer(1u, renderer.m_Vertices)
+                .addStorageBuffer(2u, renderer.m_Meshlets)
+                .addStorageBuffer(3u, renderer.m_MeshletVertices)
+                .addStorageBuffer(4u, renderer.m_MeshletTriangles)
+                .addStorageBuffer(5u, frame.DrawCommands)
+                .bind(frame.Set, device);
+        }
+
+        return renderer;
+    }
+
+    bool MeshletRenderer::IsPathSupported(Path path) {
+        return path == Path::eComputeCull || Context::IsMeshShaderSupported();
+    }
+
+    void MeshletRenderer::setPath(Path path) {
+        DVRE_ASSERT(IsPathSupported(path), "VK_EXT_mesh_shader is not supported by the selected GPU");
+        m_Path = path;
+    }
+
+    MeshletRenderer::Path MeshletRenderer::getPath() const {
+        return m_Path;
+    }
+
+    std::uint32_t MeshletRenderer::getMeshletCount() const {
+        return m_MeshletCount;
+    }
+
+    bool MeshletRenderer::isReady() const {
+        return !m_Frames.empty() && UploadContext::IsComplete(m_UploadTicket);
+    }
+
+    void MeshletRenderer::cull(const vk::CommandBuffer &commandBuffer, std::uint32_t frameIndex, const Camera &camera) {
+        DVRE_ASSERT(frameIndex < m_Frames.size(), "vre::Vulkan::MeshletRenderer has no frame {}", frameIndex);
+        const Frame &frame = m_Frames[frameIndex];
+
+        const Scene scene{
+            .ViewProjection = camera.ViewProjection,
+            .Model          = camera.Model,
+            .CameraPosition = glm::vec4{camera.Position, 1.0f},
+            .MeshletCount   = m_MeshletCount,
+        };
+        std::memcpy(frame.SceneData, &scene, sizeof(Scene));
+        DVRE_VK_CHECK(vmaFlushAllocation(frame.SceneBuffer.Allocator, frame.SceneBuffer.Allocation, 0u, VK_WHOLE_SIZE));
+
+        if (m_Path != Path::eComputeCull) return;
+
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, m_CullPipeline);
+        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, m_PipelineLayout, 0u, {frame.Set}, {});
+        commandBuffer.dispatch((m_MeshletCount + CULL_GROUP_SIZE - 1u) / CULL_GROUP_SIZE, 1u, 1u);
+
+        const vk::MemoryBarrier2 barrier{
+            vk::PipelineStageFlagBits2::eComputeShader,
+            vk::AccessFlagBits2::eShaderStorageWrite,
+            vk::PipelineStageFlagBits2::eDrawIndirect,
+            vk::AccessFlagBits2::eIndirectCommandRead,
+        };
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {barrier}, {}, {}}});
+    }
+
+    void MeshletRenderer::draw(const vk::CommandBuffer &commandBuffer, std::uint32_t frameIndex) const {
+        DVRE_ASSERT(frameIndex < m_Frames.size(), "vre::Vulkan::MeshletRenderer has no frame {}", frameIndex);
+        const Frame &frame = m_Frames[frameIndex];
+
+        if (m_Path == Path::eMeshShader) {
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_MeshPipeline);
+            commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, m_PipelineLayout, 0u, {frame.Set}, {});
+            CommandBuffer::DrawMeshTasks(commandBuffer, (m_MeshletCount + TASK_GROUP_SIZE - 1u) / TASK_GROUP_SIZE);
+            return;
+        }
+
+        // Culled meshlets keep their command with zero instances, so the draw count is always the meshlet count.
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_IndirectPipeline);
+        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, m_PipelineLayout, 0u, {frame.Set}, {});
+        commandBuffer.bindIndexBuffer(m_Indices.Buffer, 0u, vk::IndexType::eUint32);
+        for (std::uint32_t first = 0u; first < m_MeshletCount; first += m_MaxDrawIndirectCount) {
+            commandBuffer.drawIndexedIndirect(
+                frame.DrawCommands.Buffer,
+                std::uint64_t(first) * sizeof(vk::DrawIndexedIndirectCommand),
+                std::min(m_MeshletCount - first, m_MaxDrawIndirectCount),
+                sizeof(vk::DrawIndexedIndirectCommand));
+        }
+    }
+
+    void MeshletRenderer::release() {
+        const vk::Device device = Context::GetDevice();
+
+        for (const Frame &frame : m_Frames) {
+            Buffer::Release(frame.SceneBuffer);
+            Buffer::Release(frame.DrawCommands);
+        }
+        m_Descriptors.release();
+
+        if (m_MeshPipeline) device.destroy(m_MeshPipeline);
+        device.destroy(m_CullPipeline);
+        device.destroy(m_IndirectPipeline);
+        device.destroy(m_PipelineLayout);
+        device.destroy(m_SetLayout);
+
+        Buffer::Release(m_Vertices);
+        Buffer::Release(m_Indices);
+        Buffer::Release(m_Meshlets);
+        Buffer::Release(m_MeshletVertices);
+        Buffer::Release(m_MeshletTriangles);
+
+        m_Frames.clear();
+        m_MeshletCount = 0u;
+    }
+
+    Buffer::Allocation MeshletRenderer::upload(const void *data, std::uint64_t size, vk::BufferUsageFlags usageFlags) {
+        Buffer::Allocation buffer = Buffer::Allocate(VMA_MEMORY_USAGE_GPU_ONLY, size, usageFlags | vk::BufferUsageFlagBits::eTransferDst, Context::GetVmaAllocator());
+        UploadContext::UploadBuffer(buffer, data, size);
+        return buffer;
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -0,0 +1,360 @@
+#include <VREngine/Vulkan/ObjectCache.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        template <typename... Fields>
+        std::uint64_t HashFields(std::uint64_t seed, const Fields &...fields) {
+            ((seed = Hash::Combine(seed, Hash::Value(fields))), ...);
+            return seed;
+        }
+
+        // Cached descriptor sets may still point at views and samplers, they are dropped before the handle can be reused.
+        template <typename Handle>
+        void Destroy(const Handle &handle, const vk::Device &device) {
+            if constexpr (std::is_same_v<Handle, vk::ImageView> || std::is_same_v<Handle, vk::Sampler>)
+                DescriptorSet::Cache::InvalidateAll(handle);
+            device.destroy(handle);
+        }
+    }  // namespace
+
+    ObjectCache::Settings                                                             ObjectCache::g_Settings{};
+    vk::Device                                                                        ObjectCache::g_Device{VK_NULL_HANDLE};
+    ObjectCache::Table<vk::Sampler, vk::SamplerCreateInfo>                            ObjectCache::g_Samplers{};
+    ObjectCache::Table<vk::ImageView, vk::ImageViewCreateInfo>                        ObjectCache::g_ImageViews{};
+    ObjectCache::Table<vk::DescriptorSetLayout, ObjectCache::DescriptorSetLayoutInfo> ObjectCache::g_DescriptorSetLayouts{};
+    ObjectCache::Table<vk::PipelineLayout, ObjectCache::PipelineLayoutInfo>           ObjectCache::g_PipelineLayouts{};
+    std::uint64_t                                                                     ObjectCache::g_Frame{0u};
+    std::uint64_t                                                                     ObjectCache::g_Hits{0u};
+    std::uint64_t                                                                     ObjectCache::g_Misses{0u};
+    std::mutex                                                                        ObjectCache::g_Mutex{};
+    bool                                                                              ObjectCache::g_IsInitialized{false};
+    ObjectCache                                                                       ObjectCache::g_State{};
+
+    void ObjectCache::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::ObjectCache must be shut down before initializing");
+        DLOG_INFO("Initializing vre::Vulkan::ObjectCache");
+
+        g_Settings      = settings;
+        g_Device        = Context::GetDevice();
+        g_Frame         = 0u;
+        g_Hits          = 0u;
+        g_Misses        = 0u;
+        g_IsInitialized = true;
+    }
+
+    void ObjectCache::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void ObjectCache::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::ObjectCache down");
+
+        // Pipeline layouts go first, they are built from the cached set layouts.
+        Clear(g_PipelineLayouts, "pipeline layout");
+        Clear(g_DescriptorSetLayouts, "descriptor set layout");
+        Clear(g_ImageViews, "image view");
+        Clear(g_Samplers, "sampler");
+
+        g_IsInitialized = false;
+    }
+
+    bool ObjectCache::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    vk::Sampler ObjectCache::AcquireSampler(const vk::SamplerCreateInfo &info) {
+        DVRE_ASSERT(info.pNext == nullptr, "vre::Vulkan::ObjectCache cannot cache create infos with a pNext chain");
+        return Acquire(g_Samplers, info);
+    }
+
+    vk::ImageView ObjectCache::AcquireImageView(const vk::ImageViewCreateInfo &info) {
+        DVRE_ASSERT(info.pNext == nullptr, "vre::Vulkan::ObjectCache cannot cache create infos with a pNext chain");
+        return Acquire(g_ImageViews, info);
+    }
+
+    vk::DescriptorSetLayout ObjectCache::AcquireDescriptorSetLayout(const DescriptorLayout::Builder &builder) {
+        return Acquire(g_DescriptorSetLayouts, GetDescriptorSetLayoutInfo(builder.getFlags(), builder.getBindings()));
+    }
+
+    vk::DescriptorSetLayout ObjectCache::AcquireDescriptorSetLayout(
+        vk::DescriptorSetLayoutCreateFlags                    flags,
+        const vk::ArrayProxy<vk::DescriptorSetLayoutBinding> &bindings) {
+        return Acquire(g_DescriptorSetLayouts, GetDescriptorSetLayoutInfo(flags, bindings));
+    }
+
+    vk::PipelineLayout ObjectCache::AcquirePipelineLayout(const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts) {
+        return Acquire(g_PipelineLayouts, PipelineLayoutInfo{{setLayouts.begin(), setLayouts.end()}, {}});
+    }
+
+    vk::PipelineLayout ObjectCache::AcquirePipelineLayout(
+        const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts,
+        const vk::ArrayProxy<vk::PushConstantRange>   &pushConstants) {
+        return Acquire(g_PipelineLayouts, PipelineLayoutInfo{{setLayouts.begin(), setLayouts.end()}, {pushConstants.begin(), pushConstants.end()}});
+    }
+
+    void ObjectCache::Release(const vk::Sampler &sampler) {
+        Release(g_Samplers, sampler);
+    }
+
+    void ObjectCache::Release(const vk::ImageView &view) {
+        Release(g_ImageViews, view);
+    }
+
+    void ObjectCache::Release(const vk::DescriptorSetLayout &layout) {
+        Release(g_DescriptorSetLayouts, layout);
+    }
+
+    void ObjectCache::Release(const vk::PipelineLayout &layout) {
+        Release(g_PipelineLayouts, layout);
+    }
+
+    void ObjectCache::Update() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        g_Frame++;
+
+        Collect(g_PipelineLayouts);
+        Collect(g_DescriptorSetLayouts);
+        Collect(g_ImageViews);
+        Collect(g_Samplers);
+    }
+
+    void ObjectCache::Invalidate(const vk::Image &image) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        for (auto it = g_ImageViews.Entries.begin(); it != g_ImageViews.Entries.end();) {
+            if (it->second.Info.image != image) {
+                ++it;
+                continue;
+            }
+
+            if (it->second.References != 0u) DVRE_WARN("vre::Vulkan::ObjectCache drops an image view with {} references left", it->second.References);
+            DescriptorSet::Cache::InvalidateAll(it->second.Object);
+            g_ImageViews.Invalidated.emplace_back(it->second.Object, g_Frame);
+            g_ImageViews.Hashes.erase(static_cast<VkImageView>(it->second.Object));
+            it = g_ImageViews.Entries.erase(it);
+        }
+    }
+
+    ObjectCache::Statistics ObjectCache::GetStatistics() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+        return Statistics{
+            .SamplerCount             = std::uint32_t(g_Samplers.Entries.size()),
+            .ImageViewCount           = std::uint32_t(g_ImageViews.Entries.size()),
+            .DescriptorSetLayoutCount = std::uint32_t(g_DescriptorSetLayouts.Entries.size()),
+            .PipelineLayoutCount      = std::uint32_t(g_PipelineLayouts.Entries.size()),
+            .Hits                     = g_Hits,
+            .Misses                   = g_Misses,
+        };
+    }
+
+    ObjectCache::DescriptorSetLayoutInfo ObjectCache::GetDescriptorSetLayoutInfo(
+        vk::DescriptorSetLayoutCreateFlags                    flags,
+        const vk::ArrayProxy<vk::DescriptorSetLayoutBinding> &bindings) {
+        DescriptorSetLayoutInfo info{flags, {bindings.begin(), bindings.end()}, {}};
+        info.ImmutableSamplers.reserve(info.Bindings.size());
+        for (vk::DescriptorSetLayoutBinding &binding : info.Bindings) {
+            const vk::Sampler *samplers = binding.pImmutableSamplers;
+            info.ImmutableSamplers.emplace_back(samplers, samplers == nullptr ? samplers : samplers + binding.descriptorCount);
+            binding.pImmutableSamplers = nullptr;
+        }
+        return info;
+    }
+
+    std::uint64_t ObjectCache::HashInfo(const vk::SamplerCreateInfo &info) {
+        return HashFields(
+            0u,
+            info.flags,
+            info.magFilter,
+            info.minFilter,
+            info.mipmapMode,
+            info.addressModeU,
+            info.addressModeV,
+            info.addressModeW,
+            info.mipLodBias,
+            info.anisotropyEnable,
+            info.maxAnisotropy,
+            info.compareEnable,
+            info.compareOp,
+            info.minLod,
+            info.maxLod,
+            info.borderColor,
+            info.unnormalizedCoordinates);
+    }
+
+    std::uint64_t ObjectCache::HashInfo(const vk::ImageViewCreateInfo &info) {
+        return HashFields(
+            0u,
+            info.flags,
+            info.image,
+            info.viewType,
+            info.format,
+            info.components.r,
+            info.components.g,
+            info.components.b,
+            info.components.a,
+            info.subresourceRange.aspectMask,
+            info.subresourceRange.baseMipLevel,
+            info.subresourceRange.levelCount,
+            info.subresourceRange.baseArrayLayer,
+            info.subresourceRange.layerCount);
+    }
+
+    std::uint64_t ObjectCache::HashInfo(const DescriptorSetLayoutInfo &info) {
+        std::uint64_t hash = Hash::Value(info.Flags);
+        for (const vk::DescriptorSetLayoutBinding &binding : info.Bindings)
+            hash = HashFields(
+                hash,
+                binding.binding,
+                binding.descriptorType,
+                binding.descriptorCount,
+                binding.stageFlags);
+        for (const std::vector<vk::Sampler> &samplers : info.ImmutableSamplers) {
+            hash = HashFields(hash, samplers.size());
+            for (const vk::Sampler &sampler : samplers)
+                hash = HashFields(hash, sampler);
+        }
+        return hash;
+    }
+
+    std::uint64_t ObjectCache::HashInfo(const PipelineLayoutInfo &info) {
+        std::uint64_t hash = Hash::Value(info.SetLayouts.size());
+        for (const vk::DescriptorSetLayout &layout : info.SetLayouts)
+            hash = HashFields(hash, layout);
+        for (const vk::PushConstantRange &range : info.PushConstants)
+            hash = HashFields(hash, range.stageFlags, range.offset, range.size);
+        return hash;
+    }
+
+    vk::Sampler ObjectCache::CreateObject(const vk::SamplerCreateInfo &info) {
+        auto [result, sampler] = g_Device.createSampler(info);
+        DVRE_VK_CHECK(result);
+        return sampler;
+    }
+
+    vk::ImageView ObjectCache::CreateObject(const vk::ImageViewCreateInfo &info) {
+        auto [result, view] = g_Device.createImageView(info);
+        DVRE_VK_CHECK(result);
+        return view;
+    }
+
+    vk::DescriptorSetLayout ObjectCache::CreateObject(const DescriptorSetLayoutInfo &info) {
+        std::vector<vk::DescriptorSetLayoutBinding> bindings = info.Bindings;
+        for (std::size_t i = 0u; i < bindings.size(); i++)
+            if (!info.ImmutableSamplers[i].empty()) bindings[i].pImmutableSamplers = info.ImmutableSamplers[i].data();
+
+        auto [result, layout] = g_Device.createDescriptorSetLayout(vk::DescriptorSetLayoutCreateInfo{
+            info.Flags,
+            bindings,
+        });
+        DVRE_VK_CHECK(result);
+        return layout;
+    }
+
+    vk::PipelineLayout ObjectCache::CreateObject(const PipelineLayoutInfo &info) {
+        auto [result, layout] = g_Device.createPipelineLayout(vk::PipelineLayoutCreateInfo{
+            {},
+            info.SetLayouts,
+            info.PushConstants,
+        });
+        DVRE_VK_CHECK(result);
+        return layout;
+    }
+
+    template <typename Handle, typename Description>
+    Handle ObjectCache::Acquire(Table<Handle, Description> &table, const Description &info) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized");
+        const std::uint64_t hash = HashInfo(info);
+
+        std::scoped_lock lock{g_Mutex};
+
+        auto [begin, end] = table.Entries.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            if (!(it->second.Info == info)) continue;
+
+            it->second.References++;
+            g_Hits++;
+            return it->second.Object;
+        }
+
+        Handle object = CreateObject(info);
+        table.Entries.emplace(hash, typename Table<Handle, Description>::Entry{info, object, 1u, 0u});
+        table.Hashes.emplace(static_cast<typename Handle::CType>(object), hash);
+        g_Misses++;
+        return object;
+    }
+
+    template <typename Handle, typename Description>
+    void ObjectCache::Release(Table<Handle, Description> &table, const Handle &handle) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::ObjectCache must be initialized");
+
+        std::scoped_lock lock{g_Mutex};
+
+        auto hash = table.Hashes.find(static_cast<typename Handle::CType>(handle));
+        DVRE_ASSERT(hash != table.Hashes.end(), "Handle was not acquired from vre::Vulkan::ObjectCache");
+
+        auto [begin, end] = table.Entries.equal_range(hash->second);
+        auto it           = std::find_if(begin, end, [&](const auto &entry) { return entry.second.Object == handle; });
+        DVRE_ASSERT(it != end && it->second.References != 0u, "Handle was released more often than it was acquired");
+
+        if (--it->second.References != 0u) return;
+
+        it->second.ReleaseFrame = g_Frame;
+        table.Unreferenced.push_back(handle);
+    }
+
+    template <typename Handle, typename Description>
+    void ObjectCache::Collect(Table<Handle, Description> &table) {
+        std::erase_if(table.Invalidated, [&](const std::pair<Handle, std::uint64_t> &invalidated) {
+            if (invalidated.second + g_Settings.FramesInFlight > g_Frame) return false;
+
+            Destroy(invalidated.first, g_Device);
+            return true;
+        });
+
+        // Invalidated handles are no longer in Hashes and are dropped here.
+        std::erase_if(table.Unreferenced, [&](const Handle &handle) {
+            auto hash = table.Hashes.find(static_cast<typename Handle::CType>(handle));
+            if (hash == table.Hashes.end()) return true;
+
+            auto [begin, end] = table.Entries.equal_range(hash->second);
+            auto it           = std::find_if(begin, end, [&](const auto &entry) { return entry.second.Object == handle; });
+
+            // Acquired again since it was released, it stays alive.
+            if (it->second.References != 0u) return true;
+            if (it->second.ReleaseFrame + g_Settings.FramesInFlight > g_Frame) return false;
+
+            Destroy(handle, g_Device);
+            table.Entries.erase(it);
+            table.Hashes.erase(hash);
+            return true;
+        });
+    }
+
+    template <typename Handle, typename Description>
+    void ObjectCache::Clear(Table<Handle, Description> &table, const char *name) {
+        for (const auto &[hash, entry] : table.Entries) {
+            if (entry.References != 0u) DVRE_WARN("vre::Vulkan::ObjectCache destroys a {} with {} references left", name, entry.References);
+            Destroy(entry.Object, g_Device);
+        }
+
+        for (const auto &[object, frame] : table.Invalidated)
+            Destroy(object, g_Device);
+
+        table.Entries.clear();
+        table.Hashes.clear();
+        table.Unreferenced.clear();
+        table.Invalidated.clear();
+    }
+
+    ObjectCache::~ObjectCache() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::ObjectCache must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
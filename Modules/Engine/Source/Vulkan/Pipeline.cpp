@@ -34,6 +34,7 @@ namespace vre::Vulkan {
 
     namespace ComputePipeline {
         vk::Pipeline Create(
+            vk::PipelineCreateFlags   flags,
             const std::string        &entry,
             const vk::ShaderModule   &module,
             const vk::PipelineLayout &layout,
@@ -48,7 +49,7 @@ namespace vre::Vulkan {
             auto [result, pipeline] = device.createComputePipeline(
                 VK_NULL_HANDLE,
                 vk::ComputePipelineCreateInfo{
-                    {},
+                    flags,
                     shaderInfo,
                     layout,
                 });
@@ -57,6 +58,14 @@ namespace vre::Vulkan {
 
             return pipeline;
         }
+
+        vk::Pipeline Create(
+            const std::string        &entry,
+            const vk::ShaderModule   &module,
+            const vk::PipelineLayout &layout,
+            const vk::Device         &device) {
+            return Create({}, entry, module, layout, device);
+        }
     }  // namespace ComputePipeline
 
     namespace GraphicsPipeline {
@@ -85,11 +94,17 @@ namespace vre::Vulkan {
             m_Multisampling        = vk::PipelineMultisampleStateCreateInfo{};
             m_DepthStencil         = vk::PipelineDepthStencilStateCreateInfo{};
             m_RenderingInfo        = vk::PipelineRenderingCreateInfo{};
+            m_Flags                = vk::PipelineCreateFlags{};
             m_ShaderStages.clear();
             m_VertexInputAttributeDescriptions.clear();
             m_VertexInputBindingDescriptions.clear();
         }
 
+        Builder &Builder::setFlags(vk::PipelineCreateFlags flags) {
+            m_Flags = flags;
+            return *this;
+        }
+
         Builder &Builder::setShaders(const std::vector<Shader::StageInfo> &shaders) {
             m_ShaderStages.insert(m_ShaderStages.end(), shaders.begin(), shaders.end());
             return *this;
@@ -113,6 +128,24 @@ namespace vre::Vulkan {
             return *this;
         }
 
+        Builder &Builder::setTaskShader(const std::string &entry, const vk::ShaderModule &shader) {
+            m_ShaderStages.push_back(Shader::StageInfo{
+                .Module     = shader,
+                .StageFlags = vk::ShaderStageFlagBits::eTaskEXT,
+                .Entry      = entry,
+            });
+            return *this;
+        }
+
+        Builder &Builder::setMeshShader(const std::string &entry, const vk::ShaderModule &shader) {
+            m_ShaderStages.push_back(Shader::StageInfo{
+                .Module     = shader,
+                .StageFlags = vk::ShaderStageFlagBits::eMeshEXT,
+                .Entry      = entry,
+            });
+            return *this;
+        }
+
         Builder &Builder::setVertexLayouts(const std::vector<VertexLayout> &layouts) {
             for (const VertexLayout &layout : layouts) {
                 m_VertexInputBindingDescriptions.push_back(layout.Binding);
@@ -279,21 +312,25 @@ namespace vre::Vulkan {
                 m_VertexInputAttributeDescriptions,
             };
 
+            bool hasMeshStage = false;
+
             std::vector<vk::PipelineShaderStageCreateInfo> shaderStages{};
             shaderStages.reserve(m_ShaderStages.size());
-            for (const Shader::StageInfo &info : m_ShaderStages)
+            for (const Shader::StageInfo &info : m_ShaderStages) {
+                if (info.StageFlags & vk::ShaderStageFlagBits::eMeshEXT) hasMeshStage = true;
                 shaderStages.push_back(vk::PipelineShaderStageCreateInfo{
                     {},
                     static_cast<vk::ShaderStageFlagBits>(std::uint32_t(info.StageFlags)),
                     info.Module,
                     info.Entry.c_str(),
                 });
+            }
 
             vk::GraphicsPipelineCreateInfo pipelineInfo{
-                {},
+                m_Flags,
                 shaderStages,
-                &vertexInputInfo,
-                &m_InputAssembly,
+                hasMeshStage ? nullptr : &vertexInputInfo,
+                hasMeshStage ? nullptr : &m_InputAssembly,
                 nullptr,
                 &viewportState,
                 &m_Rasterizer,
@@ -54,6 +54,32 @@ namespace vre::Vulkan {
             return semaphore;
         }
 
+        vk::Semaphore CreateTimeline(std::uint64_t initialValue, const vk::Device &device) {
+            vk::SemaphoreTypeCreateInfo typeInfo{
+                vk::SemaphoreType::eTimeline,
+                initialValue,
+            };
+            auto [result, semaphore] = device.createSemaphore(vk::SemaphoreCreateInfo{{}, &typeInfo});
+            DVRE_VK_CHECK(result);
+            return semaphore;
+        }
+
+        std::uint64_t GetValue(const vk::Semaphore &semaphore, const vk::Device &device) {
+            auto [result, value] = device.getSemaphoreCounterValue(semaphore);
+            DVRE_VK_CHECK(result);
+            return value;
+        }
+
+        void Wait(std::uint64_t value, const vk::Semaphore &semaphore, const vk::Device &device) {
+            DVRE_VK_CHECK(device.waitSemaphores(
+                vk::SemaphoreWaitInfo{
+                    {},
+                    {semaphore},
+                    {value},
+                },
+                std::numeric_limits<std::uint64_t>::max()));
+        }
+
         vk::SemaphoreSubmitInfo GetSubmitInfo(
             std::uint64_t           value,
             vk::PipelineStageFlags2 stageFlags,
@@ -0,0 +1,662 @@
+#include <VREngine/Vulkan/TextureResidency.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Synchronization.hpp>
+#include <VREngine/Vulkan/Command.hpp>
+#include <VREngine/Vulkan/Queue.hpp>
+#include <VREngine/Vulkan/Image.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Assets/AssetIO.hpp>
+#include <VREngine/Assets/AssetPrefetcher.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        constexpr std::uint32_t TEXEL_SIZE = 4u;
+
+        std::uint64_t GetChainSize(std::uint32_t width, std::uint32_t height, std::uint32_t firstMip, std::uint32_t mipCount) {
+            std::uint64_t size = 0u;
+            for (std::uint32_t mip = firstMip; mip < mipCount; mip++)
+                size += std::uint64_t(std::max(width >> mip, 1u)) * std::max(height >> mip, 1u) * TEXEL_SIZE;
+            return size;
+        }
+
+        std::span<TextureResidency::Feedback> MapFeedback(const Buffer::Allocation &buffer) {
+            VmaAllocationInfo allocationInfo{};
+            vmaGetAllocationInfo(buffer.Allocator, buffer.Allocation, &allocationInfo);
+            return {(TextureResidency::Feedback *)allocationInfo.pMappedData, buffer.Size / sizeof(TextureResidency::Feedback)};
+        }
+
+        // Textures are streamed as RGBA8 only, an HDR source fails to load and keeps the placeholder.
+        std::optional<TextureAsset> WithMips(std::optional<TextureAsset> &&asset) {
+            if (asset.has_value() && asset->getFormat() != TextureAsset::Format::eRGBA8) {
+                VRE_WARN("vre::Vulkan::TextureResidency only supports RGBA8 textures: '{}'", asset->getPath());
+                asset->release();
+                return std::nullopt;
+            }
+            if (asset.has_value() && asset->getMipCount() == 1u) asset->generateMips();
+            return std::move(asset);
+        }
+    }  // namespace
+
+    TextureResidency::Settings                TextureResidency::g_Settings{};
+    std::vector<TextureResidency::Texture>    TextureResidency::g_Textures{};
+    std::vector<TextureResidency::TextureId>  TextureResidency::g_FreeTextures{};
+    std::vector<TextureResidency::Submission> TextureResidency::g_InFlight{};
+    std::vector<TextureResidency::Submission> TextureResidency::g_FreeSubmissions{};
+    TextureResidency::Submission              TextureResidency::g_Current{};
+    std::vector<TextureResidency::Garbage>    TextureResidency::g_Garbage{};
+    std::vector<Buffer::Allocation>           TextureResidency::g_FeedbackBuffers{};
+    vk::CommandPool                           TextureResidency::g_CommandPool{};
+    Image::Allocation                         TextureResidency::g_Placeholder{};
+    vk::ImageView                             TextureResidency::g_PlaceholderView{};
+    std::uint64_t                             TextureResidency::g_FrameIndex{0u};
+    std::uint64_t                             TextureResidency::g_Usage{0u};
+    std::uint64_t                             TextureResidency::g_PendingRelease{0u};
+    bool                                      TextureResidency::g_IsInitialized{false};
+    TextureResidency                          TextureResidency::g_State{};
+
+    void TextureResidency::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(ThreadPool::IsInitialized(), "vre::ThreadPool must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::TextureResidency must be shut down before initializing");
+        DLOG_INFO("Initializing vre::Vulkan::TextureResidency");
+
+        g_Settings    = settings;
+        g_CommandPool = CommandPool::CreateResetCommandBuffer(Context::GetQueueFamilyIndex(), Context::GetDevice());
+
+        g_FeedbackBuffers.reserve(g_Settings.FramesInFlight);
+        for (std::uint32_t i = 0u; i < g_Settings.FramesInFlight; i++) {
+            const Buffer::Allocation &buffer = g_FeedbackBuffers.emplace_back(Buffer::AllocateMapped(
+                VMA_MEMORY_USAGE_GPU_TO_CPU,
+                std::uint64_t(g_Settings.MaxTextures) * sizeof(Feedback),
+                vk::BufferUsageFlagBits::eStorageBuffer,
+                Context::GetVmaAllocator()));
+
+            std::ranges::fill(MapFeedback(buffer), Feedback{0u, 0u, FEEDBACK_NONE, FEEDBACK_NONE});
+            DVRE_VK_CHECK(vmaFlushAllocation(buffer.Allocator, buffer.Allocation, 0u, VK_WHOLE_SIZE));
+        }
+
+        g_Placeholder = Image::Allocate(
+            0u,
+            vk::MemoryPropertyFlagBits::eDeviceLocal,
+            g_Settings.Format,
+            vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst,
+            vk::Extent2D{1u, 1u},
+            1u,
+            Context::GetVmaAllocator());
+        g_PlaceholderView = Image::CreateColorView(g_Placeholder, Context::GetDevice());
+
+        const std::uint32_t white = 0xFFFFFFFFu;
+        BeginSubmission();
+        Upload(g_Placeholder, 0u, 1u, &white, sizeof(white));
+        EndSubmission();
+
+        g_IsInitialized = true;
+    }
+
+    void TextureResidency::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void TextureResidency::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::TextureResidency down");
+
+        const vk::Device device = Context::GetDevice();
+        DVRE_VK_CHECK(device.waitIdle());
+
+        EndSubmission();
+        for (Submission &submission : g_InFlight)
+            DVRE_VK_CHECK(device.waitForFences({submission.Fence}, vk::True, std::numeric_limits<std::uint64_t>::max()));
+        RetireSubmissions();
+
+        for (Texture &texture : g_Textures) {
+            if (texture.IsLoading) {
+                std::optional<TextureAsset> asset = texture.Pending.get();
+                if (asset.has_value()) asset->release();
+            }
+            ReleaseImage(texture);
+        }
+        CollectGarbage(true);
+
+        for (const Submission &submission : g_FreeSubmissions)
+            device.destroy(submission.Fence);
+        for (const Buffer::Allocation &buffer : g_FeedbackBuffers)
+            Buffer::Release(buffer);
+        device.destroy(g_CommandPool);
+        device.destroy(g_PlaceholderView);
+        Image::Release(g_Placeholder);
+
+        g_Textures.clear();
+        g_FreeTextures.clear();
+        g_FreeSubmissions.clear();
+        g_FeedbackBuffers.clear();
+        g_FrameIndex     = 0u;
+        g_Usage          = 0u;
+        g_PendingRelease = 0u;
+        g_IsInitialized  = false;
+    }
+
+    bool TextureResidency::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    TextureResidency::TextureId TextureResidency::Register(const fs::path &path) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+
+        TextureId id = TextureId(g_Textures.size());
+        if (!g_FreeTextures.empty()) {
+            id = g_FreeTextures.back();
+            g_FreeTextures.pop_back();
+        } else {
+            VRE_ASSERT(id < g_Settings.MaxTextures, "vre::Vulkan::TextureResidency is limited to {} textures", g_Settings.MaxTextures);
+            g_Textures.emplace_back();
+        }
+
+        Texture &texture     = g_Textures[id];
+        texture.Path         = path.string();
+        texture.IsRegistered = true;
+
+        if (!fs::exists(path)) DVRE_WARN("A texture registered to vre::Vulkan::TextureResidency does not exist: '{}'", texture.Path);
+
+        return id;
+    }
+
+    void TextureResidency::Unregister(TextureId id) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+
+        Texture &texture     = g_Textures[id];
+        texture.IsRegistered = false;
+        if (!texture.IsUploading) ReleaseImage(texture);
+        TryFree(id);
+    }
+
+    vk::ImageView TextureResidency::Request(TextureId id) {
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+        return Request(id, g_Settings.EnableFeedback ? g_Textures[id].DesiredMip : 0u);
+    }
+
+    vk::ImageView TextureResidency::Request(TextureId id, std::uint32_t desiredMip) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+
+        Texture &texture      = g_Textures[id];
+        texture.LastUsedFrame = g_FrameIndex;
+        texture.DesiredMip    = texture.MipCount != 0u ? std::min(desiredMip, texture.MipCount - 1u) : desiredMip;
+
+        if (texture.LowMipData.empty() && !texture.IsLoading && g_FrameIndex >= texture.RetryFrame)
+            StartLoad(texture);
+
+        return texture.View ? texture.View : g_PlaceholderView;
+    }
+
+    void TextureResidency::Update() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+
+        g_FrameIndex++;
+        RetireSubmissions();
+        CollectGarbage(false);
+        ReadFeedback();
+
+        std::uint32_t uploadCount = 0u;
+        for (TextureId id = 0u; id < TextureId(g_Textures.size()) && uploadCount < g_Settings.MaxUploadsPerFrame; id++) {
+            Texture &texture = g_Textures[id];
+            if (!texture.IsLoading || texture.Pending.wait_for(std::chrono::seconds{0}) != std::future_status::ready) continue;
+
+            std::optional<TextureAsset> asset = texture.Pending.get();
+            texture.IsLoading                 = false;
+
+            if (!asset.has_value()) {
+                VRE_WARN("Failed to load '{}', using a placeholder", texture.Path);
+                texture.IsFailed = true;
+                TryFree(id);
+                continue;
+            }
+
+            if (texture.IsRegistered) {
+                OnLoaded(id, *asset);
+                uploadCount++;
+            } else {
+                TryFree(id);
+            }
+            asset->release();
+        }
+
+        for (TextureId id = 0u; id < TextureId(g_Textures.size()) && uploadCount < g_Settings.MaxUploadsPerFrame; id++) {
+            Texture &texture = g_Textures[id];
+            if (!texture.IsRegistered || texture.IsLoading || texture.IsUploading || texture.LowMipData.empty()) continue;
+            if (texture.LastUsedFrame + g_Settings.FramesInFlight < g_FrameIndex || g_FrameIndex < texture.RetryFrame) continue;
+
+            if (!texture.Image.Image) {
+                if (!Promote(id, texture.LowMip, texture.LowMip, texture.LowMipData.data(), true))
+                    texture.RetryFrame = g_FrameIndex + g_Settings.RetryDelayFrames;
+                uploadCount++;
+                continue;
+            }
+
+            if (texture.DesiredMip >= texture.ResidentMip) continue;
+
+            if (texture.MipData.empty()) {
+                StartLoad(texture);
+                continue;
+            }
+
+            const std::uint32_t mip = texture.ResidentMip - 1u;
+            if (texture.DesiredMip >= texture.ImageMip) {
+                Stream(id, mip);
+            } else if (!Promote(id, texture.DesiredMip, mip, texture.MipData.data() + GetChainSize(texture.Width, texture.Height, 0u, mip), true)) {
+                DVRE_WARN("Not enough texture memory to stream '{}' at mip {}", texture.Path, texture.DesiredMip);
+                texture.RetryFrame = g_FrameIndex + g_Settings.RetryDelayFrames;
+            }
+            uploadCount++;
+        }
+
+        MakeRoom(0u, INVALID_TEXTURE);
+        WriteFeedback();
+        EndSubmission();
+    }
+
+    TextureResidency::Residency TextureResidency::GetResidency(TextureId id) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+
+        const Texture &texture = g_Textures[id];
+        if (!texture.View) return Residency::eEvicted;
+        return texture.ResidentMip >= texture.LowMip ? Residency::eLowMip : Residency::eResident;
+    }
+
+    std::uint32_t TextureResidency::GetResidentMip(TextureId id) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+        return g_Textures[id].ResidentMip;
+    }
+
+    bool TextureResidency::IsLoading(TextureId id) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        DVRE_ASSERT(id < g_Textures.size() && g_Textures[id].IsRegistered, "Invalid vre::Vulkan::TextureResidency texture: {}", id);
+        return g_Textures[id].IsLoading || g_Textures[id].IsUploading;
+    }
+
+    vk::ImageView TextureResidency::GetPlaceholderView() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        return g_PlaceholderView;
+    }
+
+    const Buffer::Allocation &TextureResidency::GetFeedbackBuffer() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        return g_FeedbackBuffers[g_FrameIndex % g_Settings.FramesInFlight];
+    }
+
+    std::uint64_t TextureResidency::GetBudget() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+
+        const VmaAllocator allocator = Context::GetVmaAllocator();
+
+        const VkPhysicalDeviceMemoryProperties *properties = nullptr;
+        vmaGetMemoryProperties(allocator, &properties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+        vmaGetHeapBudgets(allocator, budgets.data());
+
+        std::uint64_t heapBudget = 0u;
+        std::uint64_t heapUsage  = 0u;
+        for (std::uint32_t i = 0u; i < properties->memoryHeapCount; i++) {
+            if (!(properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)) continue;
+            heapBudget += budgets[i].budget;
+            heapUsage += budgets[i].usage;
+        }
+
+        const std::uint64_t external = heapUsage > g_Usage ? heapUsage - g_Usage : 0u;
+        const std::uint64_t limit    = std::uint64_t(double(heapBudget) * double(g_Settings.BudgetFraction));
+
+        std::uint64_t budget = limit > external ? limit - external : 0u;
+        if (g_Settings.BudgetBytes != 0u) budget = std::min(budget, g_Settings.BudgetBytes);
+        return budget;
+    }
+
+    std::uint64_t TextureResidency::GetUsage() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::TextureResidency must be initialized");
+        return g_Usage;
+    }
+
+    void TextureResidency::StartLoad(Texture &texture) {
+        // A file that failed to decode keeps the placeholder until it is unregistered instead of being decoded every frame.
+        if (texture.IsFailed) return;
+
+        if (!fs::exists(texture.Path)) {
+            texture.RetryFrame = g_FrameIndex + g_Settings.RetryDelayFrames;
+            return;
+        }
+
+        texture.IsLoading = true;
+
+        // With io_uring the read runs on the ring and only the decode takes a worker, so the loads started in one Update()
+        // are queued on the device together instead of each one blocking a worker on its read. Cooked textures are not
+        // decoded by stb and keep the blocking path.
+        if (AssetIO::IsInitialized() && AssetIO::GetBackend() == AssetIO::Backend::eIoUring &&
+            fs::path(texture.Path).extension() != TextureAsset::COOKED_EXTENSION) {
+            std::error_code     error{};
+            const std::uint64_t size = fs::file_size(texture.Path, error);
+            if (!error) {
+                AssetPrefetcher::RecordAccess(texture.Path);
+
+                std::shared_ptr<std::promise<std::optional<TextureAsset>>> promise = std::make_shared<std::promise<std::optional<TextureAsset>>>();
+                std::shared_ptr<std::vector<std::byte>>                    data    = std::make_shared<std::vector<std::byte>>(size);
+                texture.Pending                                                    = promise->get_future();
+
+                AssetIO::Read(AssetIO::Request{texture.Path, 0u, size, data->data()}, [path = texture.Path, promise, data](bool success) {
+                    if (!success) {
+                        promise->set_value(std::nullopt);
+                        return;
+                    }
+                    ThreadPool::Submit([path, promise, data] {
+                        promise->set_value(WithMips(TextureAsset::TryFromData(path, data->data(), data->size())));
+                    });
+                });
+                return;
+            }
+        }
+
+        texture.Pending = ThreadPool::Submit([path = texture.Path] {
+            return WithMips(TextureAsset::TryFromPath(path));
+        });
+    }
+
+    void TextureResidency::OnLoaded(TextureId id, TextureAsset &asset) {
+        VRE_ASSERT(asset.getChannelCount() == TEXEL_SIZE, "vre::Vulkan::TextureResidency only supports RGBA8 textures: '{}'", asset.getPath());
+
+        Texture &texture = g_Textures[id];
+        texture.Width    = asset.getWidth();
+        texture.Height   = asset.getHeight();
+        texture.MipCount = asset.getMipCount();
+        texture.LowMip   = 0u;
+        while (texture.LowMip + 1u < texture.MipCount &&
+               std::max(texture.Width >> texture.LowMip, texture.Height >> texture.LowMip) > g_Settings.LowMipSize)
+            texture.LowMip++;
+
+        if (texture.DesiredMip == FEEDBACK_NONE)
+            texture.DesiredMip = g_Settings.EnableFeedback ? texture.MipCount - 1u : 0u;
+        texture.DesiredMip = std::min(texture.DesiredMip, texture.MipCount - 1u);
+
+        const std::byte *data = (const std::byte *)asset.getData();
+        if (texture.LowMipData.empty()) {
+            const std::byte *lowMipData = data + asset.getMipOffset(texture.LowMip);
+            texture.LowMipData.assign(lowMipData, lowMipData + GetChainSize(texture.Width, texture.Height, texture.LowMip, texture.MipCount));
+        }
+        if (texture.DesiredMip < texture.LowMip)
+            texture.MipData.assign(data, data + GetChainSize(texture.Width, texture.Height, 0u, texture.MipCount));
+
+        if (texture.Image.Image || Promote(id, texture.LowMip, texture.LowMip, texture.LowMipData.data(), true)) return;
+
+        DVRE_WARN("Not enough texture memory for '{}', using a placeholder", texture.Path);
+        texture.RetryFrame = g_FrameIndex + g_Settings.RetryDelayFrames;
+    }
+
+    bool TextureResidency::Promote(TextureId id, std::uint32_t imageMip, std::uint32_t firstMip, const std::byte *data, bool makeRoom) {
+        Texture &texture = g_Textures[id];
+        if (makeRoom && !MakeRoom(GetChainSize(texture.Width, texture.Height, imageMip, texture.MipCount), id)) return false;
+
+        std::optional<Image::Allocation> image = Image::TryAllocate(
+            VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT,
+            vk::MemoryPropertyFlagBits::eDeviceLocal,
+            g_Settings.Format,
+            vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst,
+            vk::Extent2D{std::max(texture.Width >> imageMip, 1u), std::max(texture.Height >> imageMip, 1u)},
+            texture.MipCount - imageMip,
+            Context::GetVmaAllocator());
+        if (!image.has_value()) return false;
+
+        VmaAllocationInfo allocationInfo{};
+        vmaGetAllocationInfo(image->Allocator, image->Allocation, &allocationInfo);
+
+        BeginSubmission();
+        Upload(*image, firstMip - imageMip, texture.MipCount - firstMip, data, GetChainSize(texture.Width, texture.Height, firstMip, texture.MipCount));
+        g_Current.Swaps.push_back(Swap{
+            .Texture     = id,
+            .Image       = *image,
+            .ImageMip    = imageMip,
+            .ResidentMip = firstMip,
+            .Size        = allocationInfo.size,
+        });
+
+        g_Usage += allocationInfo.size;
+        texture.IsUploading = true;
+        return true;
+    }
+
+    void TextureResidency::Stream(TextureId id, std::uint32_t mip) {
+        Texture &texture = g_Textures[id];
+
+        BeginSubmission();
+        Upload(
+            texture.Image,
+            mip - texture.ImageMip,
+            1u,
+            texture.MipData.data() + GetChainSize(texture.Width, texture.Height, 0u, mip),
+            GetChainSize(texture.Width, texture.Height, mip, mip + 1u));
+        g_Current.Swaps.push_back(Swap{
+            .Texture     = id,
+            .Image       = Image::Allocation{},
+            .ImageMip    = texture.ImageMip,
+            .ResidentMip = mip,
+            .Size        = 0u,
+        });
+
+        texture.IsUploading = true;
+    }
+
+    bool TextureResidency::MakeRoom(std::uint64_t required, TextureId exclude) {
+        const std::uint64_t budget = GetBudget();
+        while (g_Usage - g_PendingRelease + required > budget) {
+            TextureId victim = INVALID_TEXTURE;
+            for (TextureId id = 0u; id < TextureId(g_Textures.size()); id++) {
+                const Texture &texture = g_Textures[id];
+                if (id == exclude || !texture.Image.Image || texture.IsUploading) continue;
+                if (texture.LastUsedFrame + g_Settings.FramesInFlight >= g_FrameIndex) continue;
+                if (victim == INVALID_TEXTURE || texture.LastUsedFrame < g_Textures[victim].LastUsedFrame) victim = id;
+            }
+
+            if (victim == INVALID_TEXTURE) return false;
+            Evict(victim);
+        }
+        return true;
+    }
+
+    void TextureResidency::Evict(TextureId id) {
+        Texture &texture   = g_Textures[id];
+        texture.DesiredMip = FEEDBACK_NONE;
+        texture.MipData.clear();
+        texture.MipData.shrink_to_fit();
+
+        if (texture.ImageMip < texture.LowMip) {
+            texture.IsDemoting = true;
+            g_PendingRelease += texture.Size;
+            if (Promote(id, texture.LowMip, texture.LowMip, texture.LowMipData.data(), false)) return;
+
+            texture.IsDemoting = false;
+            g_PendingRelease -= texture.Size;
+        }
+
+        ReleaseImage(texture);
+    }
+
+    void TextureResidency::ReleaseImage(Texture &texture) {
+        if (!texture.Image.Image) return;
+
+        g_Garbage.push_back(Garbage{
+            .Frame = g_FrameIndex,
+            .Image = texture.Image,
+            .View  = texture.View,
+        });
+
+        g_Usage -= texture.Size;
+        texture.Image       = Image::Allocation{};
+        texture.View        = nullptr;
+        texture.Size        = 0u;
+        texture.ImageMip    = 0u;
+        texture.ResidentMip = FEEDBACK_NONE;
+    }
+
+    void TextureResidency::TryFree(TextureId id) {
+        Texture &texture = g_Textures[id];
+        if (texture.IsRegistered || texture.IsLoading || texture.IsUploading) return;
+
+        texture = Texture{};
+        g_FreeTextures.push_back(id);
+    }
+
+    void TextureResidency::Upload(const Image::Allocation &image, std::uint32_t firstMipLevel, std::uint32_t mipLevelCount, const void *data, std::uint64_t size) {
+        Buffer::Allocation staging = Buffer::AllocateMapped(
+            VMA_MEMORY_USAGE_CPU_ONLY,
+            size,
+            vk::BufferUsageFlagBits::eTransferSrc,
+            Context::GetVmaAllocator());
+
+        VmaAllocationInfo stagingAllocationInfo{};
+        vmaGetAllocationInfo(staging.Allocator, staging.Allocation, &stagingAllocationInfo);
+        std::memcpy(stagingAllocationInfo.pMappedData, data, size);
+
+        const vk::ImageSubresourceRange range = Image::GetColorMipRange(firstMipLevel, mipLevelCount);
+        Image::TransitionLayout(g_Current.CommandBuffer, image, range, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
+        CommandBuffer::CopyBufferToImage(g_Current.CommandBuffer, staging, image, 0u, firstMipLevel, mipLevelCount);
+        Image::TransitionLayout(g_Current.CommandBuffer, image, range, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal);
+
+        g_Current.Staging.push_back(staging);
+    }
+
+    void TextureResidency::ReadFeedback() {
+        if (!g_Settings.EnableFeedback) return;
+
+        const Buffer::Allocation &buffer = GetFeedbackBuffer();
+        DVRE_VK_CHECK(vmaInvalidateAllocation(buffer.Allocator, buffer.Allocation, 0u, VK_WHOLE_SIZE));
+
+        std::span<Feedback> feedback = MapFeedback(buffer);
+        for (TextureId id = 0u; id < TextureId(g_Textures.size()); id++) {
+            const std::uint32_t requestedMip = feedback[id].RequestedMip;
+            feedback[id].RequestedMip        = FEEDBACK_NONE;
+
+            Texture &texture = g_Textures[id];
+            if (!texture.IsRegistered || requestedMip == FEEDBACK_NONE) continue;
+
+            texture.LastUsedFrame = g_FrameIndex;
+            if (requestedMip != FEEDBACK_UNKNOWN && texture.MipCount != 0u)
+                texture.DesiredMip = std::min(requestedMip, texture.MipCount - 1u);
+            if (texture.LowMipData.empty() && !texture.IsLoading && g_FrameIndex >= texture.RetryFrame)
+                StartLoad(texture);
+        }
+    }
+
+    void TextureResidency::WriteFeedback() {
+        if (!g_Settings.EnableFeedback) return;
+
+        const Buffer::Allocation &buffer   = GetFeedbackBuffer();
+        std::span<Feedback>       feedback = MapFeedback(buffer);
+        for (TextureId id = 0u; id < TextureId(g_Textures.size()); id++) {
+            const Texture &texture   = g_Textures[id];
+            feedback[id].Width       = texture.Width;
+            feedback[id].Height      = texture.Height;
+            feedback[id].ResidentMip = texture.ResidentMip;
+        }
+
+        DVRE_VK_CHECK(vmaFlushAllocation(buffer.Allocator, buffer.Allocation, 0u, VK_WHOLE_SIZE));
+    }
+
+    void TextureResidency::BeginSubmission() {
+        if (g_Current.CommandBuffer) return;
+
+        if (!g_FreeSubmissions.empty()) {
+            g_Current = std::move(g_FreeSubmissions.back());
+            g_FreeSubmissions.pop_back();
+        } else {
+            g_Current.CommandBuffer = CommandBuffer::AllocatePrimary(g_CommandPool, Context::GetDevice());
+            g_Current.Fence         = Fence::Create(Context::GetDevice());
+        }
+
+        CommandBuffer::BeginOneTimeSubmit(g_Current.CommandBuffer);
+    }
+
+    void TextureResidency::EndSubmission() {
+        if (!g_Current.CommandBuffer) return;
+
+        CommandBuffer::End(g_Current.CommandBuffer);
+        Queue::Submit({CommandBuffer::GetSubmitInfo(g_Current.CommandBuffer)}, g_Current.Fence, Context::GetGraphicsQueue());
+
+        g_InFlight.push_back(std::move(g_Current));
+        g_Current = Submission{};
+    }
+
+    void TextureResidency::RetireSubmissions() {
+        const vk::Device device = Context::GetDevice();
+
+        for (std::size_t i = 0u; i < g_InFlight.size();) {
+            Submission &submission = g_InFlight[i];
+            if (device.getFenceStatus(submission.Fence) != vk::Result::eSuccess) {
+                i++;
+                continue;
+            }
+
+            for (const Buffer::Allocation &staging : submission.Staging)
+                Buffer::Release(staging);
+
+            for (const Swap &swap : submission.Swaps) {
+                Texture &texture    = g_Textures[swap.Texture];
+                texture.IsUploading = false;
+
+                if (swap.Image.Image) {
+                    if (texture.IsDemoting) {
+                        g_PendingRelease -= texture.Size;
+                        texture.IsDemoting = false;
+                    }
+                    ReleaseImage(texture);
+
+                    texture.Image    = swap.Image;
+                    texture.Size     = swap.Size;
+                    texture.ImageMip = swap.ImageMip;
+                }
+
+                if (texture.View) {
+                    g_Garbage.push_back(Garbage{
+                        .Frame = g_FrameIndex,
+                        .Image = Image::Allocation{},
+                        .View  = texture.View,
+                    });
+                }
+                texture.View        = Image::CreateColorView(texture.Image, swap.ResidentMip - texture.ImageMip, device);
+                texture.ResidentMip = swap.ResidentMip;
+
+                if (texture.ResidentMip == 0u) {
+                    texture.MipData.clear();
+                    texture.MipData.shrink_to_fit();
+                }
+
+                if (!texture.IsRegistered) {
+                    ReleaseImage(texture);
+                    TryFree(swap.Texture);
+                }
+            }
+
+            DVRE_VK_CHECK(device.resetFences({submission.Fence}));
+            submission.Staging.clear();
+            submission.Swaps.clear();
+            g_FreeSubmissions.push_back(std::move(submission));
+
+            if (i + 1u != g_InFlight.size()) g_InFlight[i] = std::move(g_InFlight.back());
+            g_InFlight.pop_back();
+        }
+    }
+
+    void TextureResidency::CollectGarbage(bool force) {
+        const vk::Device device = Context::GetDevice();
+
+        std::erase_if(g_Garbage, [&](const Garbage &garbage) {
+            if (!force && garbage.Frame + g_Settings.FramesInFlight > g_FrameIndex) return false;
+            device.destroy(garbage.View);
+            if (garbage.Image.Image) Image::Release(garbage.Image);
+            return true;
+        });
+    }
+
+    TextureResidency::~TextureResidency() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::TextureResidency must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
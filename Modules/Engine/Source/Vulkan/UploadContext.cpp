@@ -0,0 +1,361 @@
+#include <VREngine/Vulkan/UploadContext.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Synchronization.hpp>
+#include <VREngine/Vulkan/Command.hpp>
+#include <VREngine/Vulkan/Queue.hpp>
+#include <VREngine/Vulkan/Image.hpp>
+#include <VREngine/Vulkan/Buffer.hpp>
+#include <VREngine/Assets/AssetIO.hpp>
+
+namespace vre::Vulkan {
+    namespace {
+        std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) {
+            return (value + alignment - 1u) / alignment * alignment;
+        }
+
+        // Matches the tightly packed layout CommandBuffer::CopyBufferToImage reads the mip levels from.
+        std::uint64_t GetMipRangeSize(const Image::Allocation &image, std::uint32_t firstMipLevel, std::uint32_t mipLevelCount) {
+            std::uint64_t size = 0u;
+            for (std::uint32_t mip = firstMipLevel; mip < firstMipLevel + mipLevelCount; mip++)
+                size += std::uint64_t(std::max(image.Extent.width >> mip, 1u)) * std::max(image.Extent.height >> mip, 1u) *
+                        std::max(image.Extent.depth >> mip, 1u) * vk::blockSize(image.Format);
+            return size;
+        }
+    }  // namespace
+
+    UploadContext::Settings                UploadContext::g_Settings{};
+    Buffer::Allocation                     UploadContext::g_Ring{};
+    std::byte                             *UploadContext::g_RingData{nullptr};
+    std::uint64_t                          UploadContext::g_Head{0u};
+    std::uint64_t                          UploadContext::g_Tail{0u};
+    std::deque<UploadContext::Submission>  UploadContext::g_InFlight{};
+    std::deque<UploadContext::Submission>  UploadContext::g_Acquiring{};
+    std::vector<UploadContext::Submission> UploadContext::g_FreeSubmissions{};
+    UploadContext::Submission              UploadContext::g_Current{};
+    vk::CommandPool                        UploadContext::g_CommandPool{};
+    vk::CommandPool                        UploadContext::g_AcquireCommandPool{};
+    vk::Semaphore                          UploadContext::g_TransferTimeline{};
+    vk::Semaphore                          UploadContext::g_AcquireTimeline{};
+    UploadContext::Ticket                  UploadContext::g_NextTicket{INVALID_TICKET + 1u};
+    UploadContext::Ticket                  UploadContext::g_CompletedTicket{INVALID_TICKET};
+    bool                                   UploadContext::g_IsInitialized{false};
+    UploadContext                          UploadContext::g_State{};
+
+    void UploadContext::Initialize(const Settings &settings) {
+        DVRE_ASSERT(Context::IsInitialized(), "vre::Vulkan::Context must be initialized");
+        DVRE_ASSERT(!g_IsInitialized, "vre::Vulkan::UploadContext must be shut down before initializing");
+        DVRE_ASSERT(settings.RingSize != 0u && settings.Alignment != 0u, "vre::Vulkan::UploadContext needs a non-empty ring");
+        DLOG_INFO("Initializing vre::Vulkan::UploadContext with a {} byte staging ring", settings.RingSize);
+
+        const vk::Device device = Context::GetDevice();
+
+        g_Settings           = settings;
+        g_CommandPool        = CommandPool::CreateResetCommandBuffer(Context::GetTransferQueueFamilyIndex(), device);
+        g_AcquireCommandPool = CommandPool::CreateResetCommandBuffer(Context::GetQueueFamilyIndex(), device);
+        g_TransferTimeline   = Semaphore::CreateTimeline(0u, device);
+        g_AcquireTimeline    = Semaphore::CreateTimeline(0u, device);
+        g_Ring               = Buffer::AllocateMapped(
+            VMA_MEMORY_USAGE_CPU_ONLY,
+            g_Settings.RingSize,
+            vk::BufferUsageFlagBits::eTransferSrc,
+            Context::GetVmaAllocator());
+
+        VmaAllocationInfo allocationInfo{};
+        vmaGetAllocationInfo(g_Ring.Allocator, g_Ring.Allocation, &allocationInfo);
+        g_RingData = (std::byte *)allocationInfo.pMappedData;
+
+        // File reads that land in the staging ring can then use io_uring's fixed buffers instead of pinning pages per read.
+        if (AssetIO::IsInitialized()) AssetIO::RegisterBuffer(g_RingData, g_Settings.RingSize);
+
+        g_Head            = 0u;
+        g_Tail            = 0u;
+        g_NextTicket      = INVALID_TICKET + 1u;
+        g_CompletedTicket = INVALID_TICKET;
+        g_IsInitialized   = true;
+    }
+
+    void UploadContext::Initialize() {
+        Initialize(Settings{});
+    }
+
+    void UploadContext::Shutdown() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized before shutting down");
+        DLOG_INFO("Shutting vre::Vulkan::UploadContext down");
+
+        Wait(Flush());
+        if (AssetIO::IsInitialized()) AssetIO::UnregisterBuffers();
+
+        const vk::Device device = Context::GetDevice();
+        device.destroy(g_CommandPool);
+        device.destroy(g_AcquireCommandPool);
+        device.destroy(g_TransferTimeline);
+        device.destroy(g_AcquireTimeline);
+        Buffer::Release(g_Ring);
+
+        g_FreeSubmissions.clear();
+        g_Ring          = Buffer::Allocation{};
+        g_RingData      = nullptr;
+        g_IsInitialized = false;
+    }
+
+    bool UploadContext::IsInitialized() {
+        return g_IsInitialized;
+    }
+
+    UploadContext::Ticket UploadContext::UploadBuffer(const Buffer::Allocation &destination, std::uint64_t destinationOffset, const void *data, std::uint64_t size) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        DVRE_ASSERT(destinationOffset + size <= destination.Size, "An upload of {} bytes at offset {} overflows a vk::Buffer of {} bytes", size, destinationOffset, destination.Size);
+        if (size == 0u) return INVALID_TICKET;
+
+        const Staging staging = Stage(data, size, g_Settings.Alignment);
+
+        BeginSubmission();
+        CommandBuffer::CopyBufferToBuffer(g_Current.CommandBuffer, staging.Source, destination, staging.Offset, destinationOffset, size);
+        if (Context::IsTransferQueueDedicated()) g_Current.Buffers.push_back(BufferOwnership{destination, destinationOffset, size});
+        return g_NextTicket;
+    }
+
+    UploadContext::Ticket UploadContext::UploadBuffer(const Buffer::Allocation &destination, const void *data, std::uint64_t size) {
+        return UploadBuffer(destination, 0u, data, size);
+    }
+
+    UploadContext::Ticket UploadContext::UploadImage(const Image::Allocation &destination, std::uint32_t firstMipLevel, std::uint32_t mipLevelCount, const void *data, std::uint64_t size) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        DVRE_ASSERT(size >= GetMipRangeSize(destination, firstMipLevel, mipLevelCount), "An upload of {} bytes is smaller than the {} bytes of mip levels {}..{}", size, GetMipRangeSize(destination, firstMipLevel, mipLevelCount), firstMipLevel, firstMipLevel + mipLevelCount);
+
+        const Staging staging = Stage(data, size, std::lcm(g_Settings.Alignment, std::uint64_t(vk::blockSize(destination.Format))));
+
+        BeginSubmission();
+        const vk::ImageSubresourceRange range = Image::GetColorMipRange(firstMipLevel, mipLevelCount);
+        Image::TransitionLayout(g_Current.CommandBuffer, destination, range, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
+        CommandBuffer::CopyBufferToImage(g_Current.CommandBuffer, staging.Source, destination, staging.Offset, firstMipLevel, mipLevelCount);
+        if (Context::IsTransferQueueDedicated())
+            g_Current.Images.push_back(ImageOwnership{destination, range});
+        else
+            Image::TransitionLayout(g_Current.CommandBuffer, destination, range, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal);
+        return g_NextTicket;
+    }
+
+    UploadContext::Ticket UploadContext::UploadImage(const Image::Allocation &destination, const void *data, std::uint64_t size) {
+        return UploadImage(destination, 0u, destination.MipLevels, data, size);
+    }
+
+    UploadContext::Ticket UploadContext::Flush() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        if (!g_Current.CommandBuffer) return g_NextTicket - 1u;
+
+        g_Current.Id      = g_NextTicket++;
+        g_Current.RingEnd = g_Head;
+
+        if (Context::IsTransferQueueDedicated()) {
+            TransferOwnership(g_Current.CommandBuffer, g_Current);
+        } else {
+            // Later submissions on the queue may read the uploaded data without a barrier of their own.
+            const vk::MemoryBarrier2 barrier{
+                vk::PipelineStageFlagBits2::eTransfer,
+                vk::AccessFlagBits2::eTransferWrite,
+                vk::PipelineStageFlagBits2::eAllCommands,
+                vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite,
+            };
+            g_Current.CommandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {barrier}, {}, {}}});
+        }
+
+        CommandBuffer::End(g_Current.CommandBuffer);
+        Queue::Submit(
+            {CommandBuffer::GetSubmitInfo(g_Current.CommandBuffer)},
+            {},
+            {Semaphore::GetSubmitInfo(g_Current.Id, vk::PipelineStageFlagBits2::eAllCommands, g_TransferTimeline)},
+            nullptr,
+            Context::GetTransferQueue());
+
+        g_InFlight.push_back(std::move(g_Current));
+        g_Current = Submission{};
+
+        return g_InFlight.back().Id;
+    }
+
+    bool UploadContext::IsComplete(Ticket ticket) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        if (ticket > g_CompletedTicket) RetireSubmissions(false);
+        return ticket <= g_CompletedTicket;
+    }
+
+    void UploadContext::Wait(Ticket ticket) {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        DVRE_ASSERT(ticket <= g_NextTicket, "Invalid vre::Vulkan::UploadContext ticket: {}", ticket);
+
+        if (ticket == g_NextTicket) Flush();
+        ticket = std::min(ticket, g_NextTicket - 1u);
+        if (ticket <= g_CompletedTicket) return;
+
+        const vk::Device device = Context::GetDevice();
+        Semaphore::Wait(ticket, g_TransferTimeline, device);
+        RetireSubmissions(false);
+
+        if (!Context::IsTransferQueueDedicated()) return;
+        Semaphore::Wait(ticket, g_AcquireTimeline, device);
+        RetireSubmissions(false);
+    }
+
+    void UploadContext::Update() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        Flush();
+        RetireSubmissions(false);
+    }
+
+    std::uint64_t UploadContext::GetRingUsage() {
+        DVRE_ASSERT(g_IsInitialized, "vre::Vulkan::UploadContext must be initialized");
+        return g_Head - g_Tail;
+    }
+
+    UploadContext::Staging UploadContext::Stage(const void *data, std::uint64_t size, std::uint64_t alignment) {
+        const std::optional<std::uint64_t> offset = Reserve(size, alignment);
+        if (offset.has_value()) {
+            std::memcpy(g_RingData + *offset, data, size);
+            DVRE_VK_CHECK(vmaFlushAllocation(g_Ring.Allocator, g_Ring.Allocation, *offset, size));
+            return Staging{g_Ring, *offset};
+        }
+
+        // Uploads larger than the whole ring get a dedicated staging buffer that lives until the batch retires.
+        Buffer::Allocation staging = Buffer::AllocateMapped(
+            VMA_MEMORY_USAGE_CPU_ONLY,
+            size,
+            vk::BufferUsageFlagBits::eTransferSrc,
+            Context::GetVmaAllocator());
+
+        VmaAllocationInfo allocationInfo{};
+        vmaGetAllocationInfo(staging.Allocator, staging.Allocation, &allocationInfo);
+        std::memcpy(allocationInfo.pMappedData, data, size);
+        DVRE_VK_CHECK(vmaFlushAllocation(staging.Allocator, staging.Allocation, 0u, VK_WHOLE_SIZE));
+
+        BeginSubmission();
+        g_Current.Staging.push_back(staging);
+        return Staging{staging, 0u};
+    }
+
+    std::optional<std::uint64_t> UploadContext::Reserve(std::uint64_t size, std::uint64_t alignment) {
+        const std::uint64_t ringSize = g_Settings.RingSize;
+        if (size > ringSize) return std::nullopt;
+
+        while (true) {
+            if (g_Head == g_Tail && g_InFlight.empty()) {
+                g_Head = 0u;
+                g_Tail = 0u;
+            }
+
+            // Head and tail only ever grow. Offsets are aligned within the ring so they stay aligned on later laps when the ring
+            // size is not a multiple of the alignment, an allocation that would straddle the end skips to the next lap.
+            const std::uint64_t position = g_Head % ringSize;
+            const std::uint64_t aligned  = AlignUp(position, alignment);
+            const std::uint64_t offset   = aligned + size <= ringSize ? g_Head - position + aligned : AlignUp(g_Head, ringSize);
+            if (offset + size - g_Tail <= ringSize) {
+                g_Head = offset + size;
+                return offset % ringSize;
+            }
+
+            if (g_InFlight.empty()) Flush();
+            RetireSubmissions(true);
+        }
+    }
+
+    void UploadContext::BeginSubmission() {
+        if (g_Current.CommandBuffer) return;
+
+        if (!g_FreeSubmissions.empty()) {
+            g_Current = std::move(g_FreeSubmissions.back());
+            g_FreeSubmissions.pop_back();
+        } else {
+            g_Current.CommandBuffer = CommandBuffer::AllocatePrimary(g_CommandPool, Context::GetDevice());
+        }
+
+        CommandBuffer::BeginOneTimeSubmit(g_Current.CommandBuffer);
+    }
+
+    void UploadContext::RetireSubmissions(bool wait) {
+        const vk::Device device = Context::GetDevice();
+
+        if (wait && !g_InFlight.empty()) Semaphore::Wait(g_InFlight.front().Id, g_TransferTimeline, device);
+
+        // Both queues execute their submissions in order, so each timeline retires batches from the oldest one forward.
+        const std::uint64_t transferred = Semaphore::GetValue(g_TransferTimeline, device);
+        while (!g_InFlight.empty() && g_InFlight.front().Id <= transferred) {
+            Submission &submission = g_InFlight.front();
+            g_Tail                 = submission.RingEnd;
+
+            for (const Buffer::Allocation &staging : submission.Staging)
+                Buffer::Release(staging);
+            submission.Staging.clear();
+
+            if (Context::IsTransferQueueDedicated()) {
+                Acquire(submission);
+                g_Acquiring.push_back(std::move(submission));
+            } else {
+                Recycle(submission);
+            }
+            g_InFlight.pop_front();
+        }
+
+        if (!Context::IsTransferQueueDedicated()) return;
+
+        const std::uint64_t acquired = Semaphore::GetValue(g_AcquireTimeline, device);
+        while (!g_Acquiring.empty() && g_Acquiring.front().Id <= acquired) {
+            Recycle(g_Acquiring.front());
+            g_Acquiring.pop_front();
+        }
+    }
+
+    void UploadContext::Acquire(Submission &submission) {
+        // The acquiring half is only submitted once the transfer has finished, so the graphics queue never waits on it.
+        if (!submission.AcquireCommandBuffer)
+            submission.AcquireCommandBuffer = CommandBuffer::AllocatePrimary(g_AcquireCommandPool, Context::GetDevice());
+
+        CommandBuffer::BeginOneTimeSubmit(submission.AcquireCommandBuffer);
+        TransferOwnership(submission.AcquireCommandBuffer, submission);
+        CommandBuffer::End(submission.AcquireCommandBuffer);
+
+        Queue::Submit(
+            {CommandBuffer::GetSubmitInfo(submission.AcquireCommandBuffer)},
+            {Semaphore::GetSubmitInfo(submission.Id, vk::PipelineStageFlagBits2::eAllCommands, g_TransferTimeline)},
+            {Semaphore::GetSubmitInfo(submission.Id, vk::PipelineStageFlagBits2::eAllCommands, g_AcquireTimeline)},
+            nullptr,
+            Context::GetGraphicsQueue());
+    }
+
+    void UploadContext::Recycle(Submission &submission) {
+        g_CompletedTicket = submission.Id;
+
+        submission.Buffers.clear();
+        submission.Images.clear();
+        submission.Id      = INVALID_TICKET;
+        submission.RingEnd = 0u;
+        g_FreeSubmissions.push_back(std::move(submission));
+    }
+
+    void UploadContext::TransferOwnership(const vk::CommandBuffer &commandBuffer, const Submission &submission) {
+        const std::uint32_t sourceQueueFamilyIndex      = Context::GetTransferQueueFamilyIndex();
+        const std::uint32_t destinationQueueFamilyIndex = Context::GetQueueFamilyIndex();
+
+        std::vector<vk::BufferMemoryBarrier2> bufferBarriers{};
+        bufferBarriers.reserve(submission.Buffers.size());
+        for (const BufferOwnership &buffer : submission.Buffers)
+            bufferBarriers.push_back(Buffer::GetOwnershipBarrier(buffer.Target, buffer.Offset, buffer.Size, sourceQueueFamilyIndex, destinationQueueFamilyIndex));
+
+        std::vector<vk::ImageMemoryBarrier2> imageBarriers{};
+        imageBarriers.reserve(submission.Images.size());
+        for (const ImageOwnership &image : submission.Images) {
+            imageBarriers.push_back(Image::GetOwnershipBarrier(
+                image.Target,
+                image.Range,
+                vk::ImageLayout::eTransferDstOptimal,
+                vk::ImageLayout::eShaderReadOnlyOptimal,
+                sourceQueueFamilyIndex,
+                destinationQueueFamilyIndex));
+        }
+
+        commandBuffer.pipelineBarrier2({vk::DependencyInfo{{}, {}, bufferBarriers, imageBarriers}});
+    }
+
+    UploadContext::~UploadContext() {
+        VRE_ASSERT(!g_IsInitialized, "vre::Vulkan::UploadContext must be shut down before closing!");
+    }
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <VREngine/Vulkan/VertexFormat.hpp>
+
+namespace vre::Vulkan {
+    namespace VertexAttribute {
+        void Float2::Encode(const Source &value, std::byte *destination) {
+            const std::array<float, 2> data{value.x, value.y};
+            std::memcpy(destination, data.data(), Size);
+        }
+
+        void Float3::Encode(const Source &value, std::byte *destination) {
+            const std::array<float, 3> data{value.x, value.y, value.z};
+            std::memcpy(destination, data.data(), Size);
+        }
+
+        void Float4::Encode(const Source &value, std::byte *destination) {
+            const std::array<float, 4> data{value.x, value.y, value.z, value.w};
+            std::memcpy(destination, data.data(), Size);
+        }
+
+        void Half2::Encode(const Source &value, std::byte *destination) {
+            const std::uint32_t data = glm::packHalf2x16(value);
+            std::memcpy(destination, &data, Size);
+        }
+
+        void Half4::Encode(const Source &value, std::byte *destination) {
+            const std::uint64_t data = glm::packHalf4x16(value);
+            std::memcpy(destination, &data, Size);
+        }
+
+        void Snorm16x4::Encode(const Source &value, std::byte *destination) {
+            const std::uint64_t data = glm::packSnorm4x16(value);
+            std::memcpy(destination, &data, Size);
+        }
+
+        void OctahedralNormal::Encode(const Source &value, std::byte *destination) {
+            const std::uint32_t data = glm::packSnorm2x16(EncodeOctahedral(value));
+            std::memcpy(destination, &data, Size);
+        }
+
+        void Unorm8x4::Encode(const Source &value, std::byte *destination) {
+            const std::uint32_t data = glm::packUnorm4x8(value);
+            std::memcpy(destination, &data, Size);
+        }
+
+        glm::vec2 EncodeOctahedral(const glm::vec3 &normal) {
+            const float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+            if (sum == 0.0f) return glm::vec2{0.0f};
+
+            glm::vec2 encoded = glm::vec2{normal.x, normal.y} / sum;
+            if (normal.z < 0.0f) {
+                const glm::vec2 sign{encoded.x >= 0.0f ? 1.0f : -1.0f, encoded.y >= 0.0f ? 1.0f : -1.0f};
+                encoded = (1.0f - glm::abs(glm::vec2{encoded.y, encoded.x})) * sign;
+            }
+            return encoded;
+        }
+
+        glm::vec3 DecodeOctahedral(const glm::vec2 &encoded) {
+            glm::vec3   normal{encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y)};
+            const float t = std::max(-normal.z, 0.0f);
+            normal.x += normal.x >= 0.0f ? -t : t;
+            normal.y += normal.y >= 0.0f ? -t : t;
+            return glm::normalize(normal);
+        }
+    }  // namespace VertexAttribute
+
+    namespace IndexFormat {
+        vk::IndexType SelectType(std::uint32_t vertexCount) {
+            return vertexCount <= std::uint32_t(std::numeric_limits<std::uint16_t>::max())
+                       ? vk::IndexType::eUint16
+                       : vk::IndexType::eUint32;
+        }
+
+        std::uint32_t GetSize(vk::IndexType type) {
+            switch (type) {
+                case vk::IndexType::eUint16:
+                    return 2u;
+                case vk::IndexType::eUint32:
+                    return 4u;
+                default:
+                    VRE_ASSERT(false, "Unsupported index type: {}", vk::to_string(type));
+                    return 0u;
+            }
+        }
+
+        std::vector<std::byte> Pack(std::span<const std::uint32_t> indices, vk::IndexType type) {
+            std::vector<std::byte> data(indices.size() * GetSize(type));
+
+            if (type == vk::IndexType::eUint32) {
+                std::memcpy(data.data(), indices.data(), data.size());
+                return data;
+            }
+
+            VRE_ASSERT(type == vk::IndexType::eUint16, "Unsupported index type: {}", vk::to_string(type));
+            for (std::size_t i = 0u; i < indices.size(); i++) {
+                DVRE_ASSERT(indices[i] < std::numeric_limits<std::uint16_t>::max(), "Index {} does not fit into a 16-bit index buffer", indices[i]);
+                const std::uint16_t index = std::uint16_t(indices[i]);
+                std::memcpy(data.data() + i * sizeof(std::uint16_t), &index, sizeof(std::uint16_t));
+            }
+            return data;
+        }
+    }  // namespace IndexFormat
+}  // namespace vre::Vulkan
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <VREngine/Vulkan/VertexPulling.hpp>
+#include <VREngine/Vulkan/Context.hpp>
+#include <VREngine/Vulkan/Pipeline.hpp>
+
+namespace vre::Vulkan::VertexPulling {
+    vk::ShaderStageFlags GetStageFlags() {
+        vk::ShaderStageFlags stageFlags = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment;
+        if (Context::IsMeshShaderSupported()) stageFlags |= vk::ShaderStageFlagBits::eTaskEXT | vk::ShaderStageFlagBits::eMeshEXT;
+        return stageFlags;
+    }
+
+    vk::PushConstantRange GetPushConstantRange() {
+        return vk::PushConstantRange{
+            GetStageFlags(),
+            0u,
+            std::uint32_t(sizeof(PushConstants)),
+        };
+    }
+
+    vk::PipelineLayout CreateLayout(
+        const vk::ArrayProxy<vk::DescriptorSetLayout> &setLayouts,
+        const vk::Device                              &device) {
+        return PipelineLayout::Create(setLayouts, {GetPushConstantRange()}, device);
+    }
+
+    vk::PipelineLayout CreateLayout(const vk::Device &device) {
+        return CreateLayout({}, device);
+    }
+
+    void Push(
+        const vk::CommandBuffer  &commandBuffer,
+        const vk::PipelineLayout &layout,
+        const PushConstants      &pushConstants) {
+        commandBuffer.pushConstants(layout, GetStageFlags(), 0u, std::uint32_t(sizeof(PushConstants)), &pushConstants);
+    }
+}  // namespace vre::Vulkan::VertexPulling
\ No newline at end of file